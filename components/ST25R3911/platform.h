@@ -135,7 +135,10 @@ extern void IRQ_Disable(void);
 #define platformDelay(t) nrf_delay_ms(t)                    /*!< Performs a delay for the given time (ms)    */
 
 extern uint32_t get_sysTick(void);
+extern uint64_t get_sysTick64(void);
+extern uint64_t get_sysTick_us(void);
 #define platformGetSysTick() get_sysTick() /*!< Get System Tick ( 1 tick = 1 ms)            */
+#define platformGetSysTickUs() get_sysTick_us() /*!< Get time in microseconds                  */
 extern void spi0_cs_enable(void);
 extern void spi0_cs_disable(void);
 #define platformSpiSelect() spi0_cs_enable()/*platformGpioClear(ST25R391X_SS_PIN) !< SPI SS\CS: Chip|Slave Select                */
@@ -152,6 +155,7 @@ extern uint8_t nrf_spi_tx_rx(const uint8_t *txData, uint8_t *rxData, uint8_t len
 #define platformI2CSlaveAddrRD(add) /*!< I2C Slave address for Read operation        */
 
 #define platformLog(...) NRF_LOG_INTERNAL_INFO(__VA_ARGS__) /*!< Log  method                                 */
+#define platformLogHex(data, len) NRF_LOG_INTERNAL_HEXDUMP_INFO(data, len) /*!< Log data as hexdump      */
 
 /*
 ******************************************************************************
@@ -170,7 +174,11 @@ extern uint8_t nrf_spi_tx_rx(const uint8_t *txData, uint8_t *rxData, uint8_t len
 #define RFAL_FEATURE_ISO_DEP true               /*!< Enable/Disable RFAL support for ISO-DEP (ISO14443-4)                      */
 #define RFAL_FEATURE_NFC_DEP true               /*!< Enable/Disable RFAL support for NFC-DEP (NFCIP1/P2P)                      */
 
-#define RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN 256 /*!< ISO-DEP I-Block max length. Please use values as defined by rfalIsoDepFSx */
+#ifndef RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN
+#define RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN 1024 /*!< ISO-DEP I-Block max length. Please use values as defined by rfalIsoDepFSx */
+#endif
+#ifndef RFAL_FEATURE_ISO_DEP_APDU_MAX_LEN
 #define RFAL_FEATURE_ISO_DEP_APDU_MAX_LEN 1024  /*!< ISO-DEP APDU max length. Please use multiples of I-Block max length       */
+#endif
 
 #endif /* PLATFORM_H */
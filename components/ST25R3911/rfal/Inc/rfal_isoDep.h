@@ -98,7 +98,29 @@
 #define RFAL_ISODEP_DEFAULT_FSC                 RFAL_ISODEP_FSX_256  /*!< FSC default value (aligned RFAL_ISODEP_DEFAULT_FSCI) */
 #define RFAL_ISODEP_DEFAULT_SFGI                (0)                  /*!< SFGI Default value to be used  in Listen Mode        */
 
-#define RFAL_ISODEP_APDU_MAX_LEN                RFAL_ISODEP_FSX_1024  /*!< Max APDU length                                     */
+#ifndef RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN
+#define RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN     256                   /*!< ISO-DEP I-Block max length, if not set by platform  */
+#endif
+
+#ifndef RFAL_FEATURE_ISO_DEP_APDU_MAX_LEN
+#define RFAL_FEATURE_ISO_DEP_APDU_MAX_LEN       1024                  /*!< ISO-DEP APDU max length, if not set by platform     */
+#endif
+
+#define RFAL_ISODEP_APDU_MAX_LEN                RFAL_FEATURE_ISO_DEP_APDU_MAX_LEN  /*!< Max APDU length                        */
+
+/*! Largest FSDI whose frames fit into rfalIsoDepBufFormat, to be requested on RATS/ATTRIB.
+ *  FSDI above 256 bytes (ISO14443-3 Amd2) is only honoured in RFAL_COMPLIANCE_MODE_ISO     */
+#if   (RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN >= 4096)
+#define RFAL_ISODEP_FSDI_MAX                    RFAL_ISODEP_FSXI_4096
+#elif (RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN >= 2048)
+#define RFAL_ISODEP_FSDI_MAX                    RFAL_ISODEP_FSXI_2048
+#elif (RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN >= 1024)
+#define RFAL_ISODEP_FSDI_MAX                    RFAL_ISODEP_FSXI_1024
+#elif (RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN >= 512)
+#define RFAL_ISODEP_FSDI_MAX                    RFAL_ISODEP_FSXI_512
+#else
+#define RFAL_ISODEP_FSDI_MAX                    RFAL_ISODEP_FSXI_256
+#endif
 
 #define RFAL_ISODEP_ATTRIB_RES_MBLI_NO_INFO     (0x00)  /*!< MBLI indicating no information on its internal input buffer size  */
 #define RFAL_ISODEP_ATTRIB_REQ_PARAM1_DEFAULT   (0x00)  /*!< Default values of Param 1 of ATTRIB_REQ Digital 1.0  12.6.1.3-5   */
@@ -318,7 +340,7 @@ typedef struct
 typedef struct
 {
     uint8_t  prologue[RFAL_ISODEP_PROLOGUE_SIZE];   /*!< Prologue/SoD buffer                      */
-    uint8_t  inf[RFAL_ISODEP_DEFAULT_FSC];          /*!< INF/Payload buffer                       */
+    uint8_t  inf[RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN]; /*!< INF/Payload buffer                    */
 } rfalIsoDepBufFormat;
 
 
@@ -372,6 +394,11 @@ typedef struct
     uint8_t                  DID;                   /*!< Device ID (RFAL_ISODEP_NO_DID if no DID) */
 } rfalIsoDepApduTxRxParam;
 
+
+/*! Callback delivering the INF of each received I-Block in APDU streaming mode
+ *  The data is only valid during the call; isChaining is false on the last block */
+typedef void (* rfalIsoDepApduRxCallback)( void *ctx, const uint8_t *data, uint16_t len, bool isChaining );
+
 /*
  ******************************************************************************
  * GLOBAL FUNCTION PROTOTYPES
@@ -642,6 +669,35 @@ ReturnCode rfalIsoDepStartApduTransceive( rfalIsoDepApduTxRxParam param );
  */
 ReturnCode rfalIsoDepGetApduTransceiveStatus( void );
 
+
+/*!
+ *****************************************************************************
+ *  \brief ISO-DEP Start APDU Transceive in streaming mode
+ *  
+ *  Same as rfalIsoDepStartApduTransceive() but the response is not staged
+ *  in param.rxBuf: the INF of every received I-Block is handed to rxCb
+ *  straight from param.tmpBuf as soon as it has been acknowledged.
+ *  param.rxBuf is not used and may be NULL, at the end *param.rxLen holds
+ *  the total response length. The status is retrieved with
+ *  rfalIsoDepGetApduTransceiveStatus()
+ *  
+ *  The response length is therefore not limited by RFAL_ISODEP_APDU_MAX_LEN
+ *  
+ *  \warning rxCb is called from rfalIsoDepGetApduTransceiveStatus() and
+ *           must consume the data before returning, the next I-Block is
+ *           already being received into param.tmpBuf
+ *  
+ *  \param[in] param : reference parameters to be used for the Transceive
+ *  \param[in] rxCb  : callback receiving the response data
+ *  \param[in] ctx   : context passed to rxCb
+ *                     
+ *  \return ERR_PARAM       : Bad request
+ *  \return ERR_WRONG_STATE : The module is not in a proper state
+ *  \return ERR_NONE        : The Transceive request has been started
+ *****************************************************************************
+ */
+ReturnCode rfalIsoDepStartApduStreamTransceive( rfalIsoDepApduTxRxParam param, rfalIsoDepApduRxCallback rxCb, void *ctx );
+
 /*! 
  *****************************************************************************
  *  \brief  ISO-DEP Send RATS
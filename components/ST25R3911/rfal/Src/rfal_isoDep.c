@@ -389,6 +389,8 @@ typedef struct{
   uint16_t                APDUTxPos;        /*!< APDU Tx position               */
   uint16_t                APDURxPos;        /*!< APDU Rx position               */
   bool                    isAPDURxChaining; /*!< APDU Transceive chaining flag  */
+  rfalIsoDepApduRxCallback APDURxCb;        /*!< APDU streaming Rx callback     */
+  void                    *APDURxCbCtx;     /*!< APDU streaming Rx context      */
   
 }rfalIsoDep;
 
@@ -415,6 +417,7 @@ static ReturnCode isoDepHandleControlMsg( rfalIsoDepControlMsg controlMsg, uint8
 static ReturnCode isoDepReSendControlMsg( void );
 static void rfalIsoDepCalcBitRate(rfalBitRate maxAllowedBR, uint8_t piccBRCapability, rfalBitRate *dsi, rfalBitRate *dri);
 static void rfalIsoDepApdu2IBLockParam( rfalIsoDepApduTxRxParam apduParam, rfalIsoDepTxRxParam *iBlockParam, uint16_t txPos, uint16_t rxPos );
+static ReturnCode rfalIsoDepApduRxChunk( bool isChaining );
 
 
 /*
@@ -995,7 +998,19 @@ uint16_t rfalIsoDepFSxI2FSx( uint8_t FSxI )
         case RFAL_ISODEP_FSXI_64:            return RFAL_ISODEP_FSX_64;
         case RFAL_ISODEP_FSXI_96:            return RFAL_ISODEP_FSX_96;
         case RFAL_ISODEP_FSXI_128:           return RFAL_ISODEP_FSX_128;
-    }        
+    }
+    
+    /* Frame sizes above 256 are defined by ISO14443-3 Amd2 only, Digital and EMVCo treat them as 256 */
+    if( gIsoDep.compMode == RFAL_COMPLIANCE_MODE_ISO )
+    {
+        switch( FSxI )
+        {
+            case RFAL_ISODEP_FSXI_512:       return RFAL_ISODEP_FSX_512;
+            case RFAL_ISODEP_FSXI_1024:      return RFAL_ISODEP_FSX_1024;
+            case RFAL_ISODEP_FSXI_2048:      return RFAL_ISODEP_FSX_2048;
+            case RFAL_ISODEP_FSXI_4096:      return RFAL_ISODEP_FSX_4096;
+        }
+    }
     return RFAL_ISODEP_FSX_256;
 }
 
@@ -1341,7 +1356,7 @@ ReturnCode rfalIsoDepListenGetActivationStatus( void )
 uint16_t rfalIsoDepGetMaxInfLen( void )
 {
     /* Check whether all parameters are valid, otherwise return minimum default value */
-    if( (gIsoDep.fsx < RFAL_ISODEP_FSX_16) || (gIsoDep.fsx > RFAL_ISODEP_FSX_1024) || (gIsoDep.hdrLen > ISODEP_HDR_MAX_LEN) )
+    if( (gIsoDep.fsx < RFAL_ISODEP_FSX_16) || (gIsoDep.fsx > RFAL_ISODEP_FSX_4096) || (gIsoDep.hdrLen > ISODEP_HDR_MAX_LEN) )
     {
         return (RFAL_ISODEP_FSX_16 - RFAL_ISODEP_PCB_LEN - ISODEP_CRC_LEN);
     }
@@ -1753,6 +1768,12 @@ ReturnCode rfalIsoDepRATS( rfalIsoDepFSxI FSDI, uint8_t DID, rfalIsoDepAts *ats
         return ERR_PARAM;
     }
     
+    /* FSDI above 256 bytes is only defined by ISO14443-3 Amd2, do not announce more than we accept */
+    if( (gIsoDep.compMode != RFAL_COMPLIANCE_MODE_ISO) && (FSDI > RFAL_ISODEP_FSXI_256) )
+    {
+        FSDI = RFAL_ISODEP_FSXI_256;
+    }
+    
     /*******************************************************************************/
     /* Compose RATS */
     ratsReq.CMD   = RFAL_ISODEP_CMD_RATS;
@@ -1827,6 +1848,12 @@ ReturnCode rfalIsoDepATTRIB( uint8_t* nfcid0, uint8_t PARAM1, rfalBitRate DSI, r
         return ERR_NONE;
     }
     
+    /* FSDI above 256 bytes is only defined by ISO14443-3 Amd2, do not announce more than we accept */
+    if( (gIsoDep.compMode != RFAL_COMPLIANCE_MODE_ISO) && (FSDI > RFAL_ISODEP_FSXI_256) )
+    {
+        FSDI = RFAL_ISODEP_FSXI_256;
+    }
+    
     /*******************************************************************************/
     /* Compose ATTRIB command */
     attribCmd.cmd          = RFAL_ISODEP_CMD_ATTRIB;
@@ -2184,8 +2211,9 @@ static void rfalIsoDepCalcBitRate( rfalBitRate maxAllowedBR, uint8_t piccBRCapab
          iBlockParam->txBufLen     = (apduParam.txBufLen - txPos);
      }
      
-     /* TxBuf is moved to the beginning for every I-Block */
-     iBlockParam->txBuf        = (rfalIsoDepBufFormat*)apduParam.txBuf;
+     /* Point the I-Block straight into the APDU, its prologue overlaps the tail of the previous  *
+      * block which has already been acknowledged, so no data needs to be moved between blocks   */
+     iBlockParam->txBuf        = (rfalIsoDepBufFormat*)(((uint8_t*)apduParam.txBuf) + txPos);
      iBlockParam->rxBuf        = apduParam.tmpBuf;                        /* Simply using the apdu buffer is not possible because of current ACK handling */
      iBlockParam->isRxChaining = &gIsoDep.isAPDURxChaining;
      iBlockParam->rxLen        = apduParam.rxLen;
@@ -2194,13 +2222,27 @@ static void rfalIsoDepCalcBitRate( rfalBitRate maxAllowedBR, uint8_t piccBRCapab
  
 /*******************************************************************************/
 ReturnCode rfalIsoDepStartApduTransceive( rfalIsoDepApduTxRxParam param )
+{
+    return rfalIsoDepStartApduStreamTransceive( param, NULL, NULL );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalIsoDepStartApduStreamTransceive( rfalIsoDepApduTxRxParam param, rfalIsoDepApduRxCallback rxCb, void *ctx )
 {
     rfalIsoDepTxRxParam txRxParam;
     
+    if( (param.txBuf == NULL) || (param.tmpBuf == NULL) || (param.rxLen == NULL) || ((rxCb == NULL) && (param.rxBuf == NULL)) )
+    {
+        return ERR_PARAM;
+    }
+    
     /* Initialize and store APDU context */
-    gIsoDep.APDUParam = param;
-    gIsoDep.APDUTxPos = 0;
-    gIsoDep.APDURxPos = 0;
+    gIsoDep.APDUParam   = param;
+    gIsoDep.APDUTxPos   = 0;
+    gIsoDep.APDURxPos   = 0;
+    gIsoDep.APDURxCb    = rxCb;
+    gIsoDep.APDURxCbCtx = ctx;
     
     /* Assign current FSx to calculate INF length */
     gIsoDep.ourFsx = param.ourFSx;
@@ -2213,54 +2255,78 @@ ReturnCode rfalIsoDepStartApduTransceive( rfalIsoDepApduTxRxParam param )
 }
  
  
+/*******************************************************************************/
+static ReturnCode rfalIsoDepApduRxChunk( bool isChaining )
+{
+    if( gIsoDep.APDURxCb != NULL )
+    {
+        /* Streaming mode: hand the INF over while it is still in the tmp buffer */
+        gIsoDep.APDURxCb( gIsoDep.APDURxCbCtx, gIsoDep.APDUParam.tmpBuf->inf, *gIsoDep.APDUParam.rxLen, isChaining );
+    }
+    else
+    {
+        /* Check if the packet still fits the APDU buffer */
+        if( (gIsoDep.APDURxPos + *gIsoDep.APDUParam.rxLen) > RFAL_ISODEP_APDU_MAX_LEN )
+        {
+            return ERR_NOMEM;
+        }
+        
+        /* Copy packet from tmp buffer to APDU buffer */
+        ST_MEMCPY( &gIsoDep.APDUParam.rxBuf->apdu[gIsoDep.APDURxPos], gIsoDep.APDUParam.tmpBuf->inf, *gIsoDep.APDUParam.rxLen );
+    }
+    gIsoDep.APDURxPos += *gIsoDep.APDUParam.rxLen;
+    
+    return ERR_NONE;
+}
+
+
 /*******************************************************************************/
 ReturnCode rfalIsoDepGetApduTransceiveStatus( void )
 {
     ReturnCode          ret;
     rfalIsoDepTxRxParam txRxParam;
     
-    ret = rfalIsoDepGetTransceiveStatus();
-    switch( ret )
+    do
     {
-        /*******************************************************************************/
-        case ERR_NONE:
-         
-            /* Check if we are still doing chaining on Tx */
-            if( gIsoDep.isTxChaining )
-            {
-                /* Add already Tx bytes */
-                gIsoDep.APDUTxPos += gIsoDep.txBufLen;
+        ret = rfalIsoDepGetTransceiveStatus();
+        switch( ret )
+        {
+            /*******************************************************************************/
+            case ERR_NONE:
+             
+                /* Check if we are still doing chaining on Tx */
+                if( gIsoDep.isTxChaining )
+                {
+                    /* Add already Tx bytes */
+                    gIsoDep.APDUTxPos += gIsoDep.txBufLen;
+                    
+                    /* Convert APDU TxRxParams to I-Block TxRxParams, pointing at the next I-Block in place */
+                    rfalIsoDepApdu2IBLockParam( gIsoDep.APDUParam, &txRxParam, gIsoDep.APDUTxPos, gIsoDep.APDURxPos );
+                    
+                    /* Put the next I-Block on air right away instead of on the next call */
+                    rfalIsoDepStartTransceive( txRxParam );
+                    ret = ERR_BUSY;
+                    continue;
+                }
                 
-                /* Convert APDU TxRxParams to I-Block TxRxParams */
-                rfalIsoDepApdu2IBLockParam( gIsoDep.APDUParam, &txRxParam, gIsoDep.APDUTxPos, gIsoDep.APDURxPos );
+                EXIT_ON_ERR( ret, rfalIsoDepApduRxChunk( false ) );
                 
-                /* Move next I-Block to beginning of APDU Tx buffer */
-                ST_MEMCPY( gIsoDep.APDUParam.txBuf->apdu, &gIsoDep.APDUParam.txBuf->apdu[gIsoDep.APDUTxPos], txRxParam.txBufLen );
+                /* APDU TxRx is done */
+                break;
+             
+            /*******************************************************************************/
+            case ERR_AGAIN:
+                EXIT_ON_ERR( ret, rfalIsoDepApduRxChunk( true ) );
                 
-                rfalIsoDepStartTransceive( txRxParam );
+                /* Wait for next I-Block */
                 return ERR_BUSY;
-            }
-            
-            /* Copy packet from tmp buffer to APDU buffer */
-            ST_MEMCPY( &gIsoDep.APDUParam.rxBuf->apdu[gIsoDep.APDURxPos], gIsoDep.APDUParam.tmpBuf->inf, *gIsoDep.APDUParam.rxLen );
-            gIsoDep.APDURxPos += *gIsoDep.APDUParam.rxLen;
-             
-            /* APDU TxRx is done */
-            break;
-         
-        /*******************************************************************************/
-        case ERR_AGAIN:
-            /* Copy chained packet from tmp buffer to APDU buffer */
-            ST_MEMCPY( &gIsoDep.APDUParam.rxBuf->apdu[gIsoDep.APDURxPos], gIsoDep.APDUParam.tmpBuf->inf, *gIsoDep.APDUParam.rxLen );
-            gIsoDep.APDURxPos += *gIsoDep.APDUParam.rxLen;
             
-            /* Wait for next I-Block */
-            return ERR_BUSY;
-        
-        /*******************************************************************************/
-        default:
-            return ret;
+            /*******************************************************************************/
+            default:
+                return ret;
+        }
     }
+    while( ret == ERR_BUSY );
     
     *gIsoDep.APDUParam.rxLen = gIsoDep.APDURxPos;
     
@@ -477,7 +477,7 @@ ReturnCode rfalNfvReadSingleBlock( uint8_t flags, uint8_t* uid, uint8_t blockNum
         req.REQ_FLAG |= RFAL_NFCV_REQ_FLAG_ADDRESS;
         ST_MEMCPY( req.payload.UID, uid, RFAL_NFCV_UID_LEN );
         msgIt += RFAL_NFCV_UID_LEN;
-        req.payload.data[ (RFAL_NFCV_UID_LEN + msgIt++) ] = blockNum;
+        req.payload.data[msgIt++] = blockNum;
     }
     else
     {
@@ -591,8 +591,8 @@ ReturnCode rfalNfvReadMultipleBlocks( uint8_t flags, uint8_t* uid, uint8_t first
         req.REQ_FLAG |= RFAL_NFCV_REQ_FLAG_ADDRESS;
         ST_MEMCPY( req.payload.UID, uid, RFAL_NFCV_UID_LEN );
         msgIt += RFAL_NFCV_UID_LEN;
-        req.payload.data[ (RFAL_NFCV_UID_LEN + msgIt++) ] = firstBlockNum;
-        req.payload.data[ (RFAL_NFCV_UID_LEN + msgIt++) ] = numOfBlocks;
+        req.payload.data[msgIt++] = firstBlockNum;
+        req.payload.data[msgIt++] = numOfBlocks;
     }
     else
     {
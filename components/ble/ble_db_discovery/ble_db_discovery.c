@@ -43,7 +43,11 @@
 #if NRF_MODULE_ENABLED(BLE_DB_DISCOVERY)
 #include "ble_db_discovery.h"
 #include <stdlib.h>
+#include <stddef.h>
 #include "ble_srv_common.h"
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+#include "peer_manager.h"
+#endif
 #define NRF_LOG_MODULE_NAME ble_db_disc
 #include "nrf_log.h"
 NRF_LOG_MODULE_REGISTER();
@@ -52,6 +56,17 @@ NRF_LOG_MODULE_REGISTER();
 #define DB_DISCOVERY_MAX_USERS BLE_DB_DISCOVERY_MAX_SRV  /**< The maximum number of users/registrations allowed by this module. */
 #define MODULE_INITIALIZED (m_initialized == true)       /**< Macro designating whether the module has been initialized properly. */
 
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+#define DB_HASH_CHAR_UUID      0x2B2A                    /**< UUID of the Database Hash characteristic. */
+#define DB_HASH_END_HANDLE     0xFFFF                    /**< End handle of the Database Hash characteristic search. */
+#define DB_CACHE_PEER_DATA_ID  PM_PEER_DATA_ID_APPLICATION /**< Peer data ID of the stored services. PM_PEER_DATA_ID_GATT_REMOTE holds an array of ble_gatt_db_srv_t, which does not fit the cache. */
+#define DB_DISCOVERY_STATE_SIZE offsetof(ble_db_discovery_t, cache_state) /**< Size of the part of the instance that is cleared when a discovery starts. */
+
+STATIC_ASSERT((sizeof(ble_db_discovery_cache_t) % 4) == 0, "The cache must be stored in whole words.");
+#else
+#define DB_DISCOVERY_STATE_SIZE sizeof(ble_db_discovery_t) /**< Size of the part of the instance that is cleared when a discovery starts. */
+#endif
+
 
 /**@brief Array of structures containing information about the registered application modules. */
 static ble_uuid_t                       m_registered_handlers[DB_DISCOVERY_MAX_USERS];
@@ -61,6 +76,16 @@ static nrf_ble_gq_t                   * mp_gatt_queue; /**< Pointer to BLE GATT
 static uint32_t m_num_of_handlers_reg;      /**< The number of handlers registered with the DB Discovery module. */
 static bool     m_initialized = false;      /**< This variable Indicates if the module is initialized or not. */
 
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+static __ALIGN(4) ble_db_discovery_cache_t m_cache_store_buf;   /**< Copy of the services being written to flash. The Peer Manager reads it until the write completes. */
+static pm_store_token_t                    m_cache_store_token; /**< Token of the ongoing write. */
+static bool                                m_cache_store_busy;  /**< True while @ref m_cache_store_buf is being written. */
+#endif
+
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+static void cache_store(ble_db_discovery_t * p_db_discovery, uint16_t conn_handle);
+#endif
+
 /**@brief     Function for fetching the event handler provided by a registered application module.
  *
  * @param[in] srv_uuid UUID of the service.
@@ -330,6 +355,9 @@ static void on_srv_disc_completion(ble_db_discovery_t * p_db_discovery,
         // No more service discovery is needed.
         p_db_discovery->discovery_in_progress  = false;
 
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+        cache_store(p_db_discovery, conn_handle);
+#endif
         discovery_available_evt_trigger(p_db_discovery, conn_handle);
     }
 }
@@ -923,7 +951,7 @@ static uint32_t discovery_start(ble_db_discovery_t * const p_db_discovery, uint1
     ble_gatt_db_srv_t * p_srv_being_discovered;
     nrf_ble_gq_req_t    db_srv_disc_req;
 
-    memset(p_db_discovery, 0x00, sizeof(ble_db_discovery_t));
+    memset(p_db_discovery, 0x00, DB_DISCOVERY_STATE_SIZE);
     memset(&db_srv_disc_req, 0x00, sizeof(nrf_ble_gq_req_t));
 
     err_code = nrf_ble_gq_conn_handle_register(mp_gatt_queue, conn_handle);
@@ -960,6 +988,379 @@ static uint32_t discovery_start(ble_db_discovery_t * const p_db_discovery, uint1
 }
 
 
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+/**@brief     Function for loading the stored services of the peer on a connection.
+ *
+ * @details   The stored services are only accepted if they were discovered for the same set of
+ *            registered services, in the same order.
+ *
+ * @param[in] p_db_discovery Pointer to the DB discovery structure.
+ * @param[in] conn_handle    Connection Handle.
+ *
+ * @retval    True if usable services were loaded into the cache of @p p_db_discovery.
+ */
+static bool cache_load(ble_db_discovery_t * p_db_discovery, uint16_t conn_handle)
+{
+    ret_code_t   err_code;
+    pm_peer_id_t peer_id;
+    uint32_t     len = sizeof(ble_db_discovery_cache_t);
+
+    err_code = pm_peer_id_get(conn_handle, &peer_id);
+    if ((err_code != NRF_SUCCESS) || (peer_id == PM_PEER_ID_INVALID))
+    {
+        return false;
+    }
+
+    err_code = pm_peer_data_load(peer_id, DB_CACHE_PEER_DATA_ID, &p_db_discovery->cache, &len);
+    if ((err_code != NRF_SUCCESS) || (len != sizeof(ble_db_discovery_cache_t)))
+    {
+        return false;
+    }
+
+    if (p_db_discovery->cache.srv_count != m_num_of_handlers_reg)
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < m_num_of_handlers_reg; i++)
+    {
+        if (!BLE_UUID_EQ(&p_db_discovery->cache.services[i].srv_uuid, &m_registered_handlers[i]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/**@brief     Function for storing the services found by a full discovery.
+ *
+ * @details   The services are written from a copy, because the Peer Manager writes to flash
+ *            asynchronously and the cache of the instance is reused when a new discovery starts.
+ *            If the peer is not bonded yet, or another write is still ongoing, the store is left
+ *            pending and retried from @ref ble_db_discovery_on_pm_evt.
+ *
+ * @param[in] p_db_discovery Pointer to the DB discovery structure.
+ * @param[in] conn_handle    Connection Handle.
+ */
+static void cache_store(ble_db_discovery_t * p_db_discovery, uint16_t conn_handle)
+{
+    ret_code_t   err_code;
+    pm_peer_id_t peer_id;
+
+    memcpy(p_db_discovery->cache.services,
+           p_db_discovery->services,
+           sizeof(p_db_discovery->cache.services));
+    p_db_discovery->cache.srv_count = m_num_of_handlers_reg;
+
+    err_code = pm_peer_id_get(conn_handle, &peer_id);
+    if ((err_code != NRF_SUCCESS) || (peer_id == PM_PEER_ID_INVALID) || m_cache_store_busy)
+    {
+        p_db_discovery->cache_state = BLE_DB_DISCOVERY_CACHE_STORE_PEND;
+        return;
+    }
+
+    p_db_discovery->cache_state = BLE_DB_DISCOVERY_CACHE_IDLE;
+
+    memcpy(&m_cache_store_buf, &p_db_discovery->cache, sizeof(m_cache_store_buf));
+
+    err_code = pm_peer_data_store(peer_id,
+                                  DB_CACHE_PEER_DATA_ID,
+                                  &m_cache_store_buf,
+                                  sizeof(ble_db_discovery_cache_t),
+                                  &m_cache_store_token);
+    if (err_code == NRF_SUCCESS)
+    {
+        m_cache_store_busy = true;
+    }
+    else
+    {
+        // The services are discovered again on the next connection.
+        NRF_LOG_WARNING("Failed to store discovered services, error 0x%x.", err_code);
+    }
+}
+
+
+/**@brief     Function for reporting the stored services to the registered user modules.
+ *
+ * @param[in] p_db_discovery Pointer to the DB discovery structure.
+ * @param[in] conn_handle    Connection Handle.
+ */
+static void cache_replay(ble_db_discovery_t * p_db_discovery, uint16_t conn_handle)
+{
+    NRF_LOG_DEBUG("Using stored services on connection handle 0x%x.", conn_handle);
+
+    memcpy(p_db_discovery->services,
+           p_db_discovery->cache.services,
+           sizeof(p_db_discovery->services));
+
+    p_db_discovery->cache_state = BLE_DB_DISCOVERY_CACHE_IDLE;
+    p_db_discovery->srv_count   = 0;
+
+    for (uint32_t i = 0; i < m_num_of_handlers_reg; i++)
+    {
+        bool is_srv_found = (p_db_discovery->services[i].handle_range.start_handle != 0);
+
+        if (is_srv_found)
+        {
+            p_db_discovery->srv_count++;
+        }
+
+        p_db_discovery->curr_srv_ind = i;
+        discovery_complete_evt_trigger(p_db_discovery, is_srv_found, conn_handle);
+    }
+
+    p_db_discovery->discoveries_count     = m_num_of_handlers_reg;
+    p_db_discovery->discovery_in_progress = false;
+
+    discovery_available_evt_trigger(p_db_discovery, conn_handle);
+}
+
+
+/**@brief     Function for starting a full discovery when the Database Hash cannot be used.
+ *
+ * @details   The stored services are not used, as they cannot be verified.
+ *
+ * @param[in] p_db_discovery Pointer to the DB discovery structure.
+ * @param[in] conn_handle    Connection Handle.
+ */
+static uint32_t cache_fallback_discovery_start(ble_db_discovery_t * p_db_discovery,
+                                               uint16_t             conn_handle)
+{
+    p_db_discovery->cache.db_hash_valid = false;
+    p_db_discovery->cache_state         = BLE_DB_DISCOVERY_CACHE_IDLE;
+
+    return discovery_start(p_db_discovery, conn_handle);
+}
+
+
+/**@brief     Function for handling an error of the Database Hash read request.
+ *
+ * @param[in] nrf_error   Error code.
+ * @param[in] p_ctx       Pointer to the DB discovery structure.
+ * @param[in] conn_handle Connection Handle.
+ */
+static void db_hash_read_error_handler(uint32_t   nrf_error,
+                                       void     * p_ctx,
+                                       uint16_t   conn_handle)
+{
+    ret_code_t           err_code;
+    ble_db_discovery_t * p_db_discovery = (ble_db_discovery_t *)p_ctx;
+
+    NRF_LOG_DEBUG("Database Hash read failed, error 0x%x. Discovering services.", nrf_error);
+
+    err_code = cache_fallback_discovery_start(p_db_discovery, conn_handle);
+    if (err_code != NRF_SUCCESS)
+    {
+        discovery_error_handler(err_code, p_db_discovery, conn_handle);
+    }
+}
+
+
+/**@brief     Function for reading the Database Hash characteristic of the peer.
+ *
+ * @param[in] p_db_discovery Pointer to the DB discovery structure.
+ * @param[in] conn_handle    Connection Handle.
+ *
+ * @return    This API propagates the error code returned by @ref nrf_ble_gq_item_add.
+ */
+static uint32_t db_hash_read(ble_db_discovery_t * p_db_discovery, uint16_t conn_handle)
+{
+    nrf_ble_gq_req_t db_hash_read_req;
+
+    memset(&db_hash_read_req, 0, sizeof(nrf_ble_gq_req_t));
+
+    db_hash_read_req.type                                                = NRF_BLE_GQ_REQ_GATTC_READ_BY_UUID;
+    db_hash_read_req.params.gattc_read_by_uuid.handle_range.start_handle = SRV_DISC_START_HANDLE;
+    db_hash_read_req.params.gattc_read_by_uuid.handle_range.end_handle   = DB_HASH_END_HANDLE;
+    db_hash_read_req.error_handler.p_ctx                                 = p_db_discovery;
+    db_hash_read_req.error_handler.cb                                    = db_hash_read_error_handler;
+
+    BLE_UUID_BLE_ASSIGN(db_hash_read_req.params.gattc_read_by_uuid.uuid, DB_HASH_CHAR_UUID);
+
+    return nrf_ble_gq_item_add(mp_gatt_queue, &db_hash_read_req, conn_handle);
+}
+
+
+/**@brief     Function for starting a discovery that can be served from the stored services.
+ *
+ * @details   If the peer has stored services that were discovered together with the Database
+ *            Hash, the hash is read first and the stored services are only used if it has not
+ *            changed. If there are no stored services, the hash is read before the full
+ *            discovery, so that it can be stored together with the services.
+ *
+ * @param[in] p_db_discovery Pointer to the DB discovery structure.
+ * @param[in] conn_handle    Connection Handle.
+ */
+static uint32_t cache_discovery_start(ble_db_discovery_t * const p_db_discovery,
+                                      uint16_t                   conn_handle)
+{
+    ret_code_t err_code;
+    bool       is_cached = cache_load(p_db_discovery, conn_handle);
+
+    if (!is_cached)
+    {
+        memset(&p_db_discovery->cache, 0x00, sizeof(ble_db_discovery_cache_t));
+    }
+
+    memset(p_db_discovery, 0x00, DB_DISCOVERY_STATE_SIZE);
+
+    err_code = nrf_ble_gq_conn_handle_register(mp_gatt_queue, conn_handle);
+    VERIFY_SUCCESS(err_code);
+
+    p_db_discovery->conn_handle = conn_handle;
+
+    if (is_cached && !(BLE_DB_DISCOVERY_CACHE_VERIFY && p_db_discovery->cache.db_hash_valid))
+    {
+        cache_replay(p_db_discovery, conn_handle);
+        return NRF_SUCCESS;
+    }
+
+    // Set before the request is queued, as the response can arrive before it returns.
+    p_db_discovery->discovery_in_progress = true;
+    p_db_discovery->cache_state           = is_cached ? BLE_DB_DISCOVERY_CACHE_VERIFYING :
+                                                        BLE_DB_DISCOVERY_CACHE_HASH_READ;
+
+    err_code = db_hash_read(p_db_discovery, conn_handle);
+    if (err_code != NRF_SUCCESS)
+    {
+        // Stored services that cannot be verified are not used.
+        return cache_fallback_discovery_start(p_db_discovery, conn_handle);
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+/**@brief     Function for handling the response to the Database Hash read.
+ *
+ * @param[in] p_db_discovery  Pointer to the DB discovery structure.
+ * @param[in] p_ble_gattc_evt Pointer to the GATT Client event.
+ */
+static void on_db_hash_read_rsp(ble_db_discovery_t       * p_db_discovery,
+                                ble_gattc_evt_t    const * p_ble_gattc_evt)
+{
+    ret_code_t               err_code;
+    ble_gattc_handle_value_t handle_value;
+    uint16_t                 conn_handle = p_ble_gattc_evt->conn_handle;
+    bool                     is_hash_read = false;
+
+    if ((conn_handle != p_db_discovery->conn_handle) ||
+        ((p_db_discovery->cache_state != BLE_DB_DISCOVERY_CACHE_VERIFYING) &&
+         (p_db_discovery->cache_state != BLE_DB_DISCOVERY_CACHE_HASH_READ)))
+    {
+        return;
+    }
+
+    if ((p_ble_gattc_evt->gatt_status == BLE_GATT_STATUS_SUCCESS) &&
+        (p_ble_gattc_evt->params.char_val_by_uuid_read_rsp.value_len == BLE_DB_DISCOVERY_DB_HASH_LEN) &&
+        (sd_ble_gattc_evt_char_val_by_uuid_read_rsp_iter((ble_gattc_evt_t *)p_ble_gattc_evt,
+                                                         &handle_value) == NRF_SUCCESS))
+    {
+        is_hash_read = true;
+    }
+
+    if (p_db_discovery->cache_state == BLE_DB_DISCOVERY_CACHE_VERIFYING)
+    {
+        if (is_hash_read &&
+            (memcmp(handle_value.p_value,
+                    p_db_discovery->cache.db_hash,
+                    BLE_DB_DISCOVERY_DB_HASH_LEN) == 0))
+        {
+            cache_replay(p_db_discovery, conn_handle);
+            return;
+        }
+
+        NRF_LOG_DEBUG("Database Hash changed, discovering services.");
+    }
+
+    p_db_discovery->cache.db_hash_valid = is_hash_read;
+    if (is_hash_read)
+    {
+        memcpy(p_db_discovery->cache.db_hash, handle_value.p_value, BLE_DB_DISCOVERY_DB_HASH_LEN);
+    }
+
+    // Later Read By Type responses, for example of the application, are not Database Hash reads.
+    p_db_discovery->cache_state = BLE_DB_DISCOVERY_CACHE_IDLE;
+
+    err_code = discovery_start(p_db_discovery, conn_handle);
+    if (err_code != NRF_SUCCESS)
+    {
+        discovery_error_handler(err_code, p_db_discovery, conn_handle);
+    }
+}
+
+
+void ble_db_discovery_on_pm_evt(ble_db_discovery_t * p_db_discovery, pm_evt_t const * p_evt)
+{
+    VERIFY_PARAM_NOT_NULL_VOID(p_db_discovery);
+    VERIFY_PARAM_NOT_NULL_VOID(p_evt);
+
+    switch (p_evt->evt_id)
+    {
+        case PM_EVT_CONN_SEC_SUCCEEDED:
+            // The Peer Manager has assigned the peer ID by the time it reports the bond.
+            if ((p_evt->conn_handle == p_db_discovery->conn_handle) &&
+                (p_evt->params.conn_sec_succeeded.procedure == PM_CONN_SEC_PROCEDURE_BONDING) &&
+                (p_db_discovery->cache_state == BLE_DB_DISCOVERY_CACHE_STORE_PEND))
+            {
+                cache_store(p_db_discovery, p_evt->conn_handle);
+            }
+            break;
+
+        case PM_EVT_PEER_DATA_UPDATE_SUCCEEDED:
+            if (m_cache_store_busy &&
+                (p_evt->params.peer_data_update_succeeded.data_id == DB_CACHE_PEER_DATA_ID) &&
+                (p_evt->params.peer_data_update_succeeded.token == m_cache_store_token))
+            {
+                m_cache_store_busy = false;
+            }
+            break;
+
+        case PM_EVT_PEER_DATA_UPDATE_FAILED:
+            if (m_cache_store_busy &&
+                (p_evt->params.peer_data_update_failed.data_id == DB_CACHE_PEER_DATA_ID) &&
+                (p_evt->params.peer_data_update_failed.token == m_cache_store_token))
+            {
+                NRF_LOG_WARNING("Failed to store discovered services, error 0x%x.",
+                                p_evt->params.peer_data_update_failed.error);
+                m_cache_store_busy = false;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    // A store that waited for the previous write can start now.
+    if (!m_cache_store_busy &&
+        (p_db_discovery->cache_state == BLE_DB_DISCOVERY_CACHE_STORE_PEND) &&
+        (p_db_discovery->conn_handle != BLE_CONN_HANDLE_INVALID))
+    {
+        cache_store(p_db_discovery, p_db_discovery->conn_handle);
+    }
+}
+
+
+uint32_t ble_db_discovery_cache_clear(uint16_t conn_handle)
+{
+    ret_code_t   err_code;
+    pm_peer_id_t peer_id;
+
+    err_code = pm_peer_id_get(conn_handle, &peer_id);
+    VERIFY_SUCCESS(err_code);
+
+    if (peer_id == PM_PEER_ID_INVALID)
+    {
+        return NRF_ERROR_NOT_FOUND;
+    }
+
+    return pm_peer_data_delete(peer_id, DB_CACHE_PEER_DATA_ID);
+}
+#endif // BLE_DB_DISCOVERY_CACHE_ENABLED
+
+
 uint32_t ble_db_discovery_start(ble_db_discovery_t * const p_db_discovery, uint16_t conn_handle)
 {
     VERIFY_PARAM_NOT_NULL(p_db_discovery);
@@ -976,7 +1377,11 @@ uint32_t ble_db_discovery_start(ble_db_discovery_t * const p_db_discovery, uint1
         return NRF_ERROR_BUSY;
     }
 
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+    return cache_discovery_start(p_db_discovery, conn_handle);
+#else
     return discovery_start(p_db_discovery, conn_handle);
+#endif
 }
 
 
@@ -992,6 +1397,9 @@ static void on_disconnected(ble_db_discovery_t       * p_db_discovery,
     {
         p_db_discovery->discovery_in_progress = false;
         p_db_discovery->conn_handle           = BLE_CONN_HANDLE_INVALID;
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+        p_db_discovery->cache_state           = BLE_DB_DISCOVERY_CACHE_IDLE;
+#endif
     }
 }
 
@@ -1023,6 +1431,12 @@ void ble_db_discovery_on_ble_evt(ble_evt_t const * p_ble_evt,
             on_disconnected(p_db_discovery, &(p_ble_evt->evt.gap_evt));
             break;
 
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+        case BLE_GATTC_EVT_CHAR_VAL_BY_UUID_READ_RSP:
+            on_db_hash_read_rsp(p_db_discovery, &(p_ble_evt->evt.gattc_evt));
+            break;
+#endif
+
         default:
             break;
     }
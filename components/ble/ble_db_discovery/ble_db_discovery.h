@@ -64,6 +64,14 @@
  * @note The application must propagate BLE stack events to this module by calling
  *       ble_db_discovery_on_ble_evt().
  *
+ * @note If @ref BLE_DB_DISCOVERY_CACHE_ENABLED is set, the discovered services of bonded peers are
+ *       stored through the Peer Manager as application data (@ref PM_PEER_DATA_ID_APPLICATION),
+ *       together with the Database Hash of the peer. The application must then not store its own
+ *       data under that ID. When discovery is started again for the same peer, the stored
+ *       services are reported immediately instead of being discovered over the air. The
+ *       application must then also propagate Peer Manager events to this module by calling
+ *       ble_db_discovery_on_pm_evt().
+ *
  */
 
 #ifndef BLE_DB_DISCOVERY_H__
@@ -76,6 +84,10 @@
 #include "ble_gattc.h"
 #include "ble_gatt_db.h"
 #include "nrf_ble_gq.h"
+#include "sdk_config.h"
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+#include "peer_manager_types.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -124,6 +136,7 @@ NRF_SDH_BLE_OBSERVERS(_name ## _obs,
 #endif //!(defined(__LINT__))
 
 #define BLE_DB_DISCOVERY_MAX_SRV        6   /**< Maximum number of services supported by this module. This also indicates the maximum number of users allowed to be registered to this module (one user per service). */
+#define BLE_DB_DISCOVERY_DB_HASH_LEN    16  /**< Length of the Database Hash characteristic value. */
 
 
 /**@brief DB Discovery event type. */
@@ -158,6 +171,26 @@ typedef struct
     ble_db_discovery_evt_handler_t evt_handler;  /**< Event handler which should be called to raise this event. */
 } ble_db_discovery_user_evt_t;
 
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+/**@brief Discovery cache state of a connection. */
+typedef enum
+{
+    BLE_DB_DISCOVERY_CACHE_IDLE,       /**< No cache operation is ongoing. */
+    BLE_DB_DISCOVERY_CACHE_VERIFYING,  /**< Services were loaded from the cache, and the Database Hash of the peer is being read to verify them. They are reported only if the hash has not changed. */
+    BLE_DB_DISCOVERY_CACHE_HASH_READ,  /**< Services were discovered, and the Database Hash of the peer is being read before the services are stored. */
+    BLE_DB_DISCOVERY_CACHE_STORE_PEND, /**< Services were discovered before the peer was bonded, or while another store was ongoing. They are stored when bonding or the other store completes. */
+} ble_db_discovery_cache_state_t;
+
+/**@brief Discovered services of a peer, as stored by the Peer Manager. */
+typedef struct
+{
+    ble_gatt_db_srv_t services[BLE_DB_DISCOVERY_MAX_SRV];    /**< Services in the order in which they were registered. A service that was not found at the peer has an empty handle range. */
+    uint8_t           db_hash[BLE_DB_DISCOVERY_DB_HASH_LEN]; /**< Database Hash of the peer when the services were discovered. */
+    uint16_t          srv_count;                             /**< Number of registered services when the services were discovered. */
+    uint16_t          db_hash_valid;                         /**< Set to 1 if @p db_hash was read from the peer. */
+} ble_db_discovery_cache_t;
+#endif // BLE_DB_DISCOVERY_CACHE_ENABLED
+
 /**@brief Structure for holding the information related to the GATT database at the server.
  *
  * @details This module identifies a remote database. Use one instance of this structure per
@@ -176,6 +209,10 @@ typedef struct
     uint16_t                    conn_handle;                                /**< Connection handle on which the discovery is started. */
     uint32_t                    pending_usr_evt_index;                      /**< The index to the pending user event array, pointing to the last added pending user event. */
     ble_db_discovery_user_evt_t pending_usr_evts[BLE_DB_DISCOVERY_MAX_SRV]; /**< Whenever a discovery related event is to be raised to a user module, it is stored in this array first. When all expected services have been discovered, all pending events are sent to the corresponding user modules. */
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+    ble_db_discovery_cache_state_t cache_state;                             /**< Cache operation ongoing on the connection. */
+    __ALIGN(4) ble_db_discovery_cache_t cache;                              /**< Cache of the connected peer. It is copied before it is written to flash. Must be the last member. */
+#endif
 } ble_db_discovery_t;
 
 /**@brief DB discovery module initialization struct. */
@@ -246,6 +283,12 @@ uint32_t ble_db_discovery_evt_register(const ble_uuid_t * const p_uuid);
  * @retval NRF_ERROR_BUSY          If a discovery is already in progress using
  *                                 @p p_db_discovery. Use a different @ref ble_db_discovery_t
  *                                 structure, or wait for a DB Discovery event before retrying.
+ *
+ * @note If @ref BLE_DB_DISCOVERY_CACHE_ENABLED is set and services of the peer are stored, the
+ *       discovery events are raised from the stored services. If the stored services carry a
+ *       Database Hash and @ref BLE_DB_DISCOVERY_CACHE_VERIFY is set, the hash of the peer is read
+ *       first, and a full discovery is performed if it has changed or cannot be read. Otherwise,
+ *       the events are raised before this function returns.
  * @return                         This API propagates the error code returned by functions:
  *                                 @ref nrf_ble_gq_conn_handle_register and @ref nrf_ble_gq_item_add.
  */
@@ -253,6 +296,41 @@ uint32_t ble_db_discovery_start(ble_db_discovery_t * p_db_discovery,
                                 uint16_t             conn_handle);
 
 
+#if BLE_DB_DISCOVERY_CACHE_ENABLED
+/**@brief Function for deleting the stored services of the peer on a connection.
+ *
+ * @details Call this function when the services of the peer are known to have changed, for
+ *          example when the peer sends a Service Changed indication. The next call to
+ *          @ref ble_db_discovery_start for the peer then performs a full discovery. Peers that
+ *          expose the Database Hash characteristic are verified automatically if
+ *          @ref BLE_DB_DISCOVERY_CACHE_VERIFY is set.
+ *
+ * @param[in] conn_handle Handle of the connection to the peer.
+ *
+ * @retval NRF_SUCCESS         If the stored services are scheduled to be deleted.
+ * @retval NRF_ERROR_NOT_FOUND If the peer on the connection is not bonded.
+ * @return                     This API propagates the error code returned by
+ *                             @ref pm_peer_data_delete.
+ */
+uint32_t ble_db_discovery_cache_clear(uint16_t conn_handle);
+
+
+/**@brief Function for handling Peer Manager events.
+ *
+ * @details Services discovered before the peer was bonded are stored when the Peer Manager
+ *          reports the bond, because only then is the peer ID of the connection known. Services
+ *          are stored one peer at a time; the completion of a store lets the next one start.
+ *
+ * @note Call this function from the Peer Manager event handler of the application, for every
+ *       @ref ble_db_discovery_t instance.
+ *
+ * @param[in,out] p_db_discovery Pointer to the DB Discovery structure.
+ * @param[in]     p_evt          Peer Manager event.
+ */
+void ble_db_discovery_on_pm_evt(ble_db_discovery_t * p_db_discovery, pm_evt_t const * p_evt);
+#endif // BLE_DB_DISCOVERY_CACHE_ENABLED
+
+
 /**@brief Function for handling the Application's BLE Stack events.
  *
  * @param[in]     p_ble_evt Pointer to the BLE event received.
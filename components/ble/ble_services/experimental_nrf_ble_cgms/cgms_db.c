@@ -39,105 +39,772 @@
  */
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
+#include "sdk_common.h"
+#include "app_util_platform.h"
+#include "nrf_fstorage.h"
+#include "nrf_fstorage_sd.h"
 #include "cgms_db.h"
 
+#define CGMS_DB_PAGE_SIZE       4096                                 // !< Size of a flash page (in bytes).
+#define CGMS_DB_PAGE_MAGIC      0xC6DB0001                           // !< Marks a page that belongs to the record ring.
+#define CGMS_DB_PAGE_HDR_WORDS  2                                    // !< Page header: magic and page sequence number.
+#define CGMS_DB_REC_WORDS       3                                    // !< Size of a record in flash (in words).
+#define CGMS_DB_REC_SIZE        (CGMS_DB_REC_WORDS * sizeof(uint32_t))
+#define CGMS_DB_RECS_PER_PAGE   ((CGMS_DB_PAGE_SIZE - CGMS_DB_PAGE_HDR_WORDS * sizeof(uint32_t)) \
+                                 / CGMS_DB_REC_SIZE)                 // !< Number of records in a page.
+
+STATIC_ASSERT(NRF_BLE_CGMS_DB_FLASH_PAGES >= 2);
+STATIC_ASSERT(NRF_BLE_CGMS_DB_FLASH_PAGES * CGMS_DB_RECS_PER_PAGE <= UINT16_MAX);
+STATIC_ASSERT(NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE < CGMS_DB_RECS_PER_PAGE);
+
+#if NRF_MODULE_ENABLED(FDS)
+// The ring takes the pages directly below the bootloader, which FDS only leaves alone if they are reserved.
+STATIC_ASSERT(FDS_VIRTUAL_PAGES_RESERVED >= NRF_BLE_CGMS_DB_FLASH_PAGES);
+#endif
+
+/**@brief RAM index entry of a flash page in the record ring. */
 typedef struct
 {
-    bool           in_use_flag;
-    ble_cgms_rec_t record;
-} database_entry_t;
+    uint32_t first_rec;         // !< Sequential number of the first record in the page.
+    uint16_t first_time_offset; // !< Time offset of the first record in the page.
+    uint16_t rec_count;         // !< Number of records written to the page.
+} page_index_t;
+
+
+static void fs_evt_handler(nrf_fstorage_evt_t * p_evt);
+
+NRF_FSTORAGE_DEF(nrf_fstorage_t m_fs) =
+{
+    // The flash area boundaries are set in cgms_db_init().
+    .evt_handler = fs_evt_handler,
+};
+
+static page_index_t m_page_index[NRF_BLE_CGMS_DB_FLASH_PAGES]; // !< Index of the pages, by position in the ring.
+static uint16_t     m_oldest_page;                             // !< Position of the oldest page in use.
+static uint16_t     m_page_count;                              // !< Number of pages in use.
+static uint32_t     m_next_page_seq;                           // !< Sequence number of the next page to open.
+static uint32_t     m_page_hdr[CGMS_DB_PAGE_HDR_WORDS];        // !< Header of the page being opened.
+
+static uint32_t     m_oldest_rec;                              // !< Sequential number of the oldest record.
+static uint16_t     m_num_records;                             // !< Number of records in the database.
+static uint16_t     m_last_time_offset;                        // !< Time offset of the newest record.
+static bool         m_last_page_sealed;                        // !< No more records are written to the newest page.
+
+/**@brief Records queued for writing. Flash writes complete asynchronously, so the records are
+ *        kept here and read from RAM until the write is done. */
+static uint32_t     m_write_queue[NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE][CGMS_DB_REC_WORDS];
+static uint32_t     m_write_first_rec;                         // !< Sequential number of the oldest queued record.
+static uint8_t      m_write_rd_idx;                            // !< Index of the oldest queued record.
+static uint8_t      m_write_count;                             // !< Number of queued records.
+static bool         m_write_failed;                            // !< A record write failed, the rest of the queue is discarded.
+static uint32_t     m_write_failed_rec;                        // !< Sequential number of the first record that failed.
 
-static database_entry_t m_database[CGMS_DB_MAX_RECORDS];
-static uint8_t          m_database_crossref[CGMS_DB_MAX_RECORDS];
-static uint16_t         m_num_records;
+static ble_srv_error_handler_t m_error_handler;                // !< Function to be called when a record write fails.
 
 
-ret_code_t cgms_db_init(void)
+/**@brief Function for getting the ring position of the n-th page in use. */
+static uint16_t page_pos_get(uint16_t n)
 {
-    int i;
+    return (m_oldest_page + n) % NRF_BLE_CGMS_DB_FLASH_PAGES;
+}
+
+
+/**@brief Function for getting the flash address of a page. */
+static uint32_t page_addr_get(uint16_t pos)
+{
+    return m_fs.start_addr + (pos * CGMS_DB_PAGE_SIZE);
+}
+
+
+/**@brief Function for getting the flash address of a record slot within a page. */
+static uint32_t rec_addr_get(uint16_t pos, uint16_t slot)
+{
+    return page_addr_get(pos)
+           + (CGMS_DB_PAGE_HDR_WORDS * sizeof(uint32_t))
+           + (slot * CGMS_DB_REC_SIZE);
+}
 
-    for (i = 0; i < CGMS_DB_MAX_RECORDS; i++)
+
+static void rec_encode(ble_cgms_rec_t const * p_rec, uint32_t * p_words)
+{
+    nrf_ble_cgms_meas_t const * p_meas = &p_rec->meas;
+
+    p_words[0] = p_meas->time_offset | ((uint32_t)p_meas->glucose_concentration << 16);
+    p_words[1] = p_meas->trend | ((uint32_t)p_meas->quality << 16);
+    p_words[2] = p_meas->flags
+                 | ((uint32_t)p_meas->sensor_status_annunciation.warning    << 8)
+                 | ((uint32_t)p_meas->sensor_status_annunciation.calib_temp << 16)
+                 | ((uint32_t)p_meas->sensor_status_annunciation.status     << 24);
+}
+
+
+static void rec_decode(uint32_t const * p_words, ble_cgms_rec_t * p_rec)
+{
+    nrf_ble_cgms_meas_t * p_meas = &p_rec->meas;
+
+    p_meas->time_offset                           = (uint16_t)p_words[0];
+    p_meas->glucose_concentration                 = (uint16_t)(p_words[0] >> 16);
+    p_meas->trend                                 = (uint16_t)p_words[1];
+    p_meas->quality                               = (uint16_t)(p_words[1] >> 16);
+    p_meas->flags                                 = (uint8_t)p_words[2];
+    p_meas->sensor_status_annunciation.warning    = (uint8_t)(p_words[2] >> 8);
+    p_meas->sensor_status_annunciation.calib_temp = (uint8_t)(p_words[2] >> 16);
+    p_meas->sensor_status_annunciation.status     = (uint8_t)(p_words[2] >> 24);
+}
+
+
+/**@brief Function for checking if the record slot was never written (erased flash). */
+static bool rec_is_empty(uint32_t const * p_words)
+{
+    return (p_words[0] & p_words[1] & p_words[2]) == 0xFFFFFFFF;
+}
+
+
+/**@brief Function for finding the page that holds a record.
+ *
+ * @param[in] rec Sequential number of the record.
+ *
+ * @return Index of the page in use (0 is the oldest page).
+ */
+static uint16_t page_find(uint32_t rec)
+{
+    uint16_t lo = 0;
+    uint16_t hi = m_page_count;
+
+    // Last page with first_rec <= rec.
+    while (hi - lo > 1)
     {
-        m_database[i].in_use_flag = false;
-        m_database_crossref[i]    = 0xFF;
+        uint16_t mid = (lo + hi) / 2;
+
+        if (m_page_index[page_pos_get(mid)].first_rec <= rec)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid;
+        }
     }
 
-    m_num_records = 0;
+    return lo;
+}
 
-    return NRF_SUCCESS;
+
+/**@brief Function for reading a record, either from flash or from the write queue.
+ *
+ * @param[in]  pos     Ring position of the page that holds the record.
+ * @param[in]  rec     Sequential number of the record.
+ * @param[out] p_words Encoded record.
+ */
+static ret_code_t rec_read(uint16_t pos, uint32_t rec, uint32_t * p_words)
+{
+    bool queued;
+
+    CRITICAL_REGION_ENTER();
+    queued = (rec >= m_write_first_rec) && (rec - m_write_first_rec < m_write_count);
+    if (queued)
+    {
+        uint8_t idx = (m_write_rd_idx + (rec - m_write_first_rec))
+                      % NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE;
+        memcpy(p_words, m_write_queue[idx], CGMS_DB_REC_SIZE);
+    }
+    CRITICAL_REGION_EXIT();
+
+    if (queued)
+    {
+        return NRF_SUCCESS;
+    }
+
+    return nrf_fstorage_read(&m_fs,
+                             rec_addr_get(pos, rec - m_page_index[pos].first_rec),
+                             p_words,
+                             CGMS_DB_REC_SIZE);
 }
 
 
-uint16_t cgms_db_num_records_get(void)
+/**@brief Function for reading the time offset of a record slot. */
+static uint16_t rec_time_offset_get(uint16_t pos, uint16_t slot)
 {
-    return m_num_records;
+    uint32_t words[CGMS_DB_REC_WORDS];
+
+    if (rec_read(pos, m_page_index[pos].first_rec + slot, words) != NRF_SUCCESS)
+    {
+        return UINT16_MAX;
+    }
+    return (uint16_t)words[0];
+}
+
+
+/**@brief Function for checking the search predicate of @ref bound_get. */
+static bool time_offset_before(uint16_t rec_time_offset, uint16_t time_offset, bool upper)
+{
+    return upper ? (rec_time_offset <= time_offset) : (rec_time_offset < time_offset);
 }
 
 
-ret_code_t cgms_db_record_get(uint8_t record_num, ble_cgms_rec_t * p_rec)
+/**@brief Function for finding the first record that is not before a time offset.
+ *
+ * @details Records are stored in time order. The page is found with a binary search on the RAM
+ *          index, then the record with a binary search within the page.
+ *
+ * @param[in] time_offset Time offset to search for.
+ * @param[in] upper       If true, records with the same time offset are before it.
+ *
+ * @return Number of records before the time offset.
+ */
+static uint16_t bound_get(uint16_t time_offset, bool upper)
 {
-    if ((record_num >= m_num_records) || (m_num_records == 0))
+    uint16_t lo = 0;
+    uint16_t hi = m_page_count;
+    uint32_t rec;
+
+    // First page with a first record that is not before the time offset.
+    while (lo < hi)
     {
-        return NRF_ERROR_NOT_FOUND;
+        uint16_t mid = (lo + hi) / 2;
+
+        if (time_offset_before(m_page_index[page_pos_get(mid)].first_time_offset,
+                               time_offset,
+                               upper))
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    if (lo == 0)
+    {
+        return 0;
+    }
+
+    // The bound is inside the previous page, past its first record.
+    uint16_t pos = page_pos_get(lo - 1);
+    uint16_t last_slot  = m_page_index[pos].rec_count;
+    uint16_t first_slot = MIN(1, last_slot);
+
+    while (first_slot < last_slot)
+    {
+        uint16_t mid = (first_slot + last_slot) / 2;
+
+        if (time_offset_before(rec_time_offset_get(pos, mid), time_offset, upper))
+        {
+            first_slot = mid + 1;
+        }
+        else
+        {
+            last_slot = mid;
+        }
+    }
+
+    rec = m_page_index[pos].first_rec + first_slot;
+    if (rec < m_oldest_rec)
+    {
+        return 0;
+    }
+    return (uint16_t)(rec - m_oldest_rec);
+}
+
+
+/**@brief Function for removing the oldest page from the ring.
+ *
+ * @details The page is erased when it is opened again.
+ */
+static void oldest_page_drop(void)
+{
+    uint32_t next_rec = m_page_index[m_oldest_page].first_rec
+                        + m_page_index[m_oldest_page].rec_count;
+
+    m_num_records -= (uint16_t)(next_rec - m_oldest_rec);
+    m_oldest_rec   = next_rec;
+    m_oldest_page  = page_pos_get(1);
+    m_page_count--;
+}
+
+
+/**@brief Function for opening a new page at the end of the ring.
+ *
+ * @param[in] first_rec         Sequential number of the first record of the page.
+ * @param[in] first_time_offset Time offset of the first record of the page.
+ */
+static ret_code_t page_open(uint32_t first_rec, uint16_t first_time_offset)
+{
+    ret_code_t err_code;
+    uint16_t   pos;
+
+    // When the ring is full, this is the position of the oldest page.
+    pos = page_pos_get(m_page_count);
+
+    err_code = nrf_fstorage_erase(&m_fs, page_addr_get(pos), 1, NULL);
+    VERIFY_SUCCESS(err_code);
+
+    if (m_page_count == NRF_BLE_CGMS_DB_FLASH_PAGES)
+    {
+        // The ring is full, the oldest records are overwritten. They are dropped only once the
+        // erase is queued, so that they are not found again after a reset if it fails.
+        oldest_page_drop();
     }
-    // copy record to the specified memory
-    *p_rec = m_database[m_database_crossref[record_num]].record;
+
+    m_page_hdr[0] = CGMS_DB_PAGE_MAGIC;
+    m_page_hdr[1] = m_next_page_seq;
+
+    err_code = nrf_fstorage_write(&m_fs, page_addr_get(pos), m_page_hdr, sizeof(m_page_hdr), NULL);
+    VERIFY_SUCCESS(err_code);
+
+    m_page_index[pos].first_rec         = first_rec;
+    m_page_index[pos].first_time_offset = first_time_offset;
+    m_page_index[pos].rec_count         = 0;
+
+    m_next_page_seq++;
+    m_page_count++;
+    m_last_page_sealed = false;
 
     return NRF_SUCCESS;
 }
 
 
-ret_code_t cgms_db_record_add(ble_cgms_rec_t * p_rec)
+/**@brief Function for discarding the records of a failed write and the records queued after it.
+ *
+ * @details The writes of the records queued after the failed ones are still pending. Their queue
+ *          entries are set to the erased value, so that these writes leave the flash unchanged
+ *          and no record follows a gap. The records are removed from the index by
+ *          @ref failed_records_drop once the queue is empty.
+ *
+ * @param[in] count Number of records of the failed write, at the head of the queue.
+ */
+static void write_failed_handle(uint8_t count)
 {
-    int i;
+    for (uint8_t i = count; i < m_write_count; i++)
+    {
+        memset(m_write_queue[(m_write_rd_idx + i) % NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE],
+               0xFF,
+               CGMS_DB_REC_SIZE);
+    }
 
-    if (m_num_records == CGMS_DB_MAX_RECORDS)
+    if (!m_write_failed)
     {
-        return NRF_ERROR_NO_MEM;
+        m_write_failed_rec = m_write_first_rec;
+        m_write_failed     = true;
+    }
+}
+
+
+/**@brief Function for removing the records of a failed write, and all records after them, from
+ *        the database.
+ *
+ * @param[in] first_rec Sequential number of the first record of the failed write.
+ */
+static void failed_records_drop(uint32_t first_rec)
+{
+    uint16_t page;
+    uint16_t pos;
+    uint16_t dropped;
+
+    if ((first_rec < m_oldest_rec) || (first_rec >= m_oldest_rec + m_num_records))
+    {
+        // The records are not in the database anymore.
+        return;
     }
 
-    // find next available database entry
-    for (i = 0; i < CGMS_DB_MAX_RECORDS; i++)
+    // Pages opened after the failed record only hold dropped records. They are reopened with the
+    // same sequence numbers.
+    page    = page_find(first_rec);
+    dropped = m_page_count - 1 - page;
+    m_page_count    -= dropped;
+    m_next_page_seq -= dropped;
+
+    // The failed slot might be partly written, so the page is not used for new records.
+    pos                         = page_pos_get(page);
+    m_page_index[pos].rec_count = (uint16_t)(first_rec - m_page_index[pos].first_rec);
+    m_num_records               = (uint16_t)(first_rec - m_oldest_rec);
+    m_last_page_sealed          = true;
+
+    if (m_num_records > 0)
     {
-        if (!m_database[i].in_use_flag)
+        uint32_t words[CGMS_DB_REC_WORDS];
+        uint32_t rec = first_rec - 1;
+
+        if (rec_read(page_pos_get(page_find(rec)), rec, words) == NRF_SUCCESS)
         {
-            m_database[i].in_use_flag = true;
-            m_database[i].record      = *p_rec;
+            m_last_time_offset = (uint16_t)words[0];
+        }
+    }
+    if (m_page_index[pos].rec_count == 0)
+    {
+        // Keep the page index in time order for bound_get().
+        m_page_index[pos].first_time_offset = (m_num_records > 0) ? m_last_time_offset : 0;
+    }
+}
 
-            m_database_crossref[m_num_records] = i;
-            m_num_records++;
 
-            return NRF_SUCCESS;
+static void fs_evt_handler(nrf_fstorage_evt_t * p_evt)
+{
+    if ((p_evt->id == NRF_FSTORAGE_EVT_WRITE_RESULT) && (p_evt->p_param == m_write_queue))
+    {
+        // Record writes complete in order. One write can hold several records.
+        uint8_t count = p_evt->len / CGMS_DB_REC_SIZE;
+
+        ASSERT(m_write_count >= count);
+        if (p_evt->result != NRF_SUCCESS)
+        {
+            write_failed_handle(count);
+            if (m_error_handler != NULL)
+            {
+                m_error_handler(p_evt->result);
+            }
         }
+        m_write_rd_idx = (m_write_rd_idx + count) % NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE;
+        m_write_first_rec += count;
+        m_write_count     -= count;
     }
+}
+
 
-    return NRF_ERROR_NO_MEM;
+/**@brief Function for counting the records written to a page.
+ *
+ * @details Records are written one after another, so the first empty slot is found with a binary
+ *          search.
+ */
+static uint16_t page_rec_count_get(uint16_t pos)
+{
+    uint16_t lo = 0;
+    uint16_t hi = CGMS_DB_RECS_PER_PAGE;
+
+    while (lo < hi)
+    {
+        uint16_t mid = (lo + hi) / 2;
+        uint32_t words[CGMS_DB_REC_WORDS];
+
+        if ((nrf_fstorage_read(&m_fs, rec_addr_get(pos, mid), words, sizeof(words)) == NRF_SUCCESS)
+            && !rec_is_empty(words))
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+
+/**@brief Function for reading the header of a page.
+ *
+ * @param[in]  pos   Ring position of the page.
+ * @param[out] p_seq Page sequence number.
+ *
+ * @retval true  The page belongs to the record ring.
+ * @retval false The page is not used.
+ */
+static bool page_hdr_read(uint16_t pos, uint32_t * p_seq)
+{
+    uint32_t hdr[CGMS_DB_PAGE_HDR_WORDS];
+
+    if (nrf_fstorage_read(&m_fs, page_addr_get(pos), hdr, sizeof(hdr)) != NRF_SUCCESS)
+    {
+        return false;
+    }
+    *p_seq = hdr[1];
+
+    return (hdr[0] == CGMS_DB_PAGE_MAGIC);
+}
+
+
+/**@brief Function for rebuilding the RAM index from the pages in flash. */
+static void index_rebuild(void)
+{
+    uint16_t newest_pos = 0;
+    uint32_t newest_seq = 0;
+    bool     found      = false;
+    uint32_t rec        = 0;
+    uint16_t last_time_offset = 0;
+
+    m_oldest_page   = 0;
+    m_page_count    = 0;
+    m_next_page_seq = 0;
+    m_oldest_rec    = 0;
+    m_num_records   = 0;
+
+    for (uint16_t pos = 0; pos < NRF_BLE_CGMS_DB_FLASH_PAGES; pos++)
+    {
+        uint32_t seq;
+
+        if (page_hdr_read(pos, &seq) && (!found || (seq > newest_seq)))
+        {
+            found      = true;
+            newest_pos = pos;
+            newest_seq = seq;
+        }
+    }
+
+    if (!found)
+    {
+        return;
+    }
+
+    // Walk back from the newest page while the pages have consecutive sequence numbers.
+    m_oldest_page = newest_pos;
+    m_page_count  = 1;
+    while (m_page_count < NRF_BLE_CGMS_DB_FLASH_PAGES)
+    {
+        uint16_t pos = (m_oldest_page + NRF_BLE_CGMS_DB_FLASH_PAGES - 1)
+                       % NRF_BLE_CGMS_DB_FLASH_PAGES;
+        uint32_t seq;
+
+        if (!page_hdr_read(pos, &seq) || (seq != newest_seq - m_page_count))
+        {
+            break;
+        }
+        m_oldest_page = pos;
+        m_page_count++;
+    }
+
+    for (uint16_t i = 0; i < m_page_count; i++)
+    {
+        uint16_t pos = page_pos_get(i);
+
+        m_page_index[pos].first_rec = rec;
+        m_page_index[pos].rec_count = page_rec_count_get(pos);
+
+        // An empty page takes the time offset of the record before it, to keep the index in time
+        // order.
+        if (m_page_index[pos].rec_count > 0)
+        {
+            m_page_index[pos].first_time_offset = rec_time_offset_get(pos, 0);
+            last_time_offset = rec_time_offset_get(pos, m_page_index[pos].rec_count - 1);
+        }
+        else
+        {
+            m_page_index[pos].first_time_offset = last_time_offset;
+        }
+
+        rec += m_page_index[pos].rec_count;
+    }
+
+    m_num_records   = (uint16_t)rec;
+    m_next_page_seq = newest_seq + 1;
+
+    if (m_num_records > 0)
+    {
+        ble_cgms_rec_t last_rec;
+
+        if (cgms_db_record_get(m_num_records - 1, &last_rec) == NRF_SUCCESS)
+        {
+            m_last_time_offset = last_rec.meas.time_offset;
+        }
+    }
+}
+
+
+ret_code_t cgms_db_init(ble_srv_error_handler_t error_handler)
+{
+    ret_code_t err_code;
+    uint32_t   end_addr = BOOTLOADER_ADDRESS;
+
+    if (end_addr == 0xFFFFFFFF)
+    {
+        end_addr = NRF_FICR->CODESIZE * NRF_FICR->CODEPAGESIZE;
+    }
+
+    m_fs.end_addr   = end_addr;
+    m_fs.start_addr = end_addr - (NRF_BLE_CGMS_DB_FLASH_PAGES * CGMS_DB_PAGE_SIZE);
+
+    err_code = nrf_fstorage_init(&m_fs, &nrf_fstorage_sd, NULL);
+    VERIFY_SUCCESS(err_code);
+
+    m_write_rd_idx     = 0;
+    m_write_count      = 0;
+    m_write_failed     = false;
+    m_last_page_sealed = false;
+    m_error_handler    = error_handler;
+
+    index_rebuild();
+
+    m_write_first_rec = m_oldest_rec + m_num_records;
+
+    return NRF_SUCCESS;
 }
 
 
-ret_code_t cgms_db_record_delete(uint8_t record_num)
+uint16_t cgms_db_num_records_get(void)
 {
-    int i;
+    return m_num_records;
+}
+
+
+ret_code_t cgms_db_record_get(uint16_t record_num, ble_cgms_rec_t * p_rec)
+{
+    ret_code_t err_code;
+    uint32_t   words[CGMS_DB_REC_WORDS];
+    uint32_t   rec;
 
     if (record_num >= m_num_records)
     {
-        // Deleting a non-existent record is not an error
-        return NRF_SUCCESS;
+        return NRF_ERROR_NOT_FOUND;
+    }
+
+    rec      = m_oldest_rec + record_num;
+    err_code = rec_read(page_pos_get(page_find(rec)), rec, words);
+    VERIFY_SUCCESS(err_code);
+
+    rec_decode(words, p_rec);
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t cgms_db_record_add(ble_cgms_rec_t * p_rec)
+{
+    return cgms_db_records_add(p_rec, 1);
+}
+
+
+ret_code_t cgms_db_records_add(ble_cgms_rec_t const * p_recs, uint16_t count)
+{
+    ret_code_t err_code;
+    uint32_t   words[CGMS_DB_REC_WORDS];
+    uint16_t   last_time_offset;
+    uint16_t   i;
+
+    if (m_write_failed)
+    {
+        if (m_write_count > 0)
+        {
+            // The writes discarded after a failure are still pending.
+            return NRF_ERROR_BUSY;
+        }
+        failed_records_drop(m_write_failed_rec);
+        m_write_failed = false;
+    }
+
+    if (count > NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE)
+    {
+        return NRF_ERROR_NO_MEM;
     }
 
-    // free entry
-    m_database[m_database_crossref[record_num]].in_use_flag = false;
+    // Check the whole batch first, so that it is either added completely or not at all.
+    last_time_offset = m_last_time_offset;
+    for (i = 0; i < count; i++)
+    {
+        rec_encode(&p_recs[i], words);
+        if (rec_is_empty(words))
+        {
+            // Cannot be told apart from erased flash.
+            return NRF_ERROR_INVALID_PARAM;
+        }
+
+        if (((m_num_records > 0) || (i > 0)) && (p_recs[i].meas.time_offset < last_time_offset))
+        {
+            // Records are kept in time order.
+            return NRF_ERROR_INVALID_PARAM;
+        }
+        last_time_offset = p_recs[i].meas.time_offset;
+    }
 
-    // decrease number of records
-    m_num_records--;
+    if (count > NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE - m_write_count)
+    {
+        return NRF_ERROR_BUSY;
+    }
 
-    // remove cross reference index
-    for (i = record_num; i < m_num_records; i++)
+    i = 0;
+    while (i < count)
     {
-        m_database_crossref[i] = m_database_crossref[i + 1];
+        uint32_t rec = m_oldest_rec + m_num_records;
+        uint16_t pos;
+        uint8_t  idx;
+        uint16_t seg;
+        uint16_t j;
+
+        if ((m_page_count == 0) ||
+            m_last_page_sealed ||
+            (m_page_index[page_pos_get(m_page_count - 1)].rec_count == CGMS_DB_RECS_PER_PAGE))
+        {
+            err_code = page_open(rec, p_recs[i].meas.time_offset);
+            VERIFY_SUCCESS(err_code);
+        }
+        pos = page_pos_get(m_page_count - 1);
+        if (m_page_index[pos].rec_count == 0)
+        {
+            m_page_index[pos].first_time_offset = p_recs[i].meas.time_offset;
+        }
+
+        // Records that go to the same page and to consecutive queue entries are written at once.
+        idx = (m_write_rd_idx + m_write_count) % NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE;
+        seg = MIN(count - i, CGMS_DB_RECS_PER_PAGE - m_page_index[pos].rec_count);
+        seg = MIN(seg, NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE - idx);
+
+        for (j = 0; j < seg; j++)
+        {
+            rec_encode(&p_recs[i + j], m_write_queue[idx + j]);
+        }
+
+        CRITICAL_REGION_ENTER();
+        if (m_write_count == 0)
+        {
+            m_write_first_rec = rec;
+        }
+        m_write_count += seg;
+        CRITICAL_REGION_EXIT();
+
+        err_code = nrf_fstorage_write(&m_fs,
+                                      rec_addr_get(pos, m_page_index[pos].rec_count),
+                                      m_write_queue[idx],
+                                      seg * CGMS_DB_REC_SIZE,
+                                      m_write_queue);
+        if (err_code != NRF_SUCCESS)
+        {
+            CRITICAL_REGION_ENTER();
+            m_write_count -= seg;
+            CRITICAL_REGION_EXIT();
+            return err_code;
+        }
+
+        m_page_index[pos].rec_count += seg;
+        m_num_records               += seg;
+        m_last_time_offset           = p_recs[i + seg - 1].meas.time_offset;
+        i                           += seg;
     }
 
     return NRF_SUCCESS;
 }
 
 
+ret_code_t cgms_db_clear(void)
+{
+    ret_code_t err_code;
+
+    err_code = nrf_fstorage_erase(&m_fs, m_fs.start_addr, NRF_BLE_CGMS_DB_FLASH_PAGES, NULL);
+    VERIFY_SUCCESS(err_code);
+
+    // Records still in the write queue are written before the erase. They keep their sequential
+    // numbers, so the records added next follow them in the queue.
+    m_oldest_rec      += m_num_records;
+    m_num_records      = 0;
+    m_oldest_page      = 0;
+    m_page_count       = 0;
+    m_last_time_offset = 0;
+    m_last_page_sealed = false;
+
+    // Skip a full ring of sequence numbers, so that pages left over by an interrupted erase do
+    // not continue the sequence of the new pages.
+    m_next_page_seq += NRF_BLE_CGMS_DB_FLASH_PAGES;
+
+    return NRF_SUCCESS;
+}
+
+
+uint16_t cgms_db_lower_bound_get(uint16_t time_offset)
+{
+    return bound_get(time_offset, false);
+}
+
+
+uint16_t cgms_db_upper_bound_get(uint16_t time_offset)
+{
+    return bound_get(time_offset, true);
+}
@@ -50,11 +50,20 @@
  *          Replace this module if this implementation does not suit
  *          your application. Any replacement implementation should follow the API below to ensure
  *          that the qualification of the @ref ble_cgms is not compromised.
+ *
+ *          Records are appended in time order to a ring of @ref NRF_BLE_CGMS_DB_FLASH_PAGES flash
+ *          pages, placed directly below the bootloader (or at the end of the flash). Reserve
+ *          these pages for FDS with FDS_VIRTUAL_PAGES_RESERVED. When the ring is full, the page
+ *          with the oldest records is erased and reused. A RAM index holds the first record and
+ *          the first time offset of each page, so records and time offset bounds are found with
+ *          binary searches. Apart from that, records are only removed all at once, with
+ *          @ref cgms_db_clear.
  */
 
 #ifndef BLE_CGMS_DB_H__
 #define BLE_CGMS_DB_H__
 
+#include "sdk_config.h"
 #include "sdk_errors.h"
 #include "nrf_ble_cgms.h"
 
@@ -62,14 +71,18 @@
 extern "C" {
 #endif
 
-#define CGMS_DB_MAX_RECORDS 100 // !< Number of records that can be stored in the database.
-
-
 /**@brief Function for initializing the glucose record database.
+ *
+ * @details Rebuilds the RAM index from the records stored in flash.
+ *
+ * @param[in] error_handler Function to be called when a record cannot be written to flash.
+ *                          The record and all records added after it are removed from the
+ *                          database. Can be NULL.
  *
  * @retval NRF_SUCCESS If the database was successfully initialized.
+ * @return             Errors from @ref nrf_fstorage_init are propagated.
  */
-ret_code_t cgms_db_init(void);
+ret_code_t cgms_db_init(ble_srv_error_handler_t error_handler);
 
 
 /**@brief Function for getting the number of records in the database.
@@ -84,29 +97,85 @@ uint16_t cgms_db_num_records_get(void);
  * @param[in]  record_num Index of the record to retrieve.
  * @param[out] p_rec      Pointer to the record structure to which the retrieved record is copied.
  *
- * @retval NRF_SUCCESS If the record was successfully retrieved.
+ * @retval NRF_SUCCESS         If the record was successfully retrieved.
+ * @retval NRF_ERROR_NOT_FOUND If the record does not exist.
  */
-ret_code_t cgms_db_record_get(uint8_t record_num, ble_cgms_rec_t * p_rec);
+ret_code_t cgms_db_record_get(uint16_t record_num, ble_cgms_rec_t * p_rec);
 
 
 /**@brief Function for adding a record at the end of the database.
+ *
+ * @details The record is written to flash asynchronously. Until the write is complete,
+ *          the record is kept in a RAM queue of @ref NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE records.
  *
  * @param[in] p_rec  Pointer to the record to add to the database.
  *
- * @retval NRF_SUCCESS If the record was successfully added to the database.
+ * @retval NRF_SUCCESS             If the record was successfully added to the database.
+ * @retval NRF_ERROR_INVALID_PARAM If the time offset is lower than the time offset of the last
+ *                                 record, or all fields of the record are set to 0xFF.
+ * @retval NRF_ERROR_BUSY          If the write queue is full, or if writes discarded after a
+ *                                 failed write are still pending.
+ * @return                         Errors from @ref nrf_fstorage_write and
+ *                                 @ref nrf_fstorage_erase are propagated.
  */
 ret_code_t cgms_db_record_add(ble_cgms_rec_t * p_rec);
 
 
-/**@brief Function for deleting a database entry.
+/**@brief Function for adding several records at the end of the database.
+ *
+ * @details Records that fit in the same flash page are written with a single flash operation.
+ *          The records are checked before anything is written, so an invalid or too large
+ *          batch leaves the database unchanged. If a flash operation cannot be queued, the
+ *          records added before it stay in the database.
+ *
+ * @param[in] p_recs Records to add, in time order.
+ * @param[in] count  Number of records to add.
+ *
+ * @retval NRF_SUCCESS             If the records were successfully added to the database.
+ * @retval NRF_ERROR_INVALID_PARAM If the records are not in time order, start before the last
+ *                                 record, or one of them has all fields set to 0xFF.
+ * @retval NRF_ERROR_NO_MEM        If @p count is larger than
+ *                                 @ref NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE.
+ * @retval NRF_ERROR_BUSY          If the write queue does not have room for @p count records,
+ *                                 or if writes discarded after a failed write are still pending.
+ * @return                         Errors from @ref nrf_fstorage_write and
+ *                                 @ref nrf_fstorage_erase are propagated.
+ */
+ret_code_t cgms_db_records_add(ble_cgms_rec_t const * p_recs, uint16_t count);
+
+
+/**@brief Function for deleting all records from the database.
+ *
+ * @details All pages of the ring are erased. Records still waiting in the write queue are written
+ *          before the erase. The next record added can have any time offset.
+ *
+ * @retval NRF_SUCCESS If the erase was queued and the database is empty.
+ * @return             Errors from @ref nrf_fstorage_erase are propagated.
+ */
+ret_code_t cgms_db_clear(void);
+
+
+/**@brief Function for getting the index of the first record with a time offset greater than or
+ *        equal to the given one.
+ *
+ * @param[in] time_offset Time offset to search for.
+ *
+ * @return Index of the record, or the number of records if there is no such record.
+ */
+uint16_t cgms_db_lower_bound_get(uint16_t time_offset);
+
+
+/**@brief Function for getting the index of the first record with a time offset greater than
+ *        the given one.
  *
- * @details This call deletes an record from the database.
+ * @details This is also the number of records with a time offset less than or equal to
+ *          @p time_offset.
  *
- * @param[in] record_num  Index of the record to delete.
+ * @param[in] time_offset Time offset to search for.
  *
- * @retval NRF_SUCCESS If the record was successfully deleted from the database.
+ * @return Index of the record, or the number of records if there is no such record.
  */
-ret_code_t cgms_db_record_delete(uint8_t record_num);
+uint16_t cgms_db_upper_bound_get(uint16_t time_offset);
 
 
 #ifdef __cplusplus
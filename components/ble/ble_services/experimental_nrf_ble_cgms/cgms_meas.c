@@ -116,7 +116,7 @@ static uint8_t cgms_meas_encode(nrf_ble_cgms_t            * p_cgms,
  */
 ret_code_t cgms_meas_char_add(nrf_ble_cgms_t * p_cgms)
 {
-    uint8_t               num_recs;
+    uint16_t              num_recs;
     uint8_t               encoded_cgms_meas[NRF_BLE_CGMS_MEAS_LEN_MAX];
     ble_add_char_params_t add_char_params;
     ble_cgms_rec_t        initial_cgms_rec_value;
@@ -155,7 +155,7 @@ ret_code_t cgms_meas_send(nrf_ble_cgms_t * p_cgms, ble_cgms_rec_t * p_rec, uint8
 {
 
     uint32_t               err_code;
-    uint8_t                encoded_meas[NRF_BLE_CGMS_MEAS_LEN_MAX + NRF_BLE_CGMS_MEAS_REC_LEN_MAX];
+    uint8_t                encoded_meas[NRF_BLE_CGMS_MEAS_NOTIF_LEN_MAX + NRF_BLE_CGMS_MEAS_REC_LEN_MAX];
     uint16_t               len     = 0;
     uint16_t               hvx_len = NRF_BLE_CGMS_MEAS_LEN_MAX;
     int                    i;
@@ -164,7 +164,7 @@ ret_code_t cgms_meas_send(nrf_ble_cgms_t * p_cgms, ble_cgms_rec_t * p_rec, uint8
     for (i = 0; i < *p_count; i++)
     {
         uint8_t meas_len = cgms_meas_encode(p_cgms, &(p_rec[i].meas), (encoded_meas + len));
-        if (len + meas_len >= NRF_BLE_CGMS_MEAS_LEN_MAX)
+        if (len + meas_len > p_cgms->max_meas_len)
         {
             break;
         }
@@ -199,6 +199,66 @@ ret_code_t cgms_meas_send(nrf_ble_cgms_t * p_cgms, ble_cgms_rec_t * p_rec, uint8
 }
 
 
+ret_code_t cgms_meas_records_send(nrf_ble_cgms_t * p_cgms,
+                                  uint16_t         rec_num,
+                                  uint16_t         rec_count,
+                                  uint16_t       * p_sent)
+{
+    ret_code_t             err_code;
+    uint8_t                encoded_meas[NRF_BLE_CGMS_MEAS_NOTIF_LEN_MAX + NRF_BLE_CGMS_MEAS_REC_LEN_MAX];
+    uint16_t               len = 0;
+    uint16_t               hvx_len;
+    uint16_t               i;
+    ble_gatts_hvx_params_t hvx_params;
+
+    // Pack as many records as fit into the current ATT MTU.
+    for (i = 0; i < rec_count; i++)
+    {
+        ble_cgms_rec_t rec;
+        uint8_t        meas_len;
+
+        err_code = cgms_db_record_get(rec_num + i, &rec);
+        VERIFY_SUCCESS(err_code);
+
+        meas_len = cgms_meas_encode(p_cgms, &rec.meas, (encoded_meas + len));
+        if (len + meas_len > p_cgms->max_meas_len)
+        {
+            break;
+        }
+        len += meas_len;
+    }
+    hvx_len = len;
+
+    memset(&hvx_params, 0, sizeof(hvx_params));
+
+    hvx_params.handle = p_cgms->char_handles.measurment.value_handle;
+    hvx_params.type   = BLE_GATT_HVX_NOTIFICATION;
+    hvx_params.offset = 0;
+    hvx_params.p_len  = &hvx_len;
+    hvx_params.p_data = encoded_meas;
+
+    err_code = sd_ble_gatts_hvx(p_cgms->conn_handle, &hvx_params);
+    VERIFY_SUCCESS(err_code);
+
+    if (hvx_len != len)
+    {
+        return NRF_ERROR_DATA_SIZE;
+    }
+
+    *p_sent = i;
+
+    p_cgms->racp_data.racp_proc_records_reported += i;
+    p_cgms->racp_data.stats.notifications++;
+    p_cgms->racp_data.stats.records += i;
+    p_cgms->racp_data.stats.bytes   += len;
+    p_cgms->racp_data.stats.in_flight++;
+    p_cgms->racp_data.stats.in_flight_max = MAX(p_cgms->racp_data.stats.in_flight_max,
+                                                p_cgms->racp_data.stats.in_flight);
+
+    return NRF_SUCCESS;
+}
+
+
 /**@brief Function for handling the Glucose measurement CCCD write event.
  *
  * @param[in]   p_cgms         Service instance.
@@ -87,6 +87,26 @@ ret_code_t cgms_meas_char_add(nrf_ble_cgms_t * p_cgms);
 ret_code_t cgms_meas_send(nrf_ble_cgms_t * p_cgms, ble_cgms_rec_t * p_rec, uint8_t * count);
 
 
+/**@brief Function for sending stored CGM Measurements in one notification.
+ *
+ * @details Records are read from the database and packed into the notification until
+ *          the current ATT MTU is filled.
+ *
+ * @param[in]  p_cgms    Instance of the CGM Service.
+ * @param[in]  rec_num   Index of the first record to send.
+ * @param[in]  rec_count Number of records left to send.
+ * @param[out] p_sent    Number of records sent in the notification.
+ *
+ * @retval NRF_SUCCESS If the notification was queued.
+ * @return             If functions from other modules return errors to this function,
+ *                     the @ref nrf_error are propagated.
+ */
+ret_code_t cgms_meas_records_send(nrf_ble_cgms_t * p_cgms,
+                                  uint16_t         rec_num,
+                                  uint16_t         rec_count,
+                                  uint16_t       * p_sent);
+
+
 /**@brief Function for handling the @ref BLE_GATTS_EVT_WRITE event from the BLE stack.
  *
  * @param[in] p_cgms      Instance of the CGM Service.
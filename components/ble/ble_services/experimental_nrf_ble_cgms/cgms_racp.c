@@ -140,211 +140,40 @@ static void racp_response_code_send(nrf_ble_cgms_t * p_cgms, uint8_t opcode, uin
 }
 
 
-/**@brief Function for responding to the ALL operation.
+/**@brief Function for sending the next records of the requested range.
  *
- * @param[in]   p_cgms   Service instance.
- *
- * @return      NRF_SUCCESS on success, otherwise an error code.
- */
-static uint32_t racp_report_records_all(nrf_ble_cgms_t * p_cgms)
-{
-    uint16_t total_records = cgms_db_num_records_get();
-    uint16_t cur_nb_rec;
-    uint8_t  i;
-    uint8_t  nb_rec_to_send;
-
-    if (p_cgms->racp_data.racp_proc_record_ndx >= total_records)
-    {
-        p_cgms->racp_data.racp_procesing_active = false;
-    }
-    else
-    {
-        uint32_t       err_code;
-        ble_cgms_rec_t rec[NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX];
-
-        cur_nb_rec = total_records - p_cgms->racp_data.racp_proc_record_ndx;
-        if (cur_nb_rec > NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX)
-        {
-            cur_nb_rec = NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX;
-        }
-        nb_rec_to_send = (uint8_t)cur_nb_rec;
-
-        for (i = 0; i < cur_nb_rec; i++)
-        {
-            err_code = cgms_db_record_get(p_cgms->racp_data.racp_proc_record_ndx + i, &(rec[i]));
-            if (err_code != NRF_SUCCESS)
-            {
-                return err_code;
-            }
-        }
-        err_code = cgms_meas_send(p_cgms, rec, &nb_rec_to_send);
-        if (err_code != NRF_SUCCESS)
-        {
-            return err_code;
-        }
-        p_cgms->racp_data.racp_proc_record_ndx += nb_rec_to_send;
-    }
-
-    return NRF_SUCCESS;
-}
-
-
-/**@brief Function for responding to the FIRST or the LAST operation.
- *
- * @param[in]   p_cgms   Service instance.
- *
- * @return      NRF_SUCCESS on success, otherwise an error code.
- */
-static uint32_t racp_report_records_first_last(nrf_ble_cgms_t * p_cgms)
-{
-    uint32_t       err_code;
-    ble_cgms_rec_t rec;
-    uint16_t       total_records;
-    uint8_t        nb_rec_to_send = 1;
-
-    total_records = cgms_db_num_records_get();
-
-    if ((p_cgms->racp_data.racp_proc_records_reported != 0) || (total_records == 0))
-    {
-        p_cgms->racp_data.racp_procesing_active = false;
-    }
-    else
-    {
-        if (p_cgms->racp_data.racp_proc_operator == RACP_OPERATOR_FIRST)
-        {
-            err_code = cgms_db_record_get(0, &rec);
-            if (err_code != NRF_SUCCESS)
-            {
-                return err_code;
-            }
-        }
-        else if (p_cgms->racp_data.racp_proc_operator == RACP_OPERATOR_LAST)
-        {
-            err_code = cgms_db_record_get(total_records - 1, &rec);
-            if (err_code != NRF_SUCCESS)
-            {
-                return err_code;
-            }
-        }
-
-        err_code = cgms_meas_send(p_cgms, &rec, &nb_rec_to_send);
-        if (err_code != NRF_SUCCESS)
-        {
-            return err_code;
-        }
-        p_cgms->racp_data.racp_proc_record_ndx++;
-    }
-
-    return NRF_SUCCESS;
-}
-
-
-/**@brief Function for responding to the LESS OR EQUAL operation.
- *
- * @param[in]   p_cgms   Service instance.
- *
- * @return      NRF_SUCCESS on success, otherwise an error code.
- */
-static ret_code_t racp_report_records_less_equal(nrf_ble_cgms_t * p_cgms)
-{
-    uint16_t total_rec_nb_to_send;
-    uint16_t rec_nb_left_to_send;
-    uint8_t  nb_rec_to_send;
-    uint16_t i;
-
-    total_rec_nb_to_send = p_cgms->racp_data.racp_proc_records_ndx_last_to_send +1;
-
-    if (p_cgms->racp_data.racp_proc_record_ndx >= total_rec_nb_to_send)
-    {
-        p_cgms->racp_data.racp_procesing_active = false;
-    }
-    else
-    {
-        ret_code_t     err_code;
-        ble_cgms_rec_t rec[NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX];
-
-        rec_nb_left_to_send = total_rec_nb_to_send - p_cgms->racp_data.racp_proc_records_reported;
-
-        if (rec_nb_left_to_send > NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX)
-        {
-            nb_rec_to_send = NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX;
-        }
-        else
-        {
-            nb_rec_to_send = (uint8_t)rec_nb_left_to_send;
-        }
-
-        for (i = 0; i < nb_rec_to_send; i++)
-        {
-            err_code = cgms_db_record_get(p_cgms->racp_data.racp_proc_record_ndx + i, &(rec[i]));
-            if (err_code != NRF_SUCCESS)
-            {
-                return err_code;
-            }
-        }
-        err_code = cgms_meas_send(p_cgms, rec, &nb_rec_to_send);
-        if (err_code != NRF_SUCCESS)
-        {
-            return err_code;
-        }
-        p_cgms->racp_data.racp_proc_record_ndx += nb_rec_to_send;
-    }
-
-   return NRF_SUCCESS;
-}
-
-
-/**@brief Function for responding to the GREATER OR EQUAL operation.
+ * @details Sends as many records as fit into one notification, starting from
+ *          racp_proc_record_ndx up to and including racp_proc_records_ndx_last_to_send.
  *
  * @param[in]   p_cgms   Service instance.
  *
  * @return      NRF_SUCCESS on success, otherwise an error code.
  */
-static ret_code_t racp_report_records_greater_equal(nrf_ble_cgms_t * p_cgms)
+static ret_code_t racp_report_records_range(nrf_ble_cgms_t * p_cgms)
 {
     ret_code_t err_code;
-    uint16_t   total_rec_nb = cgms_db_num_records_get();
     uint16_t   rec_nb_left_to_send;
-    uint8_t    nb_rec_to_send;
-    uint16_t   i;
+    uint16_t   nb_rec_sent;
 
-
-    total_rec_nb = cgms_db_num_records_get();
-    if (p_cgms->racp_data.racp_proc_record_ndx >= total_rec_nb)
+    if (p_cgms->racp_data.racp_proc_record_ndx > p_cgms->racp_data.racp_proc_records_ndx_last_to_send)
     {
         p_cgms->racp_data.racp_procesing_active = false;
 
         return NRF_SUCCESS;
     }
 
-    ble_cgms_rec_t rec[NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX];
+    rec_nb_left_to_send = p_cgms->racp_data.racp_proc_records_ndx_last_to_send -
+                          p_cgms->racp_data.racp_proc_record_ndx + 1;
 
-    rec_nb_left_to_send = total_rec_nb - p_cgms->racp_data.racp_proc_record_ndx;
-    if (rec_nb_left_to_send > NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX)
-    {
-        nb_rec_to_send = NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX;
-    }
-    else
-    {
-        nb_rec_to_send = (uint8_t)rec_nb_left_to_send;
-    }
+    err_code = cgms_meas_records_send(p_cgms,
+                                      p_cgms->racp_data.racp_proc_record_ndx,
+                                      rec_nb_left_to_send,
+                                      &nb_rec_sent);
+    VERIFY_SUCCESS(err_code);
 
-    for (i = 0; i < nb_rec_to_send; i++)
-    {
-        err_code = cgms_db_record_get(p_cgms->racp_data.racp_proc_record_ndx + i, &(rec[i]));
-        if (err_code != NRF_SUCCESS)
-        {
-            return err_code;
-        }
-    }
-    err_code = cgms_meas_send(p_cgms, rec, &nb_rec_to_send);
-    if (err_code != NRF_SUCCESS)
-    {
-        return err_code;
-    }
-    p_cgms->racp_data.racp_proc_record_ndx += nb_rec_to_send;
+    p_cgms->racp_data.racp_proc_record_ndx += nb_rec_sent;
 
-   return NRF_SUCCESS;
+    return NRF_SUCCESS;
 }
 
 
@@ -377,37 +206,10 @@ static void racp_report_records_procedure(nrf_ble_cgms_t * p_cgms)
 {
     ret_code_t err_code = NRF_SUCCESS;
 
+    // Keep queuing notifications until the SoftDevice queue is full.
     while (p_cgms->racp_data.racp_procesing_active)
     {
-        // Execute requested procedure
-        switch (p_cgms->racp_data.racp_proc_operator)
-        {
-            case RACP_OPERATOR_ALL:
-                err_code = racp_report_records_all(p_cgms);
-                break;
-
-            case RACP_OPERATOR_FIRST:
-                // Fall through.
-            case RACP_OPERATOR_LAST:
-                err_code = racp_report_records_first_last(p_cgms);
-                break;
-            case RACP_OPERATOR_GREATER_OR_EQUAL:
-                err_code = racp_report_records_greater_equal(p_cgms);
-                break;
-            case RACP_OPERATOR_LESS_OR_EQUAL:
-                err_code = racp_report_records_less_equal(p_cgms);
-                break;
-            default:
-                // Report error to application
-                if (p_cgms->error_handler != NULL)
-                {
-                    p_cgms->error_handler(NRF_ERROR_INTERNAL);
-                }
-
-                p_cgms->racp_data.racp_procesing_active = false;
-
-                return;
-        }
+        err_code = racp_report_records_range(p_cgms);
 
         // Error handling
         switch (err_code)
@@ -421,6 +223,7 @@ static void racp_report_records_procedure(nrf_ble_cgms_t * p_cgms)
 
             case NRF_ERROR_RESOURCES:
                 // Wait for TX_COMPLETE event to resume transmission.
+                p_cgms->racp_data.stats.queue_full++;
                 return;
 
             case NRF_ERROR_INVALID_STATE:
@@ -530,10 +333,37 @@ static bool is_request_to_be_executed(nrf_ble_cgms_t         * p_cgms,
                 break;
         }
     }
-    // Unsupported opcodes.
     else if (p_racp_request->opcode == RACP_OPCODE_DELETE_RECS)
     {
-        *p_response_code = RACP_RESPONSE_OPCODE_UNSUPPORTED;
+        switch (p_racp_request->operator)
+        {
+            case RACP_OPERATOR_ALL:
+                if (p_racp_request->operand_len != 0)
+                {
+                    *p_response_code = RACP_RESPONSE_INVALID_OPERAND;
+                }
+                break;
+
+            // The database only deletes all records at once.
+            case RACP_OPERATOR_LESS_OR_EQUAL:
+                // Fall through.
+            case RACP_OPERATOR_GREATER_OR_EQUAL:
+                // Fall through.
+            case RACP_OPERATOR_RANGE:
+                // Fall through.
+            case RACP_OPERATOR_FIRST:
+                // Fall through.
+            case RACP_OPERATOR_LAST:
+                *p_response_code = RACP_RESPONSE_OPERATOR_UNSUPPORTED;
+                break;
+
+            // Invalid operators.
+            case RACP_OPERATOR_NULL:
+                // Fall through.
+            default:
+                *p_response_code = RACP_RESPONSE_INVALID_OPERATOR;
+                break;
+        }
     }
     // Unknown opcodes.
     else
@@ -547,40 +377,29 @@ static bool is_request_to_be_executed(nrf_ble_cgms_t         * p_cgms,
 
 
 
-/**@brief Function for getting a record with time offset less or equal to the input param.
+/**@brief Function for getting the last record with time offset less or equal to the input param.
  *
- * @param[in]  offset     The record that this function returns must have an time offset less or greater to this.
+ * @param[in]  offset     The record that this function returns must have an time offset less or equal to this.
  * @param[out] record_num Pointer to the record index of the record that has the desired time offset.
  *
- * @retval NRF_SUCCESS If the record was successfully retrieved.
+ * @retval NRF_SUCCESS         If the record was successfully retrieved.
  * @retval NRF_ERROR_NOT_FOUND A record with the desired offset does not exist in the database.
- * @return                     If functions from other modules return errors to this function,
- *                             the @ref nrf_error are propagated.
  */
 static ret_code_t record_index_offset_less_or_equal_get(uint16_t offset, uint16_t * record_num)
 {
-    ret_code_t err_code;
-    ble_cgms_rec_t rec;
-    uint16_t upper_bound = cgms_db_num_records_get();
+    uint16_t count = cgms_db_upper_bound_get(offset);
 
-    for((*record_num) = upper_bound; (*record_num)-- >0;)
+    if (count == 0)
     {
-        err_code = cgms_db_record_get(*record_num, &rec);
-        if (err_code != NRF_SUCCESS)
-        {
-            return err_code;
-        }
-        if (rec.meas.time_offset <= offset)
-        {
-            return NRF_SUCCESS;
-        }
+        return NRF_ERROR_NOT_FOUND;
     }
-    return NRF_ERROR_NOT_FOUND;
-}
+    *record_num = count - 1;
 
+    return NRF_SUCCESS;
+}
 
 
-/**@brief Function for getting a record with time offset greater or equal to the input param.
+/**@brief Function for getting the first record with time offset greater or equal to the input param.
  *
  * @param[in]  offset     The record that this function returns must have an time offset equal or
  *                        greater to this.
@@ -588,28 +407,17 @@ static ret_code_t record_index_offset_less_or_equal_get(uint16_t offset, uint16_
  *
  * @retval NRF_SUCCESS         If the record was successfully retrieved.
  * @retval NRF_ERROR_NOT_FOUND A record with the desired offset does not exist in the database.
- * @return                     If functions from other modules return errors to this function,
- *                             the @ref nrf_error are propagated.
  */
 static ret_code_t record_index_offset_greater_or_equal_get(uint16_t offset, uint16_t * record_num)
 {
-    ret_code_t     err_code;
-    ble_cgms_rec_t rec;
-    uint16_t       upper_bound = cgms_db_num_records_get();
+    *record_num = cgms_db_lower_bound_get(offset);
 
-    for(*record_num = 0; *record_num < upper_bound; (*record_num)++)
+    if (*record_num >= cgms_db_num_records_get())
     {
-        err_code = cgms_db_record_get(*record_num, &rec);
-        if (err_code != NRF_SUCCESS)
-        {
-            return err_code;
-        }
-        if (rec.meas.time_offset >= offset)
-        {
-            return NRF_SUCCESS;
-        }
+        return NRF_ERROR_NOT_FOUND;
     }
-    return NRF_ERROR_NOT_FOUND;
+
+    return NRF_SUCCESS;
 }
 
 
@@ -623,33 +431,51 @@ static ret_code_t record_index_offset_greater_or_equal_get(uint16_t offset, uint
 static void report_records_request_execute(nrf_ble_cgms_t   * p_cgms,
                                            ble_racp_value_t * p_racp_request)
 {
-    p_cgms->racp_data.racp_procesing_active = true;
+    ret_code_t err_code      = NRF_SUCCESS;
+    uint16_t   total_records = cgms_db_num_records_get();
 
     p_cgms->racp_data.racp_proc_record_ndx               = 0;
     p_cgms->racp_data.racp_proc_operator                 = p_racp_request->operator;
     p_cgms->racp_data.racp_proc_records_reported         = 0;
-    p_cgms->racp_data.racp_proc_records_ndx_last_to_send = 0;
+    p_cgms->racp_data.racp_proc_records_ndx_last_to_send = total_records - 1;
+
+    memset(&p_cgms->racp_data.stats, 0, sizeof(p_cgms->racp_data.stats));
 
-    if (p_cgms->racp_data.racp_proc_operator == RACP_OPERATOR_GREATER_OR_EQUAL)
+    if (total_records == 0)
     {
-        uint16_t  offset_requested = uint16_decode(&p_cgms->racp_data.racp_request.p_operand[OPERAND_LESS_GREATER_FILTER_TYPE_SIZE]);
-        ret_code_t err_code = record_index_offset_greater_or_equal_get(offset_requested, &p_cgms->racp_data.racp_proc_record_ndx);
-        if (err_code != NRF_SUCCESS)
-        {
-            racp_report_records_completed(p_cgms);
-        }
+        err_code = NRF_ERROR_NOT_FOUND;
+    }
+    else if (p_cgms->racp_data.racp_proc_operator == RACP_OPERATOR_FIRST)
+    {
+        p_cgms->racp_data.racp_proc_records_ndx_last_to_send = 0;
+    }
+    else if (p_cgms->racp_data.racp_proc_operator == RACP_OPERATOR_LAST)
+    {
+        p_cgms->racp_data.racp_proc_record_ndx = total_records - 1;
+    }
+    else if (p_cgms->racp_data.racp_proc_operator == RACP_OPERATOR_GREATER_OR_EQUAL)
+    {
+        uint16_t offset_requested = uint16_decode(&p_cgms->racp_data.racp_request.p_operand[OPERAND_LESS_GREATER_FILTER_TYPE_SIZE]);
 
+        err_code = record_index_offset_greater_or_equal_get(offset_requested,
+                                                            &p_cgms->racp_data.racp_proc_record_ndx);
     }
-    if (p_cgms->racp_data.racp_proc_operator == RACP_OPERATOR_LESS_OR_EQUAL)
+    else if (p_cgms->racp_data.racp_proc_operator == RACP_OPERATOR_LESS_OR_EQUAL)
     {
-        uint16_t   offset_requested = uint16_decode(&p_cgms->racp_data.racp_request.p_operand[OPERAND_LESS_GREATER_FILTER_TYPE_SIZE]);
-        ret_code_t err_code         = record_index_offset_less_or_equal_get(offset_requested,
-                                                                            &p_cgms->racp_data.racp_proc_records_ndx_last_to_send);
-        if (err_code != NRF_SUCCESS)
-        {
-            racp_report_records_completed(p_cgms);
-        }
+        uint16_t offset_requested = uint16_decode(&p_cgms->racp_data.racp_request.p_operand[OPERAND_LESS_GREATER_FILTER_TYPE_SIZE]);
+
+        err_code = record_index_offset_less_or_equal_get(offset_requested,
+                                                         &p_cgms->racp_data.racp_proc_records_ndx_last_to_send);
     }
+
+    if (err_code != NRF_SUCCESS)
+    {
+        // Nothing to report, complete the procedure right away.
+        racp_report_records_completed(p_cgms);
+        return;
+    }
+
+    p_cgms->racp_data.racp_procesing_active = true;
     racp_report_records_procedure(p_cgms);
 }
 
@@ -695,6 +521,12 @@ static void report_num_records_request_execute(nrf_ble_cgms_t   * p_cgms,
             num_records = total_records - index_of_offset;
         }
     }
+    else if (p_racp_request->operator == RACP_OPERATOR_LESS_OR_EQUAL)
+    {
+        uint16_t offset_requested = uint16_decode(&p_cgms->racp_data.racp_request.p_operand[OPERAND_LESS_GREATER_FILTER_TYPE_SIZE]);
+
+        num_records = cgms_db_upper_bound_get(offset_requested);
+    }
 
     p_cgms->racp_data.pending_racp_response.opcode      = RACP_OPCODE_NUM_RECS_RESPONSE;
     p_cgms->racp_data.pending_racp_response.operator    = RACP_OPERATOR_NULL;
@@ -709,6 +541,28 @@ static void report_num_records_request_execute(nrf_ble_cgms_t   * p_cgms,
 }
 
 
+/**@brief Function for processing a DELETE STORED RECORDS request.
+ *
+ * @param[in]   p_cgms           Service instance.
+ * @param[in]   p_racp_request   Request to be executed.
+ */
+static void delete_records_request_execute(nrf_ble_cgms_t   * p_cgms,
+                                           ble_racp_value_t * p_racp_request)
+{
+    uint8_t    response_code = RACP_RESPONSE_SUCCESS;
+    ret_code_t err_code;
+
+    // Only RACP_OPERATOR_ALL is accepted.
+    err_code = cgms_db_clear();
+    if (err_code != NRF_SUCCESS)
+    {
+        response_code = RACP_RESPONSE_PROCEDURE_NOT_DONE;
+    }
+
+    racp_response_code_send(p_cgms, RACP_OPCODE_DELETE_RECS, response_code);
+}
+
+
 /**@brief Function for handling a write event to the Record Access Control Point.
  *
  * @param[in]   p_cgms      Service instance.
@@ -756,6 +610,10 @@ static void on_racp_value_write(nrf_ble_cgms_t * p_cgms, ble_gatts_evt_write_t c
         {
             report_num_records_request_execute(p_cgms, &p_cgms->racp_data.racp_request);
         }
+        else if (p_cgms->racp_data.racp_request.opcode == RACP_OPCODE_DELETE_RECS)
+        {
+            delete_records_request_execute(p_cgms, &p_cgms->racp_data.racp_request);
+        }
     }
     else if (response_code != RACP_RESPONSE_RESERVED)
     {
@@ -814,9 +672,19 @@ void cgms_racp_on_rw_auth_req(nrf_ble_cgms_t                             * p_cgm
 /**@brief Function for handling BLE_GATTS_EVT_HVN_TX_COMPLETE events.
  *
  * @param[in]   p_cgms      Glucose Service structure.
+ * @param[in]   count       Number of notifications transmitted.
  */
-void cgms_racp_on_tx_complete(nrf_ble_cgms_t * p_cgms)
+void cgms_racp_on_tx_complete(nrf_ble_cgms_t * p_cgms, uint16_t count)
 {
+    if (p_cgms->racp_data.stats.in_flight > count)
+    {
+        p_cgms->racp_data.stats.in_flight -= count;
+    }
+    else
+    {
+        p_cgms->racp_data.stats.in_flight = 0;
+    }
+
     if (p_cgms->racp_data.racp_procesing_active)
     {
         racp_report_records_procedure(p_cgms);
@@ -87,8 +87,9 @@ void cgms_racp_on_rw_auth_req(nrf_ble_cgms_t                             * p_cgm
 /**@brief Function for handling @ref BLE_GATTS_EVT_HVN_TX_COMPLETE events.
  *
  * @param[in] p_cgms Instance of the CGM Service.
+ * @param[in] count  Number of notifications transmitted.
  */
-void cgms_racp_on_tx_complete(nrf_ble_cgms_t * p_cgms);
+void cgms_racp_on_tx_complete(nrf_ble_cgms_t * p_cgms, uint16_t count);
 
 #ifdef __cplusplus
 }
@@ -41,6 +41,7 @@
 #include <string.h>
 #include "ble.h"
 #include "ble_srv_common.h"
+#include "cgms_db.h"
 #include "cgms_sst.h"
 #include "cgms_socp.h"
 #include "nrf_ble_gq.h"
@@ -307,6 +308,11 @@ static void on_socp_value_write(nrf_ble_cgms_t * p_cgms, ble_gatts_evt_write_t c
             {
                 p_cgms->socp_response.rsp_code = SOCP_RSP_PROCEDURE_NOT_COMPLETED;
             }
+            else if (cgms_db_clear() != NRF_SUCCESS)
+            {
+                // The records of the previous session could not be deleted.
+                p_cgms->socp_response.rsp_code = SOCP_RSP_PROCEDURE_NOT_COMPLETED;
+            }
             else
             {
                 p_cgms->socp_response.rsp_code = SOCP_RSP_SUCCESS;
@@ -237,7 +237,7 @@ ret_code_t nrf_ble_cgms_init(nrf_ble_cgms_t * p_cgms, const nrf_ble_cgms_init_t
     ble_uuid_t ble_uuid;
 
     // Initialize data base
-    err_code = cgms_db_init();
+    err_code = cgms_db_init(p_cgms_init->error_handler);
     if (err_code != NRF_SUCCESS)
     {
         return err_code;
@@ -259,6 +259,7 @@ ret_code_t nrf_ble_cgms_init(nrf_ble_cgms_t * p_cgms, const nrf_ble_cgms_init_t
     p_cgms->is_session_started = false;
     p_cgms->nb_run_session     = 0;
     p_cgms->conn_handle        = BLE_CONN_HANDLE_INVALID;
+    p_cgms->max_meas_len       = NRF_BLE_CGMS_MEAS_LEN_MAX;
     p_cgms->gatt_err_handler   = gatt_error_handler;
 
     p_cgms->feature.feature         = 0;
@@ -358,7 +359,7 @@ static void on_write(nrf_ble_cgms_t * p_cgms, ble_evt_t const * p_ble_evt)
  */
 static void on_tx_complete(nrf_ble_cgms_t * p_cgms, ble_evt_t const * p_ble_evt)
 {
-    cgms_racp_on_tx_complete(p_cgms);
+    cgms_racp_on_tx_complete(p_cgms, p_ble_evt->evt.gatts_evt.params.hvn_tx_complete.count);
 }
 
 
@@ -381,6 +382,7 @@ void nrf_ble_cgms_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
     {
         case BLE_GAP_EVT_CONNECTED:
             p_cgms->conn_handle    = p_ble_evt->evt.gap_evt.conn_handle;
+            p_cgms->max_meas_len   = NRF_BLE_CGMS_MEAS_LEN_MAX;
             break;
 
         case BLE_GAP_EVT_DISCONNECTED:
@@ -406,6 +408,20 @@ void nrf_ble_cgms_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context)
 }
 
 
+void nrf_ble_cgms_on_gatt_evt(nrf_ble_cgms_t * p_cgms, nrf_ble_gatt_evt_t const * p_gatt_evt)
+{
+    if (    (p_cgms->conn_handle == p_gatt_evt->conn_handle)
+        &&  (p_gatt_evt->evt_id == NRF_BLE_GATT_EVT_ATT_MTU_UPDATED))
+    {
+        uint16_t max_meas_len = p_gatt_evt->params.att_mtu_effective
+                                - NRF_BLE_CGMS_MEAS_OP_LEN
+                                - NRF_BLE_CGMS_MEAS_HANDLE_LEN;
+
+        p_cgms->max_meas_len = MIN(max_meas_len, NRF_BLE_CGMS_MEAS_NOTIF_LEN_MAX);
+    }
+}
+
+
 ret_code_t nrf_ble_cgms_meas_create(nrf_ble_cgms_t * p_cgms, ble_cgms_rec_t * p_rec)
 {
     uint32_t err_code       = NRF_SUCCESS;
@@ -424,6 +440,43 @@ ret_code_t nrf_ble_cgms_meas_create(nrf_ble_cgms_t * p_cgms, ble_cgms_rec_t * p_
 }
 
 
+ret_code_t nrf_ble_cgms_meas_batch_create(nrf_ble_cgms_t       * p_cgms,
+                                          ble_cgms_rec_t const * p_recs,
+                                          uint16_t               count)
+{
+    ret_code_t err_code;
+    uint16_t   sent = 0;
+
+    VERIFY_PARAM_NOT_NULL(p_cgms);
+    VERIFY_PARAM_NOT_NULL(p_recs);
+
+    err_code = cgms_db_records_add(p_recs, count);
+    VERIFY_SUCCESS(err_code);
+
+    if ((p_cgms->conn_handle == BLE_CONN_HANDLE_INVALID) || (p_cgms->comm_interval == 0))
+    {
+        return NRF_SUCCESS;
+    }
+
+    while (sent < count)
+    {
+        uint8_t nb_rec_to_send = (uint8_t)MIN(count - sent, UINT8_MAX);
+
+        // cgms_meas_send() packs as many records as fit in the ATT MTU.
+        err_code = cgms_meas_send(p_cgms, (ble_cgms_rec_t *)&p_recs[sent], &nb_rec_to_send);
+        VERIFY_SUCCESS(err_code);
+
+        if (nb_rec_to_send == 0)
+        {
+            return NRF_ERROR_DATA_SIZE;
+        }
+        sent += nb_rec_to_send;
+    }
+
+    return NRF_SUCCESS;
+}
+
+
 ret_code_t nrf_ble_cgms_update_status(nrf_ble_cgms_t * p_cgms, nrf_ble_cgm_status_t * p_status)
 {
     uint8_t           encoded_status[NRF_BLE_CGMS_STATUS_LEN];
@@ -468,3 +521,15 @@ ret_code_t nrf_ble_cgms_srt_set(nrf_ble_cgms_t * p_cgms, uint16_t run_time)
 }
 
 
+ret_code_t nrf_ble_cgms_racp_stats_get(nrf_ble_cgms_t const    * p_cgms,
+                                       nrf_ble_cgms_racp_stats_t * p_stats)
+{
+    VERIFY_PARAM_NOT_NULL(p_cgms);
+    VERIFY_PARAM_NOT_NULL(p_stats);
+
+    *p_stats = p_cgms->racp_data.stats;
+
+    return NRF_SUCCESS;
+}
+
+
@@ -69,6 +69,7 @@
 #include "ble_racp.h"
 #include "nrf_sdh_ble.h"
 #include "nrf_ble_gq.h"
+#include "nrf_ble_gatt.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -157,6 +158,10 @@ NRF_SDH_BLE_OBSERVER(_name ## _obs,
                                              NRF_BLE_CGMS_MEAS_OP_LEN - \
                                              NRF_BLE_CGMS_MEAS_HANDLE_LEN)  //!< Maximum size of a transmitted Glucose Measurement.
 
+#define NRF_BLE_CGMS_MEAS_NOTIF_LEN_MAX     (NRF_SDH_BLE_GATT_MAX_MTU_SIZE - \
+                                             NRF_BLE_CGMS_MEAS_OP_LEN - \
+                                             NRF_BLE_CGMS_MEAS_HANDLE_LEN)  //!< Maximum size of a notification with packed measurement records, for the largest ATT MTU.
+
 #define NRF_BLE_CGMS_MEAS_REC_LEN_MAX       15                              //!< Maximum length of one measurement record. Size 1 byte, flags 1 byte, glucose concentration 2 bytes, offset 2 bytes, status 3 bytes, trend 2 bytes, quality 2 bytes, CRC 2 bytes.
 #define NRF_BLE_CGMS_MEAS_REC_LEN_MIN       6                               //!< Minimum length of one measurement record. Size 1 byte, flags 1 byte, glucose concentration 2 bytes, offset 2 bytes.
 #define NRF_BLE_CGMS_MEAS_REC_PER_NOTIF_MAX (NRF_BLE_CGMS_MEAS_LEN_MAX / \
@@ -303,6 +308,22 @@ typedef struct
 } nrf_ble_cgms_calib_t;
 
 
+/**@brief Record Access Control Point transfer statistics.
+ *
+ * @details Statistics of the last REPORT RECORDS procedure. They are cleared when a new
+ *          procedure starts.
+ */
+typedef struct
+{
+    uint32_t notifications; /**< Number of notifications queued in the SoftDevice. */
+    uint32_t records;       /**< Number of measurement records sent. */
+    uint32_t bytes;         /**< Number of measurement bytes sent. */
+    uint32_t queue_full;    /**< Number of times the SoftDevice notification queue was full. */
+    uint8_t  in_flight;     /**< Number of notifications queued and not yet transmitted. */
+    uint8_t  in_flight_max; /**< Highest number of notifications in flight. */
+} nrf_ble_cgms_racp_stats_t;
+
+
 /**@brief Record Access Control Point transaction data. */
 typedef struct
 {
@@ -314,6 +335,7 @@ typedef struct
     ble_racp_value_t pending_racp_response;                                                 /**< RACP response to be sent. */
     bool             racp_procesing_active;                                                 /**< RACP processing active. */
     uint8_t          pending_racp_response_operand[NRF_BLE_CGMS_RACP_PENDING_OPERANDS_MAX]; /**< Operand of the RACP response to be sent. */
+    nrf_ble_cgms_racp_stats_t stats;                                                        /**< Transfer statistics. */
 } nrf_ble_cgms_racp_t;
 
 
@@ -340,6 +362,7 @@ struct ble_cgms_s
     uint16_t                    service_handle;                              /**< Handle of the CGM Service (as provided by the BLE stack). */
     nrf_ble_cgms_char_handler_t char_handles;                                /**< GATTS characteristic handles for the different characteristics in the service. */
     uint16_t                    conn_handle;                                 /**< Handle of the current connection (as provided by the BLE stack; @ref BLE_CONN_HANDLE_INVALID if not in a connection). */
+    uint16_t                    max_meas_len;                                /**< Current maximum length of a measurement notification, adjusted according to the current ATT MTU. */
     nrf_ble_cgms_feature_t      feature;                                     /**< Structure to store the value of the feature characteristic. */
     uint8_t                     comm_interval;                               /**< Variable to keep track of the communication interval. */
     ble_socp_rsp_t              socp_response;                               /**< Structure containing reponse data to be indicated to the peer device. */
@@ -396,6 +419,18 @@ ret_code_t nrf_ble_cgms_init(nrf_ble_cgms_t * p_cgms, const nrf_ble_cgms_init_t
 void nrf_ble_cgms_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
 
 
+/**@brief Function for handling the GATT module's events.
+ *
+ * @details Handles all events from the GATT module of interest to the CGM Service. The ATT MTU
+ *          is used to pack as many measurement records as possible into each notification
+ *          sent by the Record Access Control Point.
+ *
+ * @param[in] p_cgms     Instance of the CGM Service.
+ * @param[in] p_gatt_evt Event received from the GATT module.
+ */
+void nrf_ble_cgms_on_gatt_evt(nrf_ble_cgms_t * p_cgms, nrf_ble_gatt_evt_t const * p_gatt_evt);
+
+
 /**@brief Function for reporting a new glucose measurement to the CGM Service module.
  *
  * @details The application calls this function after having performed a new glucose measurement.
@@ -411,6 +446,25 @@ void nrf_ble_cgms_on_ble_evt(ble_evt_t const * p_ble_evt, void * p_context);
 ret_code_t nrf_ble_cgms_meas_create(nrf_ble_cgms_t * p_cgms, ble_cgms_rec_t * p_rec);
 
 
+/**@brief Function for reporting several glucose measurements to the CGM Service module.
+ *
+ * @details The measurements are recorded in the RACP database in one operation (see
+ *          @ref cgms_db_records_add) and, if a peer is connected and periodic communication
+ *          is enabled, notified packed into as few notifications as possible.
+ *
+ * @param[in] p_cgms Instance of the CGM Service.
+ * @param[in] p_recs Glucose records, in time order.
+ * @param[in] count  Number of records.
+ *
+ * @retval NRF_SUCCESS If the measurements were successfully created.
+ * @return             If functions from other modules return errors to this function,
+ *                     the @ref nrf_error are propagated.
+ */
+ret_code_t nrf_ble_cgms_meas_batch_create(nrf_ble_cgms_t       * p_cgms,
+                                          ble_cgms_rec_t const * p_recs,
+                                          uint16_t               count);
+
+
 /**@brief Function for assigning a connection handle to a CGM Service instance.
  *
  * @param[in] p_cgms      Instance of the CGM Service.
@@ -434,6 +488,18 @@ ret_code_t nrf_ble_cgms_conn_handle_assign(nrf_ble_cgms_t * p_cgms, uint16_t con
  */
 ret_code_t nrf_ble_cgms_srt_set(nrf_ble_cgms_t * p_cgms, uint16_t run_time);
 
+
+/**@brief Function for getting the transfer statistics of the Record Access Control Point.
+ *
+ * @param[in]  p_cgms  Instance of the CGM Service.
+ * @param[out] p_stats Statistics of the last REPORT RECORDS procedure.
+ *
+ * @retval NRF_SUCCESS    If the statistics were copied.
+ * @retval NRF_ERROR_NULL If any of the input parameters are NULL.
+ */
+ret_code_t nrf_ble_cgms_racp_stats_get(nrf_ble_cgms_t const    * p_cgms,
+                                       nrf_ble_cgms_racp_stats_t * p_stats);
+
 /** @} */ // End tag for Function group.
 
 #ifdef __cplusplus
@@ -138,7 +138,8 @@ static const req_data_alloc_t m_req_data_alloc[NRF_BLE_GQ_REQ_NUM] =
     [NRF_BLE_GQ_REQ_SRV_DISCOVERY]  = NULL,
     [NRF_BLE_GQ_REQ_CHAR_DISCOVERY] = NULL,
     [NRF_BLE_GQ_REQ_DESC_DISCOVERY] = NULL,
-    [NRF_BLE_GQ_REQ_GATTS_HVX]      = gatts_hvx_alloc
+    [NRF_BLE_GQ_REQ_GATTS_HVX]      = gatts_hvx_alloc,
+    [NRF_BLE_GQ_REQ_GATTC_READ_BY_UUID] = NULL
 };
 
 
@@ -231,6 +232,14 @@ static void queue_process(nrf_queue_t const * const p_queue, uint16_t conn_handl
                                                              &ble_req.params.gattc_desc_disc);
             } break;
 
+            case NRF_BLE_GQ_REQ_GATTC_READ_BY_UUID:
+            {
+                NRF_LOG_DEBUG("GATTC Read Using Characteristic UUID Request");
+                err_code = sd_ble_gattc_char_value_by_uuid_read(conn_handle,
+                                                                &ble_req.params.gattc_read_by_uuid.uuid,
+                                                                &ble_req.params.gattc_read_by_uuid.handle_range);
+            } break;
+
             case NRF_BLE_GQ_REQ_GATTS_HVX:
             {
                 uint8_t  hvx_data[NRF_BLE_GQ_GATTS_HVX_MAX_DATA_LEN];
@@ -373,6 +382,13 @@ static bool request_process(nrf_ble_gq_req_t const * const p_req, uint16_t conn_
                                                          &p_req->params.gattc_desc_disc);
             break;
 
+        case NRF_BLE_GQ_REQ_GATTC_READ_BY_UUID:
+            NRF_LOG_DEBUG("GATTC Read Using Characteristic UUID Request");
+            err_code = sd_ble_gattc_char_value_by_uuid_read(conn_handle,
+                                                            &p_req->params.gattc_read_by_uuid.uuid,
+                                                            &p_req->params.gattc_read_by_uuid.handle_range);
+            break;
+
         case NRF_BLE_GQ_REQ_GATTS_HVX:
         {
             uint16_t len = *p_req->params.gatts_hvx.p_len;
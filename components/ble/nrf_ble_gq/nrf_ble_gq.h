@@ -130,6 +130,7 @@ typedef enum
     NRF_BLE_GQ_REQ_CHAR_DISCOVERY, /**< GATTC Characteristic Discovery Request. See @ref nrf_ble_gq_gattc_char_disc_t and @ref sd_ble_gattc_characteristics_discover. */
     NRF_BLE_GQ_REQ_DESC_DISCOVERY, /**< GATTC Characteristic Descriptor Discovery Request. See @ref nrf_ble_gq_gattc_desc_disc_t and @ref sd_ble_gattc_descriptors_discover*/
     NRF_BLE_GQ_REQ_GATTS_HVX,      /**< GATTS Handle Value Notification or Indication. See @ref nrf_ble_gq_gatts_hvx_t and @ref ble_gatts_hvx_params_t */
+    NRF_BLE_GQ_REQ_GATTC_READ_BY_UUID, /**< GATTC Read Using Characteristic UUID Request. See @ref nrf_ble_gq_gattc_read_by_uuid_t and @ref sd_ble_gattc_char_value_by_uuid_read. */
     NRF_BLE_GQ_REQ_NUM             /**< Total number of different GATT Request types */
 } nrf_ble_gq_req_type_t;
 
@@ -164,6 +165,13 @@ typedef ble_gattc_handle_range_t nrf_ble_gq_gattc_desc_disc_t;
 /**@brief Structure used to describe @ref NRF_BLE_GQ_REQ_GATTS_HVX request type. */
 typedef ble_gatts_hvx_params_t nrf_ble_gq_gatts_hvx_t;
 
+/**@brief Structure used to describe @ref NRF_BLE_GQ_REQ_GATTC_READ_BY_UUID request type. */
+typedef struct
+{
+    ble_uuid_t               uuid;         /**< UUID of the characteristic to be read. */
+    ble_gattc_handle_range_t handle_range; /**< Handle range in which the characteristic is searched. */
+} nrf_ble_gq_gattc_read_by_uuid_t;
+
 /**@brief Structure used to handle SoftDevice error. */
 typedef struct
 {
@@ -186,6 +194,7 @@ typedef struct
         nrf_ble_gq_gattc_char_disc_t     gattc_char_disc; /**< GATTC characteristic discovery parameters. Filled when nrf_ble_gq_req_t::type is @ref NRF_BLE_GQ_REQ_CHAR_DISCOVERY. */
         nrf_ble_gq_gattc_desc_disc_t     gattc_desc_disc; /**< GATTC characteristic descriptor discovery parameters. Filled when nrf_ble_gq_req_t::type is NRF_BLE_GQ_REQ_DESC_DISCOVERY. */
         nrf_ble_gq_gatts_hvx_t           gatts_hvx;       /**< GATTS Handle Value Notification or Indication Parameters. Filled when nrf_ble_gq_req_t::type is @ref NRF_BLE_GQ_REQ_GATTS_HVX. */
+        nrf_ble_gq_gattc_read_by_uuid_t  gattc_read_by_uuid; /**< GATTC Read Using Characteristic UUID parameters. Filled when nrf_ble_gq_req_t::type is @ref NRF_BLE_GQ_REQ_GATTC_READ_BY_UUID. */
     } params;
 } nrf_ble_gq_req_t;
 
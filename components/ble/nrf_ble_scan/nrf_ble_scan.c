@@ -160,6 +160,197 @@ static uint16_t nrf_ble_scan_address_type_decode(uint8_t const * p_addr)
 
 
 #if (NRF_BLE_SCAN_FILTER_ENABLE == 1)
+
+#define UUID16_SIZE     2           /**< Size of 16 bit UUID. */
+#define UUID128_SIZE    16          /**< Size of 128 bit UUID. */
+#define UUID128_ALIAS   12          /**< Offset of the 16-bit UUID value in a 128-bit UUID. */
+#define FNV_OFFSET      2166136261U /**< FNV-1a offset basis. */
+#define FNV_PRIME       16777619U   /**< FNV-1a prime. */
+
+#if (NRF_BLE_SCAN_UUID_CNT > 0)
+STATIC_ASSERT(NRF_BLE_SCAN_UUID_CNT <= 32, "UUID filter matches are kept in a 32-bit mask.");
+#endif
+
+STATIC_ASSERT(NRF_BLE_SCAN_HASH_TABLE_SIZE(NRF_BLE_SCAN_NAME_CNT)       <= UINT8_MAX);
+STATIC_ASSERT(NRF_BLE_SCAN_HASH_TABLE_SIZE(NRF_BLE_SCAN_ADDRESS_CNT)    <= UINT8_MAX);
+STATIC_ASSERT(NRF_BLE_SCAN_HASH_TABLE_SIZE(NRF_BLE_SCAN_UUID_CNT)       <= UINT8_MAX);
+STATIC_ASSERT(NRF_BLE_SCAN_HASH_TABLE_SIZE(NRF_BLE_SCAN_APPEARANCE_CNT) <= UINT8_MAX);
+
+
+/**@brief Advertising data fields used by the filters.
+ *
+ * @details As with @ref ble_advdata_search, only the first AD structure of each type is used.
+ *          A field that is not present in the report has length 0.
+ */
+typedef struct
+{
+    uint8_t const * p_name;         /**< Complete local name. */
+    uint8_t const * p_short_name;   /**< Shortened local name. */
+    uint8_t const * p_appearance;   /**< Appearance. */
+    uint8_t const * p_uuid16;       /**< List of 16-bit service UUIDs, complete if present. */
+    uint8_t const * p_uuid128;      /**< List of 128-bit service UUIDs, complete if present. */
+    uint8_t         name_len;       /**< Length of the complete local name. */
+    uint8_t         short_name_len; /**< Length of the shortened local name. */
+    uint8_t         appearance_len; /**< Length of the appearance. */
+    uint8_t         uuid16_len;     /**< Length of the 16-bit service UUID list. */
+    uint8_t         uuid128_len;    /**< Length of the 128-bit service UUID list. */
+} adv_fields_t;
+
+
+/**@brief Function for storing the first occurrence of an AD structure.
+ *
+ * @param[in,out] pp_field Field to set.
+ * @param[in,out] p_len    Length of the field. The field is only set while this is 0.
+ * @param[in]     p_value  Value of the AD structure.
+ * @param[in]     len      Length of the value.
+ */
+static __INLINE void adv_field_set(uint8_t const ** pp_field,
+                                   uint8_t        * p_len,
+                                   uint8_t const  * p_value,
+                                   uint8_t          len)
+{
+    if (*p_len == 0)
+    {
+        *pp_field = p_value;
+        *p_len    = len;
+    }
+}
+
+
+/**@brief Function for extracting all fields used by the filters from an advertising report.
+ *
+ * @details The AD structures are walked once, no matter how many filters are enabled.
+ *          Walking stops at the first AD structure with zero length, which terminates the data
+ *          early, or at the first AD structure that extends beyond the report.
+ *
+ * @param[in]  p_data   Advertising data.
+ * @param[in]  data_len Length of the advertising data.
+ * @param[out] p_fields Fields found in the advertising data.
+ */
+static void adv_fields_parse(uint8_t const * p_data, uint16_t data_len, adv_fields_t * p_fields)
+{
+    uint8_t const * p_uuid16_more    = NULL;
+    uint8_t const * p_uuid128_more   = NULL;
+    uint8_t         uuid16_more_len  = 0;
+    uint8_t         uuid128_more_len = 0;
+    uint16_t        index            = 0;
+
+    memset(p_fields, 0, sizeof(adv_fields_t));
+
+    while ((index + 1) < data_len)
+    {
+        uint8_t const field_len = p_data[index];
+
+        if (field_len == 0)
+        {
+            // Early termination, the rest of the data is padding.
+            break;
+        }
+
+        if ((index + 1 + field_len) > data_len)
+        {
+            // Malformed. Extends beyond provided data.
+            break;
+        }
+
+        uint8_t const * p_value   = &p_data[index + 2];
+        uint8_t const   value_len = field_len - 1;
+
+        if (value_len != 0)
+        {
+            switch (p_data[index + 1])
+            {
+                case BLE_GAP_AD_TYPE_COMPLETE_LOCAL_NAME:
+                    adv_field_set(&p_fields->p_name, &p_fields->name_len, p_value, value_len);
+                    break;
+
+                case BLE_GAP_AD_TYPE_SHORT_LOCAL_NAME:
+                    adv_field_set(&p_fields->p_short_name,
+                                  &p_fields->short_name_len,
+                                  p_value,
+                                  value_len);
+                    break;
+
+                case BLE_GAP_AD_TYPE_APPEARANCE:
+                    adv_field_set(&p_fields->p_appearance,
+                                  &p_fields->appearance_len,
+                                  p_value,
+                                  value_len);
+                    break;
+
+                case BLE_GAP_AD_TYPE_16BIT_SERVICE_UUID_COMPLETE:
+                    adv_field_set(&p_fields->p_uuid16, &p_fields->uuid16_len, p_value, value_len);
+                    break;
+
+                case BLE_GAP_AD_TYPE_16BIT_SERVICE_UUID_MORE_AVAILABLE:
+                    adv_field_set(&p_uuid16_more, &uuid16_more_len, p_value, value_len);
+                    break;
+
+                case BLE_GAP_AD_TYPE_128BIT_SERVICE_UUID_COMPLETE:
+                    adv_field_set(&p_fields->p_uuid128, &p_fields->uuid128_len, p_value, value_len);
+                    break;
+
+                case BLE_GAP_AD_TYPE_128BIT_SERVICE_UUID_MORE_AVAILABLE:
+                    adv_field_set(&p_uuid128_more, &uuid128_more_len, p_value, value_len);
+                    break;
+
+                default:
+                    break;
+            }
+        }
+
+        // Jump to next data.
+        index += field_len + 1;
+    }
+
+    // Like ble_advdata_uuid_find(), prefer the complete lists of UUIDs.
+    adv_field_set(&p_fields->p_uuid16, &p_fields->uuid16_len, p_uuid16_more, uuid16_more_len);
+    adv_field_set(&p_fields->p_uuid128, &p_fields->uuid128_len, p_uuid128_more, uuid128_more_len);
+}
+
+
+/**@brief Function for calculating the FNV-1a hash of a filter key.
+ *
+ * @param[in] p_data Key.
+ * @param[in] len    Length of the key.
+ *
+ * @return Hash of the key.
+ */
+static uint32_t filter_hash(uint8_t const * p_data, uint16_t len)
+{
+    uint32_t hash = FNV_OFFSET;
+
+    for (uint16_t i = 0; i < len; i++)
+    {
+        hash ^= p_data[i];
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+
+/**@brief Function for placing a filter in the lookup table of its type.
+ *
+ * @param[in,out] p_table    Lookup table.
+ * @param[in]     table_size Number of slots in the table.
+ * @param[in]     hash       Hash of the filter key.
+ * @param[in]     index      Index of the filter.
+ */
+static void filter_hash_insert(uint8_t * p_table, uint8_t table_size, uint32_t hash, uint8_t index)
+{
+    uint8_t slot = hash % table_size;
+
+    // Linear probing. The table always has more slots than filters.
+    while (p_table[slot] != 0)
+    {
+        slot = (slot + 1) % table_size;
+    }
+
+    p_table[slot] = index + 1;
+}
+
+
 #if (NRF_BLE_SCAN_ADDRESS_CNT > 0)
 
 /**@brief Function for searching for the provided address in the advertisement packets.
@@ -199,13 +390,17 @@ static bool find_peer_addr(ble_gap_evt_adv_report_t const * const p_adv_report,
 static bool adv_addr_compare(ble_gap_evt_adv_report_t const * const p_adv_report,
                              nrf_ble_scan_t const * const           p_scan_ctx)
 {
-    ble_gap_addr_t const * p_addr  = p_scan_ctx->scan_filters.addr_filter.target_addr;
-    uint8_t                counter = p_scan_ctx->scan_filters.addr_filter.addr_cnt;
-
-    for (uint8_t index = 0; index < counter; index++)
+    nrf_ble_scan_addr_filter_t const * p_addr_filter = &p_scan_ctx->scan_filters.addr_filter;
+    uint8_t const                    * p_table       = p_addr_filter->hash_table;
+    uint8_t const                      table_size    = ARRAY_SIZE(p_addr_filter->hash_table);
+    uint32_t const                     hash          =
+        filter_hash(p_adv_report->peer_addr.addr, BLE_GAP_ADDR_LEN);
+
+    // Only the filters with the same hash are compared.
+    for (uint8_t slot = hash % table_size; p_table[slot] != 0; slot = (slot + 1) % table_size)
     {
         // Search for address.
-        if (find_peer_addr(p_adv_report, &p_addr[index]))
+        if (find_peer_addr(p_adv_report, &p_addr_filter->target_addr[p_table[slot] - 1]))
         {
             return true;
         }
@@ -280,6 +475,11 @@ static ret_code_t nrf_ble_scan_addr_filter_add(nrf_ble_scan_t * const p_scan_ctx
 
     NRF_LOG_DEBUG("\n\r");
 
+    filter_hash_insert(p_scan_ctx->scan_filters.addr_filter.hash_table,
+                       ARRAY_SIZE(p_scan_ctx->scan_filters.addr_filter.hash_table),
+                       filter_hash(p_addr, BLE_GAP_ADDR_LEN),
+                       *p_counter);
+
     // Increase the address filter counter.
     *p_counter += 1;
 
@@ -293,28 +493,34 @@ static ret_code_t nrf_ble_scan_addr_filter_add(nrf_ble_scan_t * const p_scan_ctx
 #if (NRF_BLE_SCAN_NAME_CNT > 0)
 /** @brief Function for comparing the provided name with the advertised name.
  *
- * @param[in] p_adv_report    Advertising data to parse.
+ * @param[in] p_fields        Fields of the advertising report.
  * @param[in] p_scan_ctx      Pointer to the Scanning Module instance.
  *
  * @retval True when the names match. False otherwise.
  */
-static bool adv_name_compare(ble_gap_evt_adv_report_t const * p_adv_report,
-                             nrf_ble_scan_t     const * const p_scan_ctx)
+static bool adv_name_compare(adv_fields_t   const *       p_fields,
+                             nrf_ble_scan_t const * const p_scan_ctx)
 {
     nrf_ble_scan_name_filter_t const * p_name_filter = &p_scan_ctx->scan_filters.name_filter;
-    uint8_t                            counter       =
-        p_scan_ctx->scan_filters.name_filter.name_cnt;
-    uint8_t  index;
-    uint16_t data_len;
+    uint8_t const                    * p_table       = p_name_filter->hash_table;
+    uint8_t const                      table_size    = ARRAY_SIZE(p_name_filter->hash_table);
+    uint32_t                           hash;
+
+    if (p_fields->name_len == 0)
+    {
+        return false;
+    }
 
-    data_len = p_adv_report->data.len;
+    hash = filter_hash(p_fields->p_name, p_fields->name_len);
 
-    // Compare the name found with the name filter.
-    for (index = 0; index < counter; index++)
+    // Compare the name found with the name filters that have the same hash.
+    for (uint8_t slot = hash % table_size; p_table[slot] != 0; slot = (slot + 1) % table_size)
     {
-        if (ble_advdata_name_find(p_adv_report->data.p_data,
-                                  data_len,
-                                  p_name_filter->target_name[index]))
+        uint8_t const index = p_table[slot] - 1;
+
+        if ((p_name_filter->name_hash[index] == hash) &&
+            (p_name_filter->name_len[index] == p_fields->name_len) &&
+            (memcmp(p_name_filter->target_name[index], p_fields->p_name, p_fields->name_len) == 0))
         {
             return true;
         }
@@ -363,9 +569,17 @@ static ret_code_t nrf_ble_scan_name_filter_add(nrf_ble_scan_t * const p_scan_ctx
     }
 
     // Add name to filter.
-    memcpy(p_scan_ctx->scan_filters.name_filter.target_name[(*counter)++],
-           p_name,
-           strlen(p_name));
+    nrf_ble_scan_name_filter_t * p_name_filter = &p_scan_ctx->scan_filters.name_filter;
+    uint32_t const               hash          = filter_hash((uint8_t const *)p_name, name_len);
+
+    memcpy(p_name_filter->target_name[*counter], p_name, name_len);
+    p_name_filter->name_hash[*counter] = hash;
+    p_name_filter->name_len[*counter]  = name_len;
+    filter_hash_insert(p_name_filter->hash_table,
+                       ARRAY_SIZE(p_name_filter->hash_table),
+                       hash,
+                       *counter);
+    (*counter)++;
 
     NRF_LOG_DEBUG("Adding filter on %s name", p_name);
 
@@ -379,29 +593,37 @@ static ret_code_t nrf_ble_scan_name_filter_add(nrf_ble_scan_t * const p_scan_ctx
 #if (NRF_BLE_SCAN_SHORT_NAME_CNT > 0)
 /** @brief Function for comparing the provided short name with the advertised short name.
  *
- * @param[in] p_adv_report    Advertising data to parse.
+ * @details The advertised short name matches when it is a prefix of a filter name that is at least
+ *          as long as the minimum length of the filter. Prefix matches cannot be hashed, so the
+ *          filters are compared one by one, but against the already extracted field.
+ *
+ * @param[in] p_fields        Fields of the advertising report.
  * @param[in] p_scan_ctx      Pointer to the Scanning Module instance.
  *
  * @retval True when the names match. False otherwise.
  */
-static bool adv_short_name_compare(ble_gap_evt_adv_report_t const * const p_adv_report,
-                                   nrf_ble_scan_t           const * const p_scan_ctx)
+static bool adv_short_name_compare(adv_fields_t   const *       p_fields,
+                                   nrf_ble_scan_t const * const p_scan_ctx)
 {
     nrf_ble_scan_short_name_filter_t const * p_name_filter =
         &p_scan_ctx->scan_filters.short_name_filter;
-    uint8_t  counter = p_scan_ctx->scan_filters.short_name_filter.name_cnt;
-    uint8_t  index;
-    uint16_t data_len;
+    uint8_t       counter  = p_scan_ctx->scan_filters.short_name_filter.name_cnt;
+    uint8_t const data_len = p_fields->short_name_len;
+    uint8_t       index;
 
-    data_len = p_adv_report->data.len;
+    if (data_len == 0)
+    {
+        return false;
+    }
 
     // Compare the name found with the name filters.
     for (index = 0; index < counter; index++)
     {
-        if (ble_advdata_short_name_find(p_adv_report->data.p_data,
-                                        data_len,
-                                        p_name_filter->short_name[index].short_target_name,
-                                        p_name_filter->short_name[index].short_name_min_len))
+        if ((data_len >= p_name_filter->short_name[index].short_name_min_len) &&
+            (data_len < p_name_filter->short_name[index].short_name_len) &&
+            (memcmp(p_name_filter->short_name[index].short_target_name,
+                    p_fields->p_short_name,
+                    data_len) == 0))
         {
             return true;
         }
@@ -456,9 +678,10 @@ static ret_code_t nrf_ble_scan_short_name_filter_add(nrf_ble_scan_t            *
     // Add name to the filter.
     p_short_name_filter->short_name[(*p_counter)].short_name_min_len =
         p_short_name->short_name_min_len;
+    p_short_name_filter->short_name[(*p_counter)].short_name_len = name_len;
     memcpy(p_short_name_filter->short_name[(*p_counter)++].short_target_name,
            p_short_name->p_short_name,
-           strlen(p_short_name->p_short_name));
+           name_len);
 
     NRF_LOG_DEBUG("Adding filter on %s name", p_short_name->p_short_name);
 
@@ -470,54 +693,68 @@ static ret_code_t nrf_ble_scan_short_name_filter_add(nrf_ble_scan_t            *
 
 
 #if (NRF_BLE_SCAN_UUID_CNT > 0)
-/**@brief Function for comparing the provided UUID with the UUID in the advertisement packets.
- *
- * @param[in]   p_adv_report   Advertising data to parse.
- * @param[in]   p_scan_ctx     Pointer to the Scanning Module instance.
+/**@brief Function for looking up the UUIDs of a service UUID list in the UUID filters.
  *
- * @return      True if the UUIDs match. False otherwise.
+ * @param[in]     p_uuid_filter UUID filters.
+ * @param[in]     p_list        List of UUIDs from the advertising report.
+ * @param[in]     list_len      Length of the list.
+ * @param[in]     uuid_len      Size of each UUID in the list.
+ * @param[in,out] p_match_mask  Mask of the filters that were found. Bit n is set for filter n.
  */
-static bool adv_uuid_compare(ble_gap_evt_adv_report_t const * const p_adv_report,
-                             nrf_ble_scan_t           const * const p_scan_ctx)
+static void uuid_list_match(nrf_ble_scan_uuid_filter_t const * p_uuid_filter,
+                            uint8_t                    const * p_list,
+                            uint8_t                            list_len,
+                            uint8_t                            uuid_len,
+                            uint32_t                         * p_match_mask)
 {
-    nrf_ble_scan_uuid_filter_t const * p_uuid_filter    = &p_scan_ctx->scan_filters.uuid_filter;
-    bool const                         all_filters_mode = p_scan_ctx->scan_filters.all_filters_mode;
-    uint8_t const                      counter          =
-        p_scan_ctx->scan_filters.uuid_filter.uuid_cnt;
-    uint8_t  index;
-    uint16_t data_len;
-    uint8_t  uuid_match_cnt = 0;
-
-    data_len = p_adv_report->data.len;
+    uint8_t const * p_table    = p_uuid_filter->hash_table;
+    uint8_t const   table_size = ARRAY_SIZE(p_uuid_filter->hash_table);
+    uint8_t const   alias      = (uuid_len == UUID128_SIZE) ? UUID128_ALIAS : 0;
 
-    for (index = 0; index < counter; index++)
+    for (uint16_t list_offset = 0; (list_offset + uuid_len) <= list_len; list_offset += uuid_len)
     {
+        uint8_t const * p_uuid = &p_list[list_offset];
+        uint16_t const  hash   = uint16_decode(&p_uuid[alias]);
 
-        if (ble_advdata_uuid_find(p_adv_report->data.p_data,
-                                  data_len,
-                                  &p_uuid_filter->uuid[index]))
+        // Only the filters with the same 16-bit UUID value are compared.
+        for (uint8_t slot = hash % table_size; p_table[slot] != 0; slot = (slot + 1) % table_size)
         {
-            uuid_match_cnt++;
+            uint8_t const index = p_table[slot] - 1;
 
-            // In the normal filter mode, only one UUID is needed to match.
-            if (!all_filters_mode)
+            if ((p_uuid_filter->uuid_raw_len[index] == uuid_len) &&
+                (memcmp(p_uuid_filter->uuid_raw[index], p_uuid, uuid_len) == 0))
             {
-                break;
+                *p_match_mask |= (1UL << index);
             }
         }
-        else if (all_filters_mode)
-        {
-            break;
-        }
-        else
-        {
-            // Do nothing.
-        }
     }
+}
+
+
+/**@brief Function for comparing the provided UUID with the UUID in the advertisement packets.
+ *
+ * @param[in]   p_fields       Fields of the advertising report.
+ * @param[in]   p_scan_ctx     Pointer to the Scanning Module instance.
+ *
+ * @return      True if the UUIDs match. False otherwise.
+ */
+static bool adv_uuid_compare(adv_fields_t   const *       p_fields,
+                             nrf_ble_scan_t const * const p_scan_ctx)
+{
+    nrf_ble_scan_uuid_filter_t const * p_uuid_filter    = &p_scan_ctx->scan_filters.uuid_filter;
+    bool const                         all_filters_mode = p_scan_ctx->scan_filters.all_filters_mode;
+    uint8_t const                      counter          =
+        p_scan_ctx->scan_filters.uuid_filter.uuid_cnt;
+    uint32_t const                     all_mask         =
+        (counter == 0) ? 0 : (UINT32_MAX >> (32 - counter));
+    uint32_t                           match_mask       = 0;
+
+    uuid_list_match(p_uuid_filter, p_fields->p_uuid16, p_fields->uuid16_len, UUID16_SIZE, &match_mask);
+    uuid_list_match(p_uuid_filter, p_fields->p_uuid128, p_fields->uuid128_len, UUID128_SIZE, &match_mask);
 
     // In the multifilter mode, all UUIDs must be found in the advertisement packets.
-    if ((all_filters_mode && (uuid_match_cnt == counter)) ||
-        ((!all_filters_mode) && (uuid_match_cnt > 0)))
+    if ((all_filters_mode && (match_mask == all_mask)) ||
+        ((!all_filters_mode) && (match_mask != 0)))
     {
         return true;
     }
@@ -556,6 +793,24 @@ static ret_code_t nrf_ble_scan_uuid_filter_add(nrf_ble_scan_t * const p_scan_ctx
         }
     }
 
+    nrf_ble_scan_uuid_filter_t * p_filter = &p_scan_ctx->scan_filters.uuid_filter;
+    uint8_t                      raw_len  = sizeof(p_filter->uuid_raw[0]);
+    ret_code_t                   err_code;
+
+    // Encode the UUID the way it is advertised.
+    err_code = sd_ble_uuid_encode(p_uuid, &raw_len, p_filter->uuid_raw[*p_counter]);
+    if ((err_code != NRF_SUCCESS) || ((raw_len != UUID16_SIZE) && (raw_len != UUID128_SIZE)))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    p_filter->uuid_raw_len[*p_counter] = raw_len;
+    filter_hash_insert(p_filter->hash_table,
+                       ARRAY_SIZE(p_filter->hash_table),
+                       uint16_decode(&p_filter->uuid_raw[*p_counter][(raw_len == UUID128_SIZE) ?
+                                                                     UUID128_ALIAS : 0]),
+                       *p_counter);
+
     // Add UUID to the filter.
     p_uuid_filter[(*p_counter)++] = *p_uuid;
     NRF_LOG_DEBUG("Added filter on UUID %x", p_uuid->uuid);
@@ -570,29 +825,31 @@ static ret_code_t nrf_ble_scan_uuid_filter_add(nrf_ble_scan_t * const p_scan_ctx
 #if (NRF_BLE_SCAN_APPEARANCE_CNT)
 /**@brief Function for comparing the provided appearance with the appearance in the advertisement packets.
  *
- * @param[in]     p_adv_report Advertising data to parse.
+ * @param[in]     p_fields     Fields of the advertising report.
  * @param[in,out] p_scan_ctx   Pointer to the Scanning Module instance.
  *
  * @return      True if the appearances match. False otherwise.
  */
-static bool adv_appearance_compare(ble_gap_evt_adv_report_t const * const p_adv_report,
-                                   nrf_ble_scan_t           const * const p_scan_ctx)
+static bool adv_appearance_compare(adv_fields_t   const *       p_fields,
+                                   nrf_ble_scan_t const * const p_scan_ctx)
 {
     nrf_ble_scan_appearance_filter_t const * p_appearance_filter =
         &p_scan_ctx->scan_filters.appearance_filter;
-    uint8_t const counter =
-        p_scan_ctx->scan_filters.appearance_filter.appearance_cnt;
-    uint8_t  index;
-    uint16_t data_len;
+    uint8_t const * p_table    = p_appearance_filter->hash_table;
+    uint8_t const   table_size = ARRAY_SIZE(p_appearance_filter->hash_table);
+    uint16_t        appearance;
 
-    data_len = p_adv_report->data.len;
+    if (p_fields->appearance_len < sizeof(uint16_t))
+    {
+        return false;
+    }
+
+    appearance = uint16_decode(p_fields->p_appearance);
 
     // Verify if the advertised appearance matches the provided appearance.
-    for (index = 0; index < counter; index++)
+    for (uint8_t slot = appearance % table_size; p_table[slot] != 0; slot = (slot + 1) % table_size)
     {
-        if (ble_advdata_appearance_find(p_adv_report->data.p_data,
-                                        data_len,
-                                        &p_appearance_filter->appearance[index]))
+        if (p_appearance_filter->appearance[p_table[slot] - 1] == appearance)
         {
             return true;
         }
@@ -633,6 +890,10 @@ static ret_code_t nrf_ble_scan_appearance_filter_add(nrf_ble_scan_t * const p_sc
     }
 
     // Add appearance to the filter.
+    filter_hash_insert(p_scan_ctx->scan_filters.appearance_filter.hash_table,
+                       ARRAY_SIZE(p_scan_ctx->scan_filters.appearance_filter.hash_table),
+                       appearance,
+                       *p_counter);
     p_appearance_filter[(*p_counter)++] = appearance;
     NRF_LOG_DEBUG("Added filter on appearance %x", appearance);
     return NRF_SUCCESS;
@@ -702,6 +963,9 @@ ret_code_t nrf_ble_scan_all_filter_remove(nrf_ble_scan_t * const p_scan_ctx)
 #if (NRF_BLE_SCAN_NAME_CNT > 0)
     nrf_ble_scan_name_filter_t * p_name_filter = &p_scan_ctx->scan_filters.name_filter;
     memset(p_name_filter->target_name, 0, sizeof(p_name_filter->target_name));
+    memset(p_name_filter->name_hash, 0, sizeof(p_name_filter->name_hash));
+    memset(p_name_filter->name_len, 0, sizeof(p_name_filter->name_len));
+    memset(p_name_filter->hash_table, 0, sizeof(p_name_filter->hash_table));
     p_name_filter->name_cnt = 0;
 #endif
 
@@ -715,12 +979,16 @@ ret_code_t nrf_ble_scan_all_filter_remove(nrf_ble_scan_t * const p_scan_ctx)
 #if (NRF_BLE_SCAN_ADDRESS_CNT > 0)
     nrf_ble_scan_addr_filter_t * p_addr_filter = &p_scan_ctx->scan_filters.addr_filter;
     memset(p_addr_filter->target_addr, 0, sizeof(p_addr_filter->target_addr));
+    memset(p_addr_filter->hash_table, 0, sizeof(p_addr_filter->hash_table));
     p_addr_filter->addr_cnt = 0;
 #endif
 
 #if (NRF_BLE_SCAN_UUID_CNT > 0)
     nrf_ble_scan_uuid_filter_t * p_uuid_filter = &p_scan_ctx->scan_filters.uuid_filter;
     memset(p_uuid_filter->uuid, 0, sizeof(p_uuid_filter->uuid));
+    memset(p_uuid_filter->uuid_raw, 0, sizeof(p_uuid_filter->uuid_raw));
+    memset(p_uuid_filter->uuid_raw_len, 0, sizeof(p_uuid_filter->uuid_raw_len));
+    memset(p_uuid_filter->hash_table, 0, sizeof(p_uuid_filter->hash_table));
     p_uuid_filter->uuid_cnt = 0;
 #endif
 
@@ -728,6 +996,7 @@ ret_code_t nrf_ble_scan_all_filter_remove(nrf_ble_scan_t * const p_scan_ctx)
     nrf_ble_scan_appearance_filter_t * p_appearance_filter =
         &p_scan_ctx->scan_filters.appearance_filter;
     memset(p_appearance_filter->appearance, 0, sizeof(p_appearance_filter->appearance));
+    memset(p_appearance_filter->hash_table, 0, sizeof(p_appearance_filter->hash_table));
     p_appearance_filter->appearance_cnt = 0;
 #endif
 
@@ -905,6 +1174,10 @@ static void nrf_ble_scan_on_adv_report(nrf_ble_scan_t           const * const p_
         p_scan_ctx->scan_filters.appearance_filter.appearance_filter_enabled;
 #endif
 
+    // Extract the advertising data fields once for all enabled filters.
+    adv_fields_t adv_fields;
+
+    adv_fields_parse(p_adv_report->data.p_data, p_adv_report->data.len, &adv_fields);
 
 #if (NRF_BLE_SCAN_ADDRESS_CNT > 0)
     // Check the address filter.
@@ -928,7 +1201,7 @@ static void nrf_ble_scan_on_adv_report(nrf_ble_scan_t           const * const p_
     if (name_filter_enabled)
     {
         filter_cnt++;
-        if (adv_name_compare(p_adv_report, p_scan_ctx))
+        if (adv_name_compare(&adv_fields, p_scan_ctx))
         {
             filter_match_cnt++;
 
@@ -943,7 +1216,7 @@ static void nrf_ble_scan_on_adv_report(nrf_ble_scan_t           const * const p_
     if (short_name_filter_enabled)
     {
         filter_cnt++;
-        if (adv_short_name_compare(p_adv_report, p_scan_ctx))
+        if (adv_short_name_compare(&adv_fields, p_scan_ctx))
         {
             filter_match_cnt++;
 
@@ -959,7 +1232,7 @@ static void nrf_ble_scan_on_adv_report(nrf_ble_scan_t           const * const p_
     if (uuid_filter_enabled)
     {
         filter_cnt++;
-        if (adv_uuid_compare(p_adv_report, p_scan_ctx))
+        if (adv_uuid_compare(&adv_fields, p_scan_ctx))
         {
             filter_match_cnt++;
             // Information about the filters matched.
@@ -974,7 +1247,7 @@ static void nrf_ble_scan_on_adv_report(nrf_ble_scan_t           const * const p_
     if (appearance_filter_enabled)
     {
         filter_cnt++;
-        if (adv_appearance_compare(p_adv_report, p_scan_ctx))
+        if (adv_appearance_compare(&adv_fields, p_scan_ctx))
         {
             filter_match_cnt++;
             // Information about the filters matched.
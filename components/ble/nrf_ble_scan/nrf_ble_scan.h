@@ -208,11 +208,21 @@ typedef void (*nrf_ble_scan_evt_handler_t)(scan_evt_t const * p_scan_evt);
 
 #if (NRF_BLE_SCAN_FILTER_ENABLE == 1)
 
+/**@brief Size of the table used to look up the filters of one type.
+ *
+ * @details Filters are compiled into an open addressing hash table when they are set. The table
+ *          always has more empty slots than filters, so that every lookup terminates.
+ */
+#define NRF_BLE_SCAN_HASH_TABLE_SIZE(_cnt) ((2 * (_cnt)) + 1)
+
 #if (NRF_BLE_SCAN_NAME_CNT > 0)
 typedef struct
 {
-    char    target_name[NRF_BLE_SCAN_NAME_CNT][NRF_BLE_SCAN_NAME_MAX_LEN]; /**< Names that the main application will scan for, and that will be advertised by the peripherals. */
-    uint8_t name_cnt;                                                      /**< Name filter counter. */
+    char     target_name[NRF_BLE_SCAN_NAME_CNT][NRF_BLE_SCAN_NAME_MAX_LEN];          /**< Names that the main application will scan for, and that will be advertised by the peripherals. */
+    uint32_t name_hash[NRF_BLE_SCAN_NAME_CNT];                                      /**< Hashes of the names. */
+    uint8_t  name_len[NRF_BLE_SCAN_NAME_CNT];                                       /**< Lengths of the names. */
+    uint8_t  hash_table[NRF_BLE_SCAN_HASH_TABLE_SIZE(NRF_BLE_SCAN_NAME_CNT)];       /**< Name filter indexes, plus one, placed by name hash. Zero marks an empty slot. */
+    uint8_t  name_cnt;                                                              /**< Name filter counter. */
     bool    name_filter_enabled;                                           /**< Flag to inform about enabling or disabling this filter. */
 } nrf_ble_scan_name_filter_t;
 #endif
@@ -224,6 +234,7 @@ typedef struct
     {
         char    short_target_name[NRF_BLE_SCAN_SHORT_NAME_MAX_LEN]; /**< Short names that the main application will scan for, and that will be advertised by the peripherals. */
         uint8_t short_name_min_len;                                 /**< Minimum length of the short name. */
+        uint8_t short_name_len;                                     /**< Length of the short name. */
     } short_name[NRF_BLE_SCAN_SHORT_NAME_CNT];
     uint8_t name_cnt;                                               /**< Short name filter counter. */
     bool    short_name_filter_enabled;                              /**< Flag to inform about enabling or disabling this filter. */
@@ -233,8 +244,9 @@ typedef struct
 #if (NRF_BLE_SCAN_ADDRESS_CNT > 0)
 typedef struct
 {
-    ble_gap_addr_t target_addr[NRF_BLE_SCAN_ADDRESS_CNT]; /**< Addresses in the same format as the format used by the SoftDevice that the main application will scan for, and that will be advertised by the peripherals. */
-    uint8_t        addr_cnt;                              /**< Address filter counter. */
+    ble_gap_addr_t target_addr[NRF_BLE_SCAN_ADDRESS_CNT];                               /**< Addresses in the same format as the format used by the SoftDevice that the main application will scan for, and that will be advertised by the peripherals. */
+    uint8_t        hash_table[NRF_BLE_SCAN_HASH_TABLE_SIZE(NRF_BLE_SCAN_ADDRESS_CNT)]; /**< Address filter indexes, plus one, placed by address hash. Zero marks an empty slot. */
+    uint8_t        addr_cnt;                                                            /**< Address filter counter. */
     bool           addr_filter_enabled;                   /**< Flag to inform about enabling or disabling this filter. */
 } nrf_ble_scan_addr_filter_t;
 #endif
@@ -242,8 +254,11 @@ typedef struct
 #if (NRF_BLE_SCAN_UUID_CNT > 0)
 typedef struct
 {
-    ble_uuid_t uuid[NRF_BLE_SCAN_UUID_CNT]; /**< UUIDs that the main application will scan for, and that will be advertised by the peripherals. */
-    uint8_t    uuid_cnt;                    /**< UUID filter counter. */
+    ble_uuid_t uuid[NRF_BLE_SCAN_UUID_CNT];                                     /**< UUIDs that the main application will scan for, and that will be advertised by the peripherals. */
+    uint8_t    uuid_raw[NRF_BLE_SCAN_UUID_CNT][16];                             /**< UUIDs encoded as they appear in the advertising data. */
+    uint8_t    uuid_raw_len[NRF_BLE_SCAN_UUID_CNT];                             /**< Length of the encoded UUIDs, 2 or 16 bytes. */
+    uint8_t    hash_table[NRF_BLE_SCAN_HASH_TABLE_SIZE(NRF_BLE_SCAN_UUID_CNT)]; /**< UUID filter indexes, plus one, placed by the 16-bit UUID value. Zero marks an empty slot. */
+    uint8_t    uuid_cnt;                                                        /**< UUID filter counter. */
     bool       uuid_filter_enabled;         /**< Flag to inform about enabling or disabling this filter. */
 } nrf_ble_scan_uuid_filter_t;
 #endif
@@ -251,8 +266,9 @@ typedef struct
 #if (NRF_BLE_SCAN_APPEARANCE_CNT > 0)
 typedef struct
 {
-    uint16_t appearance[NRF_BLE_SCAN_APPEARANCE_CNT]; /**< Apperances that the main application will scan for, and that will be advertised by the peripherals. */
-    uint8_t  appearance_cnt;                          /**< Appearance filter counter. */
+    uint16_t appearance[NRF_BLE_SCAN_APPEARANCE_CNT];                                 /**< Apperances that the main application will scan for, and that will be advertised by the peripherals. */
+    uint8_t  hash_table[NRF_BLE_SCAN_HASH_TABLE_SIZE(NRF_BLE_SCAN_APPEARANCE_CNT)]; /**< Appearance filter indexes, plus one, placed by appearance value. Zero marks an empty slot. */
+    uint8_t  appearance_cnt;                                                          /**< Appearance filter counter. */
     bool     appearance_filter_enabled;               /**< Flag to inform about enabling or disabling this filter. */
 } nrf_ble_scan_appearance_filter_t;
 #endif
@@ -413,6 +429,9 @@ ret_code_t nrf_ble_scan_filter_get(nrf_ble_scan_t   * const p_scan_ctx,
  *          The filter will be added if the number of filters of a given type does not exceed @ref NRF_BLE_SCAN_UUID_CNT,
  *          @ref NRF_BLE_SCAN_NAME_CNT, @ref NRF_BLE_SCAN_ADDRESS_CNT, or @ref NRF_BLE_SCAN_APPEARANCE_CNT, depending on the filter type,
  *          and if the same filter has not already been set.
+ *          The filter is compiled into the lookup tables of its type here, so that matching an
+ *          advertising report does not depend on the number of filters. A vendor-specific UUID
+ *          filter can therefore only be added after its base UUID is registered.
  *
  * @param[in,out] p_scan_ctx        Pointer to the Scanning Module instance.
  * @param[in]     type              Filter type.
@@ -423,6 +442,7 @@ ret_code_t nrf_ble_scan_filter_get(nrf_ble_scan_t   * const p_scan_ctx,
  * @retval NRF_ERROR_DATA_SIZE            If the name filter length is too long. Maximum name filter length corresponds to @ref NRF_BLE_SCAN_NAME_MAX_LEN.
  * @retval NRF_ERROR_NO_MEMORY            If the number of available filters is exceeded.
  * @retval NRF_ERROR_INVALID_PARAM        If the filter type is incorrect. Available filter types: @ref nrf_ble_scan_filter_type_t.
+ *                                        Also returned if the UUID filter cannot be encoded by the SoftDevice.
  * @retval BLE_ERROR_GAP_INVALID_BLE_ADDR If the BLE address type is invalid.
  */
 ret_code_t nrf_ble_scan_filter_set(nrf_ble_scan_t     * const p_scan_ctx,
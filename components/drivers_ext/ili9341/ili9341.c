@@ -43,9 +43,8 @@
 #if NRF_MODULE_ENABLED(ILI9341)
 
 #include "nrf_lcd.h"
-#include "nrf_drv_spi.h"
+#include "lcd_spi.h"
 #include "nrf_delay.h"
-#include "nrf_gpio.h"
 #include "boards.h"
 
 // Set of commands described in ILI9341 datasheet.
@@ -121,23 +120,29 @@
 #define ILI9341_MADCTL_BGR 0x08
 #define ILI9341_MADCTL_MH  0x04
 
-static const nrf_drv_spi_t spi = NRF_DRV_SPI_INSTANCE(ILI9341_SPI_INSTANCE);
+#define ILI9341_BITMAP_CHUNK_SIZE   127 // Pixels converted at a time, fills one transfer queue slot.
 
-static inline void spi_write(const void * data, size_t size)
-{
-    APP_ERROR_CHECK(nrf_drv_spi_transfer(&spi, data, size, NULL, 0));
-}
+#ifndef ILI9341_QUEUE_SIZE
+#define ILI9341_QUEUE_SIZE 8 // Number of SPI transactions that can be queued.
+#endif
+
+LCD_SPI_DEF(m_lcd_spi, ILI9341_QUEUE_SIZE, ILI9341_SPI_INSTANCE, ILI9341_DC_PIN);
 
 static inline void write_command(uint8_t c)
 {
-    nrf_gpio_pin_clear(ILI9341_DC_PIN);
-    spi_write(&c, sizeof(c));
+    lcd_spi_command_write(&m_lcd_spi, c);
 }
 
 static inline void write_data(uint8_t c)
 {
-    nrf_gpio_pin_set(ILI9341_DC_PIN);
-    spi_write(&c, sizeof(c));
+    lcd_spi_data_write(&m_lcd_spi, &c, sizeof(c));
+}
+
+static void delay_ms(uint32_t ms)
+{
+    // Delays in the command list count from the moment the preceding commands were sent.
+    lcd_spi_wait(&m_lcd_spi);
+    nrf_delay_ms(ms);
 }
 
 static void set_addr_window(uint16_t x_0, uint16_t y_0, uint16_t x_1, uint16_t y_1)
@@ -161,9 +166,9 @@ static void set_addr_window(uint16_t x_0, uint16_t y_0, uint16_t x_1, uint16_t y
 static void command_list(void)
 {
     write_command(ILI9341_SWRESET);
-    nrf_delay_ms(120);
+    delay_ms(120);
     write_command(ILI9341_DISPOFF);
-    nrf_delay_ms(120);
+    delay_ms(120);
     write_command(ILI9341_PWCTRB);
     write_data(0x00);
     write_data(0XC1);
@@ -257,7 +262,7 @@ static void command_list(void)
     write_data(0x0F);
 
     write_command(ILI9341_SLPOUT);
-    nrf_delay_ms(120);
+    delay_ms(120);
     write_command(ILI9341_DISPON);
 }
 
@@ -265,8 +270,6 @@ static ret_code_t hardware_init(void)
 {
     ret_code_t err_code;
 
-    nrf_gpio_cfg_output(ILI9341_DC_PIN);
-
     nrf_drv_spi_config_t spi_config = NRF_DRV_SPI_DEFAULT_CONFIG;
 
     spi_config.sck_pin  = ILI9341_SCK_PIN;
@@ -274,7 +277,7 @@ static ret_code_t hardware_init(void)
     spi_config.mosi_pin = ILI9341_MOSI_PIN;
     spi_config.ss_pin   = ILI9341_SS_PIN;
 
-    err_code = nrf_drv_spi_init(&spi, &spi_config, NULL, NULL);
+    err_code = lcd_spi_init(&m_lcd_spi, &spi_config);
     return err_code;
 }
 
@@ -289,13 +292,14 @@ static ret_code_t ili9341_init(void)
     }
 
     command_list();
+    lcd_spi_commit(&m_lcd_spi);
 
     return err_code;
 }
 
 static void ili9341_uninit(void)
 {
-    nrf_drv_spi_uninit(&spi);
+    lcd_spi_uninit(&m_lcd_spi);
 }
 
 static void ili9341_pixel_draw(uint16_t x, uint16_t y, uint32_t color)
@@ -304,11 +308,8 @@ static void ili9341_pixel_draw(uint16_t x, uint16_t y, uint32_t color)
 
     const uint8_t data[2] = {color >> 8, color};
 
-    nrf_gpio_pin_set(ILI9341_DC_PIN);
-
-    spi_write(data, sizeof(data));
-
-    nrf_gpio_pin_clear(ILI9341_DC_PIN);
+    lcd_spi_data_write(&m_lcd_spi, data, sizeof(data));
+    lcd_spi_commit(&m_lcd_spi);
 }
 
 static void ili9341_rect_draw(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint32_t color)
@@ -317,37 +318,36 @@ static void ili9341_rect_draw(uint16_t x, uint16_t y, uint16_t width, uint16_t h
 
     const uint8_t data[2] = {color >> 8, color};
 
-    nrf_gpio_pin_set(ILI9341_DC_PIN);
-
-    // Duff's device algorithm for optimizing loop.
-    uint32_t i = (height * width + 7) / 8;
-
-/*lint -save -e525 -e616 -e646 */
-    switch ((height * width) % 8) {
-        case 0:
-            do {
-                spi_write(data, sizeof(data));
-        case 7:
-                spi_write(data, sizeof(data));
-        case 6:
-                spi_write(data, sizeof(data));
-        case 5:
-                spi_write(data, sizeof(data));
-        case 4:
-                spi_write(data, sizeof(data));
-        case 3:
-                spi_write(data, sizeof(data));
-        case 2:
-                spi_write(data, sizeof(data));
-        case 1:
-                spi_write(data, sizeof(data));
-            } while (--i > 0);
-        default:
-            break;
+    lcd_spi_fill(&m_lcd_spi, data, (uint32_t)width * height);
+}
+
+static void ili9341_bitmap_draw(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t const * p_data)
+{
+    uint8_t  data[2 * ILI9341_BITMAP_CHUNK_SIZE];
+    uint32_t count = (uint32_t)width * height;
+
+    set_addr_window(x, y, x + width - 1, y + height - 1);
+
+    // Pixels are converted to the bus byte order in chunks and copied to the transfer queue.
+    while (count > 0)
+    {
+        uint32_t chunk = MIN(count, ILI9341_BITMAP_CHUNK_SIZE);
+
+        for (uint32_t i = 0; i < chunk; i++)
+        {
+            uint16_t pixel = p_data[i];
+
+            data[2 * i]     = pixel >> 8;
+            data[2 * i + 1] = pixel;
+        }
+
+        lcd_spi_data_write(&m_lcd_spi, data, 2 * chunk);
+
+        p_data += chunk;
+        count  -= chunk;
     }
-/*lint -restore */
 
-    nrf_gpio_pin_clear(ILI9341_DC_PIN);
+    lcd_spi_commit(&m_lcd_spi);
 }
 
 static void ili9341_dummy_display(void)
@@ -374,6 +374,8 @@ static void ili9341_rotation_set(nrf_lcd_rotation_t rotation)
         default:
             break;
     }
+
+    lcd_spi_commit(&m_lcd_spi);
 }
 
 static void ili9341_display_invert(bool invert)
@@ -381,6 +383,11 @@ static void ili9341_display_invert(bool invert)
     write_command(invert ? ILI9341_INVON : ILI9341_INVOFF);
 }
 
+static void ili9341_done_handler_set(nrf_lcd_done_handler_t handler)
+{
+    lcd_spi_done_handler_set(&m_lcd_spi, handler);
+}
+
 static lcd_cb_t ili9341_cb = {
     .height = ILI9341_HEIGHT,
     .width = ILI9341_WIDTH
@@ -392,9 +399,11 @@ const nrf_lcd_t nrf_lcd_ili9341 = {
     .lcd_uninit = ili9341_uninit,
     .lcd_pixel_draw = ili9341_pixel_draw,
     .lcd_rect_draw = ili9341_rect_draw,
+    .lcd_bitmap_draw = ili9341_bitmap_draw,
     .lcd_display = ili9341_dummy_display,
     .lcd_rotation_set = ili9341_rotation_set,
     .lcd_display_invert = ili9341_display_invert,
+    .lcd_done_handler_set = ili9341_done_handler_set,
     .p_lcd_cb = &ili9341_cb
 };
 
@@ -0,0 +1,256 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+
+#if NRF_MODULE_ENABLED(ILI9341) || NRF_MODULE_ENABLED(ST7735)
+
+#include "lcd_spi.h"
+#include "nrf_gpio.h"
+#include "app_util_platform.h"
+#include "nrf_assert.h"
+
+static void command_begin(void * p_user_data)
+{
+    lcd_spi_t const * p_lcd_spi = p_user_data;
+
+    nrf_gpio_pin_clear(p_lcd_spi->dc_pin);
+}
+
+static void data_begin(void * p_user_data)
+{
+    lcd_spi_t const * p_lcd_spi = p_user_data;
+
+    nrf_gpio_pin_set(p_lcd_spi->dc_pin);
+}
+
+static void transaction_end(ret_code_t result, void * p_user_data)
+{
+    lcd_spi_t const * p_lcd_spi = p_user_data;
+
+    APP_ERROR_CHECK(result);
+
+    // Transactions finish in the order of their slots, so freeing a slot only needs a counter.
+    p_lcd_spi->p_cb->used--;
+
+    if ((p_lcd_spi->p_cb->used == 0) && (p_lcd_spi->p_cb->handler != NULL))
+    {
+        p_lcd_spi->p_cb->handler();
+    }
+}
+
+static lcd_spi_slot_t * slot_alloc(lcd_spi_t const * p_lcd_spi)
+{
+    lcd_spi_cb_t * p_cb = p_lcd_spi->p_cb;
+
+    if (p_cb->used == p_lcd_spi->slot_count)
+    {
+        // An interrupt at or above the SPI priority would wait forever.
+        ASSERT(current_int_priority_get() == APP_IRQ_PRIORITY_THREAD);
+    }
+    while (p_cb->used == p_lcd_spi->slot_count)
+    {
+        // Sleep until a transfer finishes and frees a slot.
+        __WFE();
+    }
+
+    lcd_spi_slot_t * p_slot = &p_lcd_spi->p_slots[p_cb->head];
+
+    p_cb->head = (p_cb->head + 1) % p_lcd_spi->slot_count;
+
+    CRITICAL_REGION_ENTER();
+    p_cb->used++;
+    CRITICAL_REGION_EXIT();
+
+    p_slot->length = 0;
+
+    return p_slot;
+}
+
+static void slot_schedule(lcd_spi_t const * p_lcd_spi,
+                          lcd_spi_slot_t * p_slot,
+                          nrf_spi_mngr_callback_begin_t begin_callback,
+                          uint8_t number_of_transfers)
+{
+    p_slot->transaction.begin_callback      = begin_callback;
+    p_slot->transaction.end_callback        = transaction_end;
+    p_slot->transaction.p_user_data         = (void *)p_lcd_spi;
+    p_slot->transaction.p_transfers         = p_slot->transfers;
+    p_slot->transaction.number_of_transfers = number_of_transfers;
+    p_slot->transaction.p_required_spi_cfg  = NULL;
+
+    // The queue has room for all slots, so scheduling cannot fail.
+    APP_ERROR_CHECK(nrf_spi_mngr_schedule(p_lcd_spi->p_spi_mngr, &p_slot->transaction));
+}
+
+static void open_slot_get(lcd_spi_t const * p_lcd_spi, lcd_spi_slot_t ** pp_slot)
+{
+    lcd_spi_cb_t * p_cb = p_lcd_spi->p_cb;
+
+    if (!p_cb->open)
+    {
+        (void)slot_alloc(p_lcd_spi);
+        p_cb->open = true;
+    }
+
+    *pp_slot = &p_lcd_spi->p_slots[(p_cb->head + p_lcd_spi->slot_count - 1) % p_lcd_spi->slot_count];
+}
+
+ret_code_t lcd_spi_init(lcd_spi_t const * p_lcd_spi, nrf_drv_spi_config_t const * p_config)
+{
+    memset(p_lcd_spi->p_cb, 0, sizeof(lcd_spi_cb_t));
+
+    nrf_gpio_cfg_output(p_lcd_spi->dc_pin);
+
+    return nrf_spi_mngr_init(p_lcd_spi->p_spi_mngr, p_config);
+}
+
+void lcd_spi_uninit(lcd_spi_t const * p_lcd_spi)
+{
+    lcd_spi_wait(p_lcd_spi);
+
+    nrf_spi_mngr_uninit(p_lcd_spi->p_spi_mngr);
+}
+
+void lcd_spi_command_write(lcd_spi_t const * p_lcd_spi, uint8_t command)
+{
+    lcd_spi_commit(p_lcd_spi);
+
+    lcd_spi_slot_t * p_slot = slot_alloc(p_lcd_spi);
+
+    p_slot->data[0] = command;
+    p_slot->transfers[0] = (nrf_spi_mngr_transfer_t)NRF_SPI_MNGR_TRANSFER(p_slot->data, 1, NULL, 0);
+
+    slot_schedule(p_lcd_spi, p_slot, command_begin, 1);
+}
+
+void lcd_spi_data_write(lcd_spi_t const * p_lcd_spi, void const * p_data, size_t length)
+{
+    uint8_t const * p_src = p_data;
+
+    while (length > 0)
+    {
+        lcd_spi_slot_t * p_slot;
+
+        open_slot_get(p_lcd_spi, &p_slot);
+
+        size_t chunk = MIN(length, LCD_SPI_SLOT_SIZE - p_slot->length);
+
+        memcpy(&p_slot->data[p_slot->length], p_src, chunk);
+        p_slot->length += chunk;
+        p_src += chunk;
+        length -= chunk;
+
+        if (p_slot->length == LCD_SPI_SLOT_SIZE)
+        {
+            lcd_spi_commit(p_lcd_spi);
+        }
+    }
+}
+
+void lcd_spi_fill(lcd_spi_t const * p_lcd_spi, uint8_t const * p_pixel, uint32_t count)
+{
+    lcd_spi_commit(p_lcd_spi);
+
+    while (count > 0)
+    {
+        lcd_spi_slot_t * p_slot = slot_alloc(p_lcd_spi);
+        uint32_t pattern = MIN(count, LCD_SPI_SLOT_SIZE / 2);
+        uint8_t  transfers = 0;
+
+        for (uint32_t i = 0; i < pattern; i++)
+        {
+            p_slot->data[2 * i]     = p_pixel[0];
+            p_slot->data[2 * i + 1] = p_pixel[1];
+        }
+        p_slot->length = 2 * pattern;
+
+        // The same pattern is sent by every transfer of the slot.
+        while ((count > 0) && (transfers < LCD_SPI_REPEAT_TRANSFERS))
+        {
+            uint32_t pixels = MIN(count, pattern);
+
+            p_slot->transfers[transfers++] =
+                (nrf_spi_mngr_transfer_t)NRF_SPI_MNGR_TRANSFER(p_slot->data, 2 * pixels, NULL, 0);
+            count -= pixels;
+        }
+
+        slot_schedule(p_lcd_spi, p_slot, data_begin, transfers);
+    }
+}
+
+void lcd_spi_commit(lcd_spi_t const * p_lcd_spi)
+{
+    lcd_spi_slot_t * p_slot;
+
+    if (!p_lcd_spi->p_cb->open)
+    {
+        return;
+    }
+
+    open_slot_get(p_lcd_spi, &p_slot);
+    p_lcd_spi->p_cb->open = false;
+
+    p_slot->transfers[0] =
+        (nrf_spi_mngr_transfer_t)NRF_SPI_MNGR_TRANSFER(p_slot->data, p_slot->length, NULL, 0);
+
+    slot_schedule(p_lcd_spi, p_slot, data_begin, 1);
+}
+
+void lcd_spi_wait(lcd_spi_t const * p_lcd_spi)
+{
+    lcd_spi_commit(p_lcd_spi);
+
+    if (p_lcd_spi->p_cb->used > 0)
+    {
+        // An interrupt at or above the SPI priority would wait forever.
+        ASSERT(current_int_priority_get() == APP_IRQ_PRIORITY_THREAD);
+    }
+    while (p_lcd_spi->p_cb->used > 0)
+    {
+        __WFE();
+    }
+}
+
+void lcd_spi_done_handler_set(lcd_spi_t const * p_lcd_spi, nrf_lcd_done_handler_t handler)
+{
+    p_lcd_spi->p_cb->handler = handler;
+}
+
+#endif // NRF_MODULE_ENABLED(ILI9341) || NRF_MODULE_ENABLED(ST7735)
@@ -0,0 +1,215 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef LCD_SPI_H__
+#define LCD_SPI_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_errors.h"
+#include "nrf_spi_mngr.h"
+#include "nrf_lcd.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file
+ *
+ * @defgroup lcd_spi SPI LCD transaction queue
+ * @{
+ * @ingroup ext_drivers
+ *
+ * @brief Queue of command and data transfers for SPI LCD controllers with a data/command pin.
+ *
+ * Commands, their parameters, and pixel data are copied to a ring of transaction slots and sent
+ * with @ref nrf_spi_mngr in the background. Consecutive data bytes are gathered in one slot and
+ * sent as one transfer. Solid fills send a single slot with a repeated pixel pattern several times.
+ * Functions block only when all slots are in use.
+ *
+ * @note Blocking waits for the SPI interrupt, so the functions must be called from thread
+ *       context. Called from an interrupt, they only work while no wait is needed.
+ */
+
+#define LCD_SPI_SLOT_SIZE           254     ///< Bytes of data held by one slot, fits in an 8-bit EasyDMA transfer.
+#define LCD_SPI_REPEAT_TRANSFERS    8       ///< Maximum number of times the data of one slot is repeated in a fill.
+
+/**
+ * @brief Transaction slot.
+ */
+typedef struct
+{
+    nrf_spi_mngr_transaction_t transaction;                         ///< Transaction descriptor.
+    nrf_spi_mngr_transfer_t    transfers[LCD_SPI_REPEAT_TRANSFERS]; ///< Transfers of the transaction.
+    uint8_t                    data[LCD_SPI_SLOT_SIZE];             ///< Data sent by the transfers.
+    uint8_t                    length;                              ///< Number of bytes used in data.
+} lcd_spi_slot_t;
+
+/**
+ * @brief Control block of the queue.
+ */
+typedef struct
+{
+    nrf_lcd_done_handler_t handler;     ///< Handler called when all queued transfers are finished.
+    uint8_t                head;        ///< Index of the next slot to allocate.
+    uint8_t volatile       used;        ///< Number of allocated slots.
+    bool                   open;        ///< True if the last allocated slot is still being filled with data.
+} lcd_spi_cb_t;
+
+/**
+ * @brief Queue instance.
+ */
+typedef struct
+{
+    nrf_spi_mngr_t const * p_spi_mngr;  ///< SPI transaction manager.
+    lcd_spi_slot_t       * p_slots;     ///< Transaction slots.
+    lcd_spi_cb_t         * p_cb;        ///< Control block.
+    uint32_t               dc_pin;      ///< Data/command pin.
+    uint8_t                slot_count;  ///< Number of transaction slots.
+} lcd_spi_t;
+
+/**
+ * @brief Macro for defining the SPI transaction manager of a queue instance.
+ *
+ * @ref NRF_SPI_MNGR_DEF pastes its name argument, so the name is expanded here first.
+ */
+#define LCD_SPI_MNGR_DEF(_spi_mngr_name, _queue_size, _spi_idx) \
+    NRF_SPI_MNGR_DEF(_spi_mngr_name, _queue_size, _spi_idx)
+
+/**
+ * @brief Macro for defining a queue instance.
+ *
+ * @param[in] _name         Name of the instance.
+ * @param[in] _queue_size   Number of transactions that can be pending in the SPI transaction manager.
+ *                          One more slot is allocated for the transaction that is in progress.
+ * @param[in] _spi_idx      Index of the SPI instance.
+ * @param[in] _dc_pin       Data/command pin.
+ */
+#define LCD_SPI_DEF(_name, _queue_size, _spi_idx, _dc_pin)          \
+    LCD_SPI_MNGR_DEF(CONCAT_2(_name, _spi_mngr), _queue_size, _spi_idx); \
+    static lcd_spi_slot_t CONCAT_2(_name, _slots)[(_queue_size) + 1]; \
+    static lcd_spi_cb_t CONCAT_2(_name, _cb);                       \
+    static const lcd_spi_t _name =                                  \
+    {                                                               \
+        .p_spi_mngr = &CONCAT_2(_name, _spi_mngr),                  \
+        .p_slots    = CONCAT_2(_name, _slots),                      \
+        .p_cb       = &CONCAT_2(_name, _cb),                        \
+        .dc_pin     = (_dc_pin),                                    \
+        .slot_count = (_queue_size) + 1                             \
+    }
+
+/**
+ * @brief Function for initializing the queue and the SPI bus.
+ *
+ * @param[in] p_lcd_spi     Pointer to the queue instance.
+ * @param[in] p_config      Pointer to the SPI configuration.
+ *
+ * @return Values returned by @ref nrf_spi_mngr_init.
+ */
+ret_code_t lcd_spi_init(lcd_spi_t const * p_lcd_spi, nrf_drv_spi_config_t const * p_config);
+
+/**
+ * @brief Function for uninitializing the queue. Waits until all queued transfers are finished.
+ *
+ * @param[in] p_lcd_spi     Pointer to the queue instance.
+ */
+void lcd_spi_uninit(lcd_spi_t const * p_lcd_spi);
+
+/**
+ * @brief Function for queuing a command byte.
+ *
+ * @param[in] p_lcd_spi     Pointer to the queue instance.
+ * @param[in] command       Command.
+ */
+void lcd_spi_command_write(lcd_spi_t const * p_lcd_spi, uint8_t command);
+
+/**
+ * @brief Function for queuing data bytes.
+ *
+ * The data is gathered with the data queued before it and sent with
+ * the next command, when a slot is full, or on @ref lcd_spi_commit.
+ *
+ * @param[in] p_lcd_spi     Pointer to the queue instance.
+ * @param[in] p_data        Pointer to the data. It is copied, so it can be reused on return.
+ * @param[in] length        Number of bytes.
+ */
+void lcd_spi_data_write(lcd_spi_t const * p_lcd_spi, void const * p_data, size_t length);
+
+/**
+ * @brief Function for queuing a pixel pattern repeated a number of times.
+ *
+ * @param[in] p_lcd_spi     Pointer to the queue instance.
+ * @param[in] p_pixel       Pointer to the 2 bytes of the pixel, in the order they are sent.
+ * @param[in] count         Number of pixels.
+ */
+void lcd_spi_fill(lcd_spi_t const * p_lcd_spi, uint8_t const * p_pixel, uint32_t count);
+
+/**
+ * @brief Function for starting the transfer of data gathered by @ref lcd_spi_data_write.
+ *
+ * @param[in] p_lcd_spi     Pointer to the queue instance.
+ */
+void lcd_spi_commit(lcd_spi_t const * p_lcd_spi);
+
+/**
+ * @brief Function for waiting until all queued transfers are finished.
+ *
+ * Must be called from thread context if transfers are pending.
+ *
+ * @param[in] p_lcd_spi     Pointer to the queue instance.
+ */
+void lcd_spi_wait(lcd_spi_t const * p_lcd_spi);
+
+/**
+ * @brief Function for setting the handler called when all queued transfers are finished.
+ *
+ * The handler is called in the SPI interrupt context.
+ *
+ * @param[in] p_lcd_spi     Pointer to the queue instance.
+ * @param[in] handler       Handler, or NULL to disable the notification.
+ */
+void lcd_spi_done_handler_set(lcd_spi_t const * p_lcd_spi, nrf_lcd_done_handler_t handler);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LCD_SPI_H__
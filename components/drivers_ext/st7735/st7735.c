@@ -43,9 +43,8 @@
 #if NRF_MODULE_ENABLED(ST7735)
 
 #include "nrf_lcd.h"
-#include "nrf_drv_spi.h"
+#include "lcd_spi.h"
 #include "nrf_delay.h"
-#include "nrf_gpio.h"
 #include "boards.h"
 
 // Set of commands described in ST7735 data sheet.
@@ -106,7 +105,13 @@
 
 #define RGB2BGR(x)      (x << 11) | (x & 0x07E0) | (x >> 11)
 
-static const nrf_drv_spi_t spi = NRF_DRV_SPI_INSTANCE(ST7735_SPI_INSTANCE);  /**< SPI instance. */
+#define ST7735_BITMAP_CHUNK_SIZE    127 // Pixels converted at a time, fills one transfer queue slot.
+
+#ifndef ST7735_QUEUE_SIZE
+#define ST7735_QUEUE_SIZE 8 // Number of SPI transactions that can be queued.
+#endif
+
+LCD_SPI_DEF(m_lcd_spi, ST7735_QUEUE_SIZE, ST7735_SPI_INSTANCE, ST7735_DC_PIN);
 
 /**
  * @brief Structure holding ST7735 controller basic parameters.
@@ -128,21 +133,21 @@ typedef enum{
 
 static st7735_t m_st7735;
 
-static inline void spi_write(const void * data, size_t size)
+static inline void write_command(uint8_t c)
 {
-    APP_ERROR_CHECK(nrf_drv_spi_transfer(&spi, data, size, NULL, 0));
+    lcd_spi_command_write(&m_lcd_spi, c);
 }
 
-static inline void write_command(uint8_t c)
+static inline void write_data(uint8_t c)
 {
-    nrf_gpio_pin_clear(ST7735_DC_PIN);
-    spi_write(&c, sizeof(c));
+    lcd_spi_data_write(&m_lcd_spi, &c, sizeof(c));
 }
 
-static inline void write_data(uint8_t c)
+static void delay_ms(uint32_t ms)
 {
-    nrf_gpio_pin_set(ST7735_DC_PIN);
-    spi_write(&c, sizeof(c));
+    // Delays in the command list count from the moment the preceding commands were sent.
+    lcd_spi_wait(&m_lcd_spi);
+    nrf_delay_ms(ms);
 }
 
 static void set_addr_window(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
@@ -166,9 +171,9 @@ static void set_addr_window(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
 static void command_list(void)
 {
     write_command(ST7735_SWRESET);
-    nrf_delay_ms(150);
+    delay_ms(150);
     write_command(ST7735_SLPOUT);
-    nrf_delay_ms(500);
+    delay_ms(500);
 
     write_command(ST7735_FRMCTR1);
     write_data(0x01);
@@ -289,9 +294,9 @@ static void command_list(void)
     write_data(0x10);
 
     write_command(ST7735_NORON);
-    nrf_delay_ms(10);
+    delay_ms(10);
     write_command(ST7735_DISPON);
-    nrf_delay_ms(100);
+    delay_ms(100);
 
     if (m_st7735.tab_color == INITR_BLACKTAB)
     {
@@ -305,8 +310,6 @@ static ret_code_t hardware_init(void)
 {
     ret_code_t err_code;
 
-    nrf_gpio_cfg_output(ST7735_DC_PIN);
-
     nrf_drv_spi_config_t spi_config = NRF_DRV_SPI_DEFAULT_CONFIG;
 
     spi_config.sck_pin  = ST7735_SCK_PIN;
@@ -314,7 +317,7 @@ static ret_code_t hardware_init(void)
     spi_config.mosi_pin = ST7735_MOSI_PIN;
     spi_config.ss_pin   = ST7735_SS_PIN;
 
-    err_code = nrf_drv_spi_init(&spi, &spi_config, NULL, NULL);
+    err_code = lcd_spi_init(&m_lcd_spi, &spi_config);
     return err_code;
 }
 
@@ -331,13 +334,14 @@ static ret_code_t st7735_init(void)
     }
 
     command_list();
+    lcd_spi_commit(&m_lcd_spi);
 
     return err_code;
 }
 
 static void st7735_uninit(void)
 {
-    nrf_drv_spi_uninit(&spi);
+    lcd_spi_uninit(&m_lcd_spi);
 }
 
 static void st7735_pixel_draw(uint16_t x, uint16_t y, uint32_t color)
@@ -348,11 +352,8 @@ static void st7735_pixel_draw(uint16_t x, uint16_t y, uint32_t color)
 
     const uint8_t data[2] = {color >> 8, color};
 
-    nrf_gpio_pin_set(ST7735_DC_PIN);
-
-    spi_write(data, sizeof(data));
-
-    nrf_gpio_pin_clear(ST7735_DC_PIN);
+    lcd_spi_data_write(&m_lcd_spi, data, sizeof(data));
+    lcd_spi_commit(&m_lcd_spi);
 }
 
 static void st7735_rect_draw(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint32_t color)
@@ -363,36 +364,36 @@ static void st7735_rect_draw(uint16_t x, uint16_t y, uint16_t width, uint16_t he
 
     const uint8_t data[2] = {color >> 8, color};
 
-    nrf_gpio_pin_set(ST7735_DC_PIN);
-
-    // Duff's device algorithm for optimizing loop.
-    uint32_t i = (height * width + 7) / 8;
-
-/*lint -save -e525 -e616 -e646 */
-    switch ((height * width) % 8) {
-        case 0:
-            do {
-                spi_write(data, sizeof(data));
-        case 7:
-                spi_write(data, sizeof(data));
-        case 6:
-                spi_write(data, sizeof(data));
-        case 5:
-                spi_write(data, sizeof(data));
-        case 4:
-                spi_write(data, sizeof(data));
-        case 3:
-                spi_write(data, sizeof(data));
-        case 2:
-                spi_write(data, sizeof(data));
-        case 1:
-                spi_write(data, sizeof(data));
-            } while (--i > 0);
-        default:
-            break;
+    lcd_spi_fill(&m_lcd_spi, data, (uint32_t)width * height);
+}
+
+static void st7735_bitmap_draw(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t const * p_data)
+{
+    uint8_t  data[2 * ST7735_BITMAP_CHUNK_SIZE];
+    uint32_t count = (uint32_t)width * height;
+
+    set_addr_window(x, y, x + width - 1, y + height - 1);
+
+    // Pixels are converted to the bus byte order in chunks and copied to the transfer queue.
+    while (count > 0)
+    {
+        uint32_t chunk = MIN(count, ST7735_BITMAP_CHUNK_SIZE);
+
+        for (uint32_t i = 0; i < chunk; i++)
+        {
+            uint16_t pixel = RGB2BGR(p_data[i]);
+
+            data[2 * i]     = pixel >> 8;
+            data[2 * i + 1] = pixel;
+        }
+
+        lcd_spi_data_write(&m_lcd_spi, data, 2 * chunk);
+
+        p_data += chunk;
+        count  -= chunk;
     }
-/*lint -restore */
-    nrf_gpio_pin_clear(ST7735_DC_PIN);
+
+    lcd_spi_commit(&m_lcd_spi);
 }
 
 static void st7735_dummy_display(void)
@@ -447,6 +448,8 @@ static void st7735_rotation_set(nrf_lcd_rotation_t rotation)
         default:
             break;
     }
+
+    lcd_spi_commit(&m_lcd_spi);
 }
 
 
@@ -455,6 +458,11 @@ static void st7735_display_invert(bool invert)
     write_command(invert ? ST7735_INVON : ST7735_INVOFF);
 }
 
+static void st7735_done_handler_set(nrf_lcd_done_handler_t handler)
+{
+    lcd_spi_done_handler_set(&m_lcd_spi, handler);
+}
+
 static lcd_cb_t st7735_cb = {
     .height = ST7735_HEIGHT,
     .width = ST7735_WIDTH
@@ -465,9 +473,11 @@ const nrf_lcd_t nrf_lcd_st7735 = {
     .lcd_uninit = st7735_uninit,
     .lcd_pixel_draw = st7735_pixel_draw,
     .lcd_rect_draw = st7735_rect_draw,
+    .lcd_bitmap_draw = st7735_bitmap_draw,
     .lcd_display = st7735_dummy_display,
     .lcd_rotation_set = st7735_rotation_set,
     .lcd_display_invert = st7735_display_invert,
+    .lcd_done_handler_set = st7735_done_handler_set,
     .p_lcd_cb = &st7735_cb
 };
 
@@ -246,6 +246,134 @@ static uint8_t nrf_balloc_block2idx(nrf_balloc_t const * p_pool, void const * p_
     return ((size_t)(p_block) - (size_t)(p_pool->p_memory_begin)) / p_pool->block_size;
 }
 
+#if NRF_BALLOC_LOCK_FREE
+/**@brief  Atomically replace a word if it still holds the expected value.
+ *
+ * @param[in]   p_word      Pointer to the word.
+ * @param[in]   expected    Expected current value.
+ * @param[in]   desired     New value.
+ *
+ * @return      True if the word was replaced.
+ */
+static bool word_compare_and_swap(volatile uint32_t * p_word, uint32_t expected, uint32_t desired)
+{
+#if defined(__CORTEX_M) && (__CORTEX_M >= 3)
+    do
+    {
+        if (__LDREXW(p_word) != expected)
+        {
+            __CLREX();
+            return false;
+        }
+    } while (__STREXW(desired, p_word) != 0);
+    __DMB();
+    return true;
+#elif defined(__CORTEX_M)
+    // No exclusive access instructions on this core.
+    bool swapped;
+
+    CRITICAL_REGION_ENTER();
+    swapped = (*p_word == expected);
+    if (swapped)
+    {
+        *p_word = desired;
+    }
+    CRITICAL_REGION_EXIT();
+
+    return swapped;
+#else
+    return __atomic_compare_exchange_n(p_word, &expected, desired, false,
+                                       __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#endif
+}
+
+/**@brief  Build a free list head word.
+ *
+ * @param[in]   old_head    Current head word, used to derive the new tag.
+ * @param[in]   count       Number of blocks on the free list.
+ * @param[in]   idx         Index of the first block on the free list.
+ *
+ * @return      New head word.
+ */
+__STATIC_INLINE uint32_t head_make(uint32_t old_head, uint32_t count, uint32_t idx)
+{
+    return ((old_head + 0x10000) & 0xFFFF0000) | ((count & 0xFF) << 8) | (idx & 0xFF);
+}
+
+/**@brief  Take a block from the pool without a critical section.
+ *
+ * @param[in]   p_pool      Pointer to the memory pool.
+ *
+ * @return      Index of the block or @ref NRF_BALLOC_IDX_NONE if the pool is empty.
+ */
+static uint8_t lock_free_alloc(nrf_balloc_t const * p_pool)
+{
+    nrf_balloc_cb_t * p_cb = p_pool->p_cb;
+
+    // Fast path: the block freed last, which is usually freed and allocated again by the same
+    // context.
+    uint32_t cached = p_cb->cache;
+    if ((cached != NRF_BALLOC_IDX_NONE) &&
+        word_compare_and_swap(&p_cb->cache, cached, NRF_BALLOC_IDX_NONE))
+    {
+        return (uint8_t)cached;
+    }
+
+    uint32_t head;
+    uint32_t idx;
+
+    do
+    {
+        head = p_cb->head;
+        idx  = NRF_BALLOC_HEAD_IDX_GET(head);
+        if (idx == NRF_BALLOC_IDX_NONE)
+        {
+            // The cache may have been refilled in the meantime.
+            cached = p_cb->cache;
+            if ((cached != NRF_BALLOC_IDX_NONE) &&
+                word_compare_and_swap(&p_cb->cache, cached, NRF_BALLOC_IDX_NONE))
+            {
+                return (uint8_t)cached;
+            }
+            return NRF_BALLOC_IDX_NONE;
+        }
+        // If the block is taken by another context before the swap, the tag has changed and the
+        // swap fails, so a stale link is never installed.
+    } while (!word_compare_and_swap(&p_cb->head,
+                                    head,
+                                    head_make(head,
+                                              NRF_BALLOC_HEAD_COUNT_GET(head) - 1,
+                                              p_pool->p_stack_base[idx])));
+
+    return (uint8_t)idx;
+}
+
+/**@brief  Return a block to the pool without a critical section.
+ *
+ * @param[in]   p_pool      Pointer to the memory pool.
+ * @param[in]   idx         Index of the block.
+ */
+static void lock_free_free(nrf_balloc_t const * p_pool, uint8_t idx)
+{
+    nrf_balloc_cb_t * p_cb = p_pool->p_cb;
+
+    if (word_compare_and_swap(&p_cb->cache, NRF_BALLOC_IDX_NONE, idx))
+    {
+        return;
+    }
+
+    uint32_t head;
+
+    do
+    {
+        head = p_cb->head;
+        p_pool->p_stack_base[idx] = NRF_BALLOC_HEAD_IDX_GET(head);
+    } while (!word_compare_and_swap(&p_cb->head,
+                                    head,
+                                    head_make(head, NRF_BALLOC_HEAD_COUNT_GET(head) + 1, idx)));
+}
+#endif // NRF_BALLOC_LOCK_FREE
+
 ret_code_t nrf_balloc_init(nrf_balloc_t const * p_pool)
 {
     uint8_t pool_size;
@@ -276,11 +404,21 @@ ret_code_t nrf_balloc_init(nrf_balloc_t const * p_pool)
                       p_pool->block_size,
                       pool_size * p_pool->block_size);
 
+#if NRF_BALLOC_LOCK_FREE
+    // Link all blocks into the free list, in increasing order.
+    for (uint8_t idx = 0; idx < pool_size; idx++)
+    {
+        p_pool->p_stack_base[idx] = (idx + 1 < pool_size) ? (idx + 1) : NRF_BALLOC_IDX_NONE;
+    }
+    p_pool->p_cb->cache = NRF_BALLOC_IDX_NONE;
+    p_pool->p_cb->head  = head_make(0xFFFF0000, pool_size, (pool_size > 0) ? 0 : NRF_BALLOC_IDX_NONE);
+#else
     p_pool->p_cb->p_stack_pointer = p_pool->p_stack_base;
     while (pool_size--)
     {
         *(p_pool->p_cb->p_stack_pointer)++ = pool_size;
     }
+#endif
 
     p_pool->p_cb->max_utilization = 0;
 
@@ -293,6 +431,22 @@ void * nrf_balloc_alloc(nrf_balloc_t const * p_pool)
 
     void * p_block = NULL;
 
+#if NRF_BALLOC_LOCK_FREE
+    uint8_t idx = lock_free_alloc(p_pool);
+
+    if (idx != NRF_BALLOC_IDX_NONE)
+    {
+        p_block = nrf_balloc_idx2block(p_pool, idx);
+
+        // Update utilization statistics. A concurrent update may be lost, which only affects
+        // the reported maximum.
+        uint8_t utilization = nrf_balloc_utilization_get(p_pool);
+        if (p_pool->p_cb->max_utilization < utilization)
+        {
+            p_pool->p_cb->max_utilization = utilization;
+        }
+    }
+#else
     CRITICAL_REGION_ENTER();
 
     if (p_pool->p_cb->p_stack_pointer > p_pool->p_stack_base)
@@ -309,6 +463,7 @@ void * nrf_balloc_alloc(nrf_balloc_t const * p_pool)
     }
 
     CRITICAL_REGION_EXIT();
+#endif // NRF_BALLOC_LOCK_FREE
 
 #if NRF_BALLOC_CONFIG_DEBUG_ENABLED
     if (p_block != NULL)
@@ -359,6 +514,9 @@ void nrf_balloc_free(nrf_balloc_t const * p_pool, void * p_element)
     void * p_block = p_element;
 #endif // NRF_BALLOC_CONFIG_DEBUG_ENABLED
 
+#if NRF_BALLOC_LOCK_FREE
+    lock_free_free(p_pool, nrf_balloc_block2idx(p_pool, p_block));
+#else
     CRITICAL_REGION_ENTER();
 
 #if NRF_BALLOC_CONFIG_DEBUG_ENABLED
@@ -394,6 +552,7 @@ void nrf_balloc_free(nrf_balloc_t const * p_pool, void * p_element)
     *(p_pool->p_cb->p_stack_pointer)++ = nrf_balloc_block2idx(p_pool, p_block);
 
     CRITICAL_REGION_EXIT();
+#endif // NRF_BALLOC_LOCK_FREE
 }
 
 #endif // NRF_MODULE_ENABLED(NRF_BALLOC)
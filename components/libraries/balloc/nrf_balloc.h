@@ -100,10 +100,40 @@ extern "C" {
     #define NRF_BALLOC_DEFAULT_DEBUG_FLAGS   0
 #endif // NRF_BALLOC_CONFIG_DEBUG_ENABLED
 
+/**@brief Whether the allocator uses a lock-free free list (see @ref NRF_BALLOC_CONFIG_LOCK_FREE).
+ *
+ * @details The debug checks need a consistent view of all free blocks, so the debug mode always
+ *          uses critical sections.
+ */
+#if NRF_BALLOC_CONFIG_LOCK_FREE && !NRF_BALLOC_CONFIG_DEBUG_ENABLED
+#define NRF_BALLOC_LOCK_FREE 1
+#else
+#define NRF_BALLOC_LOCK_FREE 0
+#endif
+
+/**@brief Block index that marks an empty free list or an empty cache. */
+#define NRF_BALLOC_IDX_NONE     0xFF
+
+/**@brief Get the block index from the free list head word. */
+#define NRF_BALLOC_HEAD_IDX_GET(_head)      ((_head) & 0xFF)
+
+/**@brief Get the number of blocks on the free list from the free list head word. */
+#define NRF_BALLOC_HEAD_COUNT_GET(_head)    (((_head) >> 8) & 0xFF)
+
 /**@brief Block memory allocator control block.*/
 typedef struct
 {
+#if NRF_BALLOC_LOCK_FREE
+    volatile uint32_t head;             //!< Free list head: update tag (bits 31-16), number of blocks on the list (bits 15-8) and index of the first block (bits 7-0).
+                                        /**<
+                                         * The tag changes on every update, so a head that was
+                                         * read before another context popped and pushed the same
+                                         * block back does not compare equal (ABA).
+                                         */
+    volatile uint32_t cache;            //!< Index of the last freed block, kept off the free list, or @ref NRF_BALLOC_IDX_NONE.
+#else
     uint8_t * p_stack_pointer;          //!< Current allocation stack pointer.
+#endif
     uint8_t   max_utilization;          //!< Maximum utilization of the memory pool.
 } nrf_balloc_cb_t;
 
@@ -114,6 +144,8 @@ typedef struct
     uint8_t         * p_stack_base;     //!< Base of the allocation stack.
                                         /**<
                                          * Stack is used to store handlers to not allocated elements.
+                                         * With @ref NRF_BALLOC_LOCK_FREE, it holds the index of the
+                                         * next free block for every block on the free list.
                                          */
     uint8_t         * p_stack_limit;    //!< Maximum possible value of the allocation stack pointer.
     void            * p_memory_begin;   //!< Pointer to the start of the memory pool.
@@ -339,7 +371,16 @@ __STATIC_INLINE uint8_t nrf_balloc_utilization_get(nrf_balloc_t const * p_pool);
 __STATIC_INLINE uint8_t nrf_balloc_utilization_get(nrf_balloc_t const * p_pool)
 {
     ASSERT(p_pool != NULL);
+#if NRF_BALLOC_LOCK_FREE
+    uint8_t free_blocks = NRF_BALLOC_HEAD_COUNT_GET(p_pool->p_cb->head);
+    if (p_pool->p_cb->cache != NRF_BALLOC_IDX_NONE)
+    {
+        free_blocks++;
+    }
+    return (p_pool->p_stack_limit - p_pool->p_stack_base) - free_blocks;
+#else
     return (p_pool->p_stack_limit - p_pool->p_cb->p_stack_pointer);
+#endif
 }
 #endif //SUPPRESS_INLINE_IMPLEMENTATION
 
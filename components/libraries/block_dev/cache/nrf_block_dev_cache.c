@@ -0,0 +1,616 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_BLOCK_DEV_CACHE)
+#include "nrf_block_dev_cache.h"
+#include <inttypes.h>
+
+/**@file
+ *
+ * @ingroup nrf_block_dev_cache
+ * @{
+ *
+ * @brief This module implements block device API with a RAM cache in front of another block
+ *        device.
+ */
+
+#if NRF_BLOCK_DEV_CACHE_CONFIG_LOG_ENABLED
+#define NRF_LOG_LEVEL       NRF_BLOCK_DEV_CACHE_CONFIG_LOG_LEVEL
+#define NRF_LOG_INFO_COLOR  NRF_BLOCK_DEV_CACHE_CONFIG_INFO_COLOR
+#define NRF_LOG_INST_DEBUG_COLOR NRF_BLOCK_DEV_CACHE_CONFIG_DEBUG_COLOR
+#else
+#define NRF_LOG_LEVEL       0
+#endif
+#include "nrf_log.h"
+
+/**
+ * @brief Mask of the first @p cnt blocks of a cache line
+ *
+ * @param cnt   Number of blocks (1 to @ref NRF_BLOCK_DEV_CACHE_LINE_BLOCKS_MAX)
+ * */
+#define BD_LINE_MASK(cnt)                                       \
+    (((cnt) >= 32) ? 0xFFFFFFFF : ((1u << (cnt)) - 1))
+
+static uint32_t blocks_count(uint32_t mask)
+{
+    uint32_t cnt = 0;
+
+    while (mask)
+    {
+        mask &= mask - 1;
+        cnt++;
+    }
+
+    return cnt;
+}
+
+static uint8_t * line_data_get(nrf_block_dev_cache_t const * p_cache_dev,
+                               nrf_block_dev_cache_line_t const * p_line,
+                               uint32_t blk)
+{
+    nrf_block_dev_cache_work_t const * p_work = p_cache_dev->p_work;
+
+    return p_cache_dev->p_line_buff +
+           (size_t)(p_line - p_cache_dev->p_lines) * p_cache_dev->line_size +
+           blk * p_work->geometry.blk_size;
+}
+
+static nrf_block_dev_cache_line_t * line_find(nrf_block_dev_cache_t const * p_cache_dev,
+                                              uint32_t tag)
+{
+    for (uint32_t i = 0; i < p_cache_dev->line_count; i++)
+    {
+        if (p_cache_dev->p_lines[i].tag == tag)
+        {
+            return &p_cache_dev->p_lines[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void line_touch(nrf_block_dev_cache_t const * p_cache_dev,
+                       nrf_block_dev_cache_line_t * p_line)
+{
+    p_line->last_use = ++p_cache_dev->p_work->use_counter;
+}
+
+/**
+ * @brief Writes dirty blocks of a cache line to the backing device.
+ *
+ * Dirty blocks are written in as few requests as possible: a request continues over clean
+ * blocks that are cached, and only ends at blocks that are not cached.
+ */
+static ret_code_t line_flush(nrf_block_dev_cache_t const * p_cache_dev,
+                             nrf_block_dev_cache_line_t * p_line)
+{
+    nrf_block_dev_cache_work_t * p_work = p_cache_dev->p_work;
+    nrf_block_dev_t const *      p_backing = p_cache_dev->cache_config.p_backing_dev;
+
+    while (p_line->dirty_mask)
+    {
+        uint32_t first = __CLZ(__RBIT(p_line->dirty_mask));
+        uint32_t last  = first;
+
+        for (uint32_t blk = first + 1; blk < p_work->line_blocks; blk++)
+        {
+            if ((p_line->valid_mask & (1u << blk)) == 0)
+            {
+                break;
+            }
+
+            if (p_line->dirty_mask & (1u << blk))
+            {
+                last = blk;
+            }
+        }
+
+        NRF_BLOCK_DEV_REQUEST(req,
+                              p_line->tag * p_work->line_blocks + first,
+                              last - first + 1,
+                              line_data_get(p_cache_dev, p_line, first));
+
+        ret_code_t ret = nrf_blk_dev_write_req(p_backing, &req);
+        if (ret != NRF_SUCCESS)
+        {
+            NRF_LOG_INST_ERROR(p_cache_dev->p_log,
+                               "Write back of block %"PRIu32" count %"PRIu32" failed: %"PRIu32,
+                               req.blk_id,
+                               req.blk_count,
+                               ret);
+            return ret;
+        }
+
+        p_work->stats.flushes++;
+        p_work->stats.flushed_blocks += req.blk_count;
+        p_line->dirty_mask &= ~(BD_LINE_MASK(last + 1) & ~BD_LINE_MASK(first));
+    }
+
+    return NRF_SUCCESS;
+}
+
+static ret_code_t cache_flush(nrf_block_dev_cache_t const * p_cache_dev)
+{
+    for (uint32_t i = 0; i < p_cache_dev->line_count; i++)
+    {
+        ret_code_t ret = line_flush(p_cache_dev, &p_cache_dev->p_lines[i]);
+        if (ret != NRF_SUCCESS)
+        {
+            return ret;
+        }
+    }
+
+    return NRF_SUCCESS;
+}
+
+/**
+ * @brief Assigns the least recently used cache line to @p tag.
+ */
+static ret_code_t line_alloc(nrf_block_dev_cache_t const * p_cache_dev,
+                             uint32_t tag,
+                             nrf_block_dev_cache_line_t * * pp_line)
+{
+    nrf_block_dev_cache_work_t const * p_work = p_cache_dev->p_work;
+    nrf_block_dev_cache_line_t *       p_line = &p_cache_dev->p_lines[0];
+
+    for (uint32_t i = 0; i < p_cache_dev->line_count; i++)
+    {
+        nrf_block_dev_cache_line_t * p_candidate = &p_cache_dev->p_lines[i];
+
+        if (p_candidate->tag == NRF_BLOCK_DEV_CACHE_LINE_INVALID)
+        {
+            p_line = p_candidate;
+            break;
+        }
+
+        /* Ages are compared as differences so that the counter may wrap. */
+        if ((p_work->use_counter - p_candidate->last_use) >
+            (p_work->use_counter - p_line->last_use))
+        {
+            p_line = p_candidate;
+        }
+    }
+
+    ret_code_t ret = line_flush(p_cache_dev, p_line);
+    if (ret != NRF_SUCCESS)
+    {
+        return ret;
+    }
+
+    p_line->tag        = tag;
+    p_line->valid_mask = 0;
+    p_line->dirty_mask = 0;
+
+    *pp_line = p_line;
+    return NRF_SUCCESS;
+}
+
+/**
+ * @brief Reads blocks of a cache line from the backing device.
+ *
+ * @param[in] p_cache_dev   Caching block device
+ * @param[in] p_line        Cache line
+ * @param[in] missing       Requested blocks that are not cached
+ * @param[in] read_ahead    Also read the blocks that follow the requested ones
+ */
+static ret_code_t line_fill(nrf_block_dev_cache_t const * p_cache_dev,
+                            nrf_block_dev_cache_line_t * p_line,
+                            uint32_t missing,
+                            bool read_ahead)
+{
+    nrf_block_dev_cache_work_t * p_work = p_cache_dev->p_work;
+    nrf_block_dev_t const *      p_backing = p_cache_dev->cache_config.p_backing_dev;
+    uint32_t                     line_start = p_line->tag * p_work->line_blocks;
+    uint32_t                     fetch = missing;
+
+    if (read_ahead)
+    {
+        uint32_t line_blocks = MIN(p_work->line_blocks, p_work->geometry.blk_count - line_start);
+        uint32_t first       = __CLZ(__RBIT(missing));
+
+        fetch |= ~p_line->valid_mask & BD_LINE_MASK(line_blocks) & ~BD_LINE_MASK(first);
+    }
+
+    p_work->stats.read_misses += blocks_count(missing);
+    p_work->stats.read_ahead  += blocks_count(fetch & ~missing);
+
+    while (fetch)
+    {
+        uint32_t first = __CLZ(__RBIT(fetch));
+        uint32_t cnt   = __CLZ(__RBIT(~(fetch >> first)));
+
+        NRF_BLOCK_DEV_REQUEST(req,
+                              line_start + first,
+                              cnt,
+                              line_data_get(p_cache_dev, p_line, first));
+
+        ret_code_t ret = nrf_blk_dev_read_req(p_backing, &req);
+        if (ret != NRF_SUCCESS)
+        {
+            return ret;
+        }
+
+        uint32_t mask = BD_LINE_MASK(cnt) << first;
+        p_line->valid_mask |= mask;
+        fetch &= ~mask;
+    }
+
+    return NRF_SUCCESS;
+}
+
+static void block_dev_cache_event_send(nrf_block_dev_t const * p_blk_dev,
+                                       nrf_block_dev_event_type_t event,
+                                       nrf_block_req_t const * p_blk,
+                                       ret_code_t ret)
+{
+    nrf_block_dev_cache_t const * p_cache_dev =
+                                  CONTAINER_OF(p_blk_dev, nrf_block_dev_cache_t, block_dev);
+    nrf_block_dev_cache_work_t const * p_work = p_cache_dev->p_work;
+
+    if (p_work->ev_handler)
+    {
+        /*Asynchronous operation (simulation)*/
+        const nrf_block_dev_event_t ev = {
+                event,
+                ((ret == NRF_SUCCESS) ? \
+                        NRF_BLOCK_DEV_RESULT_SUCCESS : NRF_BLOCK_DEV_RESULT_IO_ERROR),
+                p_blk,
+                p_work->p_context
+        };
+
+        p_work->ev_handler(p_blk_dev, &ev);
+    }
+}
+
+static ret_code_t block_dev_cache_init(nrf_block_dev_t const * p_blk_dev,
+                                       nrf_block_dev_ev_handler ev_handler,
+                                       void const * p_context)
+{
+    ASSERT(p_blk_dev);
+    nrf_block_dev_cache_t const * p_cache_dev =
+                                  CONTAINER_OF(p_blk_dev, nrf_block_dev_cache_t, block_dev);
+    nrf_block_dev_cache_work_t *  p_work = p_cache_dev->p_work;
+    nrf_block_dev_t const *       p_backing = p_cache_dev->cache_config.p_backing_dev;
+
+    NRF_LOG_INST_DEBUG(p_cache_dev->p_log, "Init");
+
+    ret_code_t ret = nrf_blk_dev_init(p_backing, NULL, NULL);
+    if (ret != NRF_SUCCESS)
+    {
+        NRF_LOG_INST_ERROR(p_cache_dev->p_log, "Backing device init error: %"PRIu32"", ret);
+        return ret;
+    }
+
+    memset(p_work, 0, sizeof(nrf_block_dev_cache_work_t));
+    p_work->geometry = *nrf_blk_dev_geometry(p_backing);
+
+    if ((p_cache_dev->line_size % p_work->geometry.blk_size) ||
+        (p_cache_dev->line_size < p_work->geometry.blk_size) ||
+        (p_cache_dev->line_size / p_work->geometry.blk_size > NRF_BLOCK_DEV_CACHE_LINE_BLOCKS_MAX))
+    {
+        /*Unsupported block size*/
+        NRF_LOG_INST_ERROR(p_cache_dev->p_log, "Unsupported block size because of line size");
+        UNUSED_RETURN_VALUE(nrf_blk_dev_uninit(p_backing));
+        return NRF_ERROR_NOT_SUPPORTED;
+    }
+
+    p_work->line_blocks = p_cache_dev->line_size / p_work->geometry.blk_size;
+    p_work->p_context = p_context;
+    p_work->ev_handler = ev_handler;
+
+    for (uint32_t i = 0; i < p_cache_dev->line_count; i++)
+    {
+        p_cache_dev->p_lines[i].tag        = NRF_BLOCK_DEV_CACHE_LINE_INVALID;
+        p_cache_dev->p_lines[i].valid_mask = 0;
+        p_cache_dev->p_lines[i].dirty_mask = 0;
+        p_cache_dev->p_lines[i].last_use   = 0;
+    }
+
+    block_dev_cache_event_send(p_blk_dev, NRF_BLOCK_DEV_EVT_INIT, NULL, NRF_SUCCESS);
+
+    return NRF_SUCCESS;
+}
+
+static ret_code_t block_dev_cache_uninit(nrf_block_dev_t const * p_blk_dev)
+{
+    ASSERT(p_blk_dev);
+    nrf_block_dev_cache_t const * p_cache_dev =
+                                  CONTAINER_OF(p_blk_dev, nrf_block_dev_cache_t, block_dev);
+    nrf_block_dev_cache_work_t *  p_work = p_cache_dev->p_work;
+
+    NRF_LOG_INST_DEBUG(p_cache_dev->p_log, "Uninit");
+
+    ret_code_t ret = cache_flush(p_cache_dev);
+    if (ret != NRF_SUCCESS)
+    {
+        return ret;
+    }
+
+    ret = nrf_blk_dev_uninit(p_cache_dev->cache_config.p_backing_dev);
+    if (ret != NRF_SUCCESS)
+    {
+        return ret;
+    }
+
+    block_dev_cache_event_send(p_blk_dev, NRF_BLOCK_DEV_EVT_UNINIT, NULL, NRF_SUCCESS);
+
+    memset(p_work, 0, sizeof(nrf_block_dev_cache_work_t));
+    return NRF_SUCCESS;
+}
+
+static ret_code_t block_dev_cache_read(nrf_block_dev_cache_t const * p_cache_dev,
+                                       nrf_block_req_t const * p_blk)
+{
+    nrf_block_dev_cache_work_t * p_work = p_cache_dev->p_work;
+    nrf_block_dev_t const *      p_backing = p_cache_dev->cache_config.p_backing_dev;
+
+    uint32_t  blk  = p_blk->blk_id;
+    uint32_t  left = p_blk->blk_count;
+    uint8_t * p_dst = p_blk->p_buff;
+    bool      read_ahead = p_cache_dev->cache_config.read_ahead &&
+                           (blk == p_work->next_read_blk);
+
+    while (left)
+    {
+        uint32_t tag = blk / p_work->line_blocks;
+        uint32_t off = blk % p_work->line_blocks;
+        uint32_t cnt = MIN(p_work->line_blocks - off, left);
+        uint32_t len = cnt * p_work->geometry.blk_size;
+
+        nrf_block_dev_cache_line_t * p_line = line_find(p_cache_dev, tag);
+        ret_code_t ret;
+
+        if ((p_line == NULL) && (cnt == p_work->line_blocks))
+        {
+            /*Whole line that is not cached: read directly to the destination buffer*/
+            NRF_BLOCK_DEV_REQUEST(req, blk, cnt, p_dst);
+
+            ret = nrf_blk_dev_read_req(p_backing, &req);
+            if (ret != NRF_SUCCESS)
+            {
+                return ret;
+            }
+
+            p_work->stats.read_misses += cnt;
+        }
+        else
+        {
+            if (p_line == NULL)
+            {
+                ret = line_alloc(p_cache_dev, tag, &p_line);
+                if (ret != NRF_SUCCESS)
+                {
+                    return ret;
+                }
+            }
+
+            line_touch(p_cache_dev, p_line);
+
+            uint32_t mask    = BD_LINE_MASK(cnt) << off;
+            uint32_t missing = mask & ~p_line->valid_mask;
+
+            p_work->stats.read_hits += cnt - blocks_count(missing);
+
+            if (missing)
+            {
+                ret = line_fill(p_cache_dev, p_line, missing, read_ahead);
+                if (ret != NRF_SUCCESS)
+                {
+                    return ret;
+                }
+            }
+
+            memcpy(p_dst, line_data_get(p_cache_dev, p_line, off), len);
+        }
+
+        blk   += cnt;
+        left  -= cnt;
+        p_dst += len;
+    }
+
+    p_work->next_read_blk = blk;
+    return NRF_SUCCESS;
+}
+
+static ret_code_t block_dev_cache_write(nrf_block_dev_cache_t const * p_cache_dev,
+                                        nrf_block_req_t const * p_blk)
+{
+    nrf_block_dev_cache_work_t * p_work = p_cache_dev->p_work;
+
+    uint32_t        blk  = p_blk->blk_id;
+    uint32_t        left = p_blk->blk_count;
+    uint8_t const * p_src = p_blk->p_buff;
+
+    while (left)
+    {
+        uint32_t tag = blk / p_work->line_blocks;
+        uint32_t off = blk % p_work->line_blocks;
+        uint32_t cnt = MIN(p_work->line_blocks - off, left);
+        uint32_t len = cnt * p_work->geometry.blk_size;
+
+        nrf_block_dev_cache_line_t * p_line = line_find(p_cache_dev, tag);
+
+        if (p_line == NULL)
+        {
+            ret_code_t ret = line_alloc(p_cache_dev, tag, &p_line);
+            if (ret != NRF_SUCCESS)
+            {
+                return ret;
+            }
+
+            p_work->stats.write_misses += cnt;
+        }
+        else
+        {
+            p_work->stats.write_hits += cnt;
+        }
+
+        line_touch(p_cache_dev, p_line);
+
+        memcpy(line_data_get(p_cache_dev, p_line, off), p_src, len);
+
+        uint32_t mask = BD_LINE_MASK(cnt) << off;
+        p_line->valid_mask |= mask;
+        p_line->dirty_mask |= mask;
+
+        blk   += cnt;
+        left  -= cnt;
+        p_src += len;
+    }
+
+    return NRF_SUCCESS;
+}
+
+static ret_code_t block_dev_cache_req(nrf_block_dev_t const * p_blk_dev,
+                                      nrf_block_req_t const * p_blk,
+                                      nrf_block_dev_event_type_t event)
+{
+    ASSERT(p_blk_dev);
+    ASSERT(p_blk);
+    nrf_block_dev_cache_t const * p_cache_dev =
+                                  CONTAINER_OF(p_blk_dev, nrf_block_dev_cache_t, block_dev);
+    nrf_block_dev_cache_work_t const * p_work = p_cache_dev->p_work;
+
+    NRF_LOG_INST_DEBUG(p_cache_dev->p_log,
+        ((event == NRF_BLOCK_DEV_EVT_BLK_READ_DONE) ?
+            "Read req from block %"PRIu32" size %"PRIu32"(x%"PRIu32") to %"PRIXPTR
+            :
+            "Write req to block %"PRIu32" size %"PRIu32"(x%"PRIu32") from %"PRIXPTR),
+        p_blk->blk_id,
+        p_blk->blk_count,
+        p_work->geometry.blk_size,
+        p_blk->p_buff);
+
+    if ((p_blk->blk_id + p_blk->blk_count) > p_work->geometry.blk_count)
+    {
+        NRF_LOG_INST_ERROR(p_cache_dev->p_log,
+            ((event == NRF_BLOCK_DEV_EVT_BLK_READ_DONE) ?
+                "Out of range read req block %"PRIu32" count %"PRIu32" while max is %"PRIu32
+                :
+                "Out of range write req block %"PRIu32" count %"PRIu32", while max is %"PRIu32),
+            p_blk->blk_id,
+            p_blk->blk_count,
+            p_work->geometry.blk_count);
+        return NRF_ERROR_INVALID_ADDR;
+    }
+
+    ret_code_t ret = (event == NRF_BLOCK_DEV_EVT_BLK_READ_DONE) ?
+                     block_dev_cache_read(p_cache_dev, p_blk) :
+                     block_dev_cache_write(p_cache_dev, p_blk);
+
+    block_dev_cache_event_send(p_blk_dev, event, p_blk, ret);
+
+    return ret;
+}
+
+static ret_code_t block_dev_cache_read_req(nrf_block_dev_t const * p_blk_dev,
+                                           nrf_block_req_t const * p_blk)
+{
+    return block_dev_cache_req(p_blk_dev, p_blk, NRF_BLOCK_DEV_EVT_BLK_READ_DONE);
+}
+
+static ret_code_t block_dev_cache_write_req(nrf_block_dev_t const * p_blk_dev,
+                                            nrf_block_req_t const * p_blk)
+{
+    return block_dev_cache_req(p_blk_dev, p_blk, NRF_BLOCK_DEV_EVT_BLK_WRITE_DONE);
+}
+
+static ret_code_t block_dev_cache_ioctl(nrf_block_dev_t const * p_blk_dev,
+                                        nrf_block_dev_ioctl_req_t req,
+                                        void * p_data)
+{
+    ASSERT(p_blk_dev);
+    nrf_block_dev_cache_t const * p_cache_dev =
+                                  CONTAINER_OF(p_blk_dev, nrf_block_dev_cache_t, block_dev);
+
+    switch (req)
+    {
+        case NRF_BLOCK_DEV_IOCTL_REQ_CACHE_FLUSH:
+        {
+            NRF_LOG_INST_DEBUG(p_cache_dev->p_log, "IOCtl: Cache flush");
+
+            ret_code_t ret = cache_flush(p_cache_dev);
+            if (ret != NRF_SUCCESS)
+            {
+                return ret;
+            }
+
+            /*Flush the backing device too, it may report that its own flush is in progress*/
+            return nrf_blk_dev_ioctl(p_cache_dev->cache_config.p_backing_dev, req, p_data);
+        }
+        case NRF_BLOCK_DEV_IOCTL_REQ_INFO_STRINGS:
+        {
+            if (p_data == NULL)
+            {
+                return NRF_ERROR_INVALID_PARAM;
+            }
+
+            nrf_block_dev_info_strings_t const * * pp_strings = p_data;
+            *pp_strings = &p_cache_dev->info_strings;
+            return NRF_SUCCESS;
+        }
+        default:
+            break;
+    }
+
+    return NRF_ERROR_NOT_SUPPORTED;
+}
+
+static nrf_block_dev_geometry_t const * block_dev_cache_geometry(nrf_block_dev_t const * p_blk_dev)
+{
+    ASSERT(p_blk_dev);
+    nrf_block_dev_cache_t const * p_cache_dev =
+                                  CONTAINER_OF(p_blk_dev, nrf_block_dev_cache_t, block_dev);
+    nrf_block_dev_cache_work_t const * p_work = p_cache_dev->p_work;
+
+    return &p_work->geometry;
+}
+
+const nrf_block_dev_ops_t nrf_block_device_cache_ops = {
+        .init = block_dev_cache_init,
+        .uninit = block_dev_cache_uninit,
+        .read_req = block_dev_cache_read_req,
+        .write_req = block_dev_cache_write_req,
+        .ioctl = block_dev_cache_ioctl,
+        .geometry = block_dev_cache_geometry,
+};
+
+/** @} */
+#endif // NRF_MODULE_ENABLED(NRF_BLOCK_DEV_CACHE)
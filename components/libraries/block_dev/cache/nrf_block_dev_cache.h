@@ -0,0 +1,225 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef NRF_BLOCK_DEV_CACHE_H__
+#define NRF_BLOCK_DEV_CACHE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "nrf_block_dev.h"
+#include "nrf_log_instance.h"
+
+/**@file
+ *
+ * @defgroup nrf_block_dev_cache Caching block device
+ * @ingroup nrf_block_dev
+ * @{
+ *
+ * @brief This module implements block device API on top of another block device, adding
+ *        a RAM cache in front of it.
+ *
+ * The cache is organized in lines of consecutive blocks. A line should be as large as the erase
+ * unit of the backing device (for example @ref NRF_BLOCK_DEV_QSPI_ERASE_UNIT_SIZE), so that all
+ * blocks of an erase unit that were written are written back in a single request. Lines are
+ * replaced in least recently used order.
+ *
+ * Writes are only stored in the cache. They are written to the backing device when a line is
+ * replaced, when @ref NRF_BLOCK_DEV_IOCTL_REQ_CACHE_FLUSH is requested, and on uninit.
+ *
+ * On a read miss that continues the previous read, the rest of the line is read in the same
+ * request (read-ahead). Reads of whole lines that are not cached bypass the cache.
+ *
+ * @note The backing device is used in synchronous mode. If an event handler is passed to
+ *       @ref nrf_blk_dev_init, it is called before the request function returns.
+ */
+
+/**
+ * @brief Caching block device operations
+ * */
+extern const nrf_block_dev_ops_t nrf_block_device_cache_ops;
+
+/**
+ * @brief Maximum number of blocks in a cache line
+ * */
+#define NRF_BLOCK_DEV_CACHE_LINE_BLOCKS_MAX 32
+
+/**
+ * @brief Cache line tag of an unused line
+ * */
+#define NRF_BLOCK_DEV_CACHE_LINE_INVALID 0xFFFFFFFF
+
+/**
+ * @brief Cache line
+ */
+typedef struct {
+    uint32_t tag;           //!< Index of the cached line of the backing device
+    uint32_t valid_mask;    //!< Blocks of the line that are cached
+    uint32_t dirty_mask;    //!< Blocks of the line that must be written back
+    uint32_t last_use;      //!< Value of the use counter when the line was last accessed
+} nrf_block_dev_cache_line_t;
+
+/**
+ * @brief Caching block device statistics
+ */
+typedef struct {
+    uint32_t read_hits;         //!< Blocks read from the cache
+    uint32_t read_misses;       //!< Blocks read from the backing device on request
+    uint32_t read_ahead;        //!< Blocks read from the backing device ahead of a request
+    uint32_t write_hits;        //!< Blocks written to a line that was already cached
+    uint32_t write_misses;      //!< Blocks written to a line that had to be allocated
+    uint32_t flushes;           //!< Write requests to the backing device
+    uint32_t flushed_blocks;    //!< Blocks written to the backing device
+} nrf_block_dev_cache_stats_t;
+
+/**
+ * @brief Work structure of caching block device
+ */
+typedef struct {
+    nrf_block_dev_geometry_t    geometry;       //!< Block device geometry
+    nrf_block_dev_ev_handler    ev_handler;     //!< Block device event handler
+    void const *                p_context;      //!< Context handle passed to event handler
+    uint32_t                    line_blocks;    //!< Number of blocks in a cache line
+    uint32_t                    use_counter;    //!< Line access counter used for replacement
+    uint32_t                    next_read_blk;  //!< Block that follows the last read request
+    nrf_block_dev_cache_stats_t stats;          //!< Cache statistics
+} nrf_block_dev_cache_work_t;
+
+/** @brief Name of the module used for logger messaging.
+ */
+#define NRF_BLOCK_DEV_CACHE_LOG_NAME block_dev_cache
+
+/**
+ * @brief Caching block device config initializer (@ref nrf_block_dev_cache_config_t)
+ *
+ * @param backing_dev   Backing block device
+ * @param readahead     Enable read-ahead
+ * */
+#define NRF_BLOCK_DEV_CACHE_CONFIG(backing_dev, readahead)  {    \
+        .p_backing_dev = (backing_dev),                         \
+        .read_ahead = (readahead),                              \
+}
+
+/**
+ * @brief Caching block device config
+ */
+typedef struct {
+    nrf_block_dev_t const * p_backing_dev;  //!< Backing block device
+    bool                    read_ahead;     //!< Read the rest of the line on a sequential read miss
+} nrf_block_dev_cache_config_t;
+
+/**
+ * @brief Caching block device
+ * */
+typedef struct {
+    nrf_block_dev_t                block_dev;       //!< Block device
+    nrf_block_dev_info_strings_t   info_strings;    //!< Block device information strings
+    nrf_block_dev_cache_config_t   cache_config;    //!< Caching block device config
+    nrf_block_dev_cache_work_t *   p_work;          //!< Caching block device work structure
+    nrf_block_dev_cache_line_t *   p_lines;         //!< Cache lines
+    uint8_t *                      p_line_buff;     //!< Cache line data
+    uint32_t                       line_count;      //!< Number of cache lines
+    uint32_t                       line_size;       //!< Cache line size in bytes
+    NRF_LOG_INSTANCE_PTR_DECLARE(p_log)             //!< Pointer to instance of the logger object (Conditionally compiled).
+} nrf_block_dev_cache_t;
+
+/**
+ * @brief Defines a caching block device.
+ *
+ * @param name          Instance name
+ * @param config        Configuration @ref nrf_block_dev_cache_config_t
+ * @param info          Info strings @ref NFR_BLOCK_DEV_INFO_CONFIG
+ * @param lines         Number of cache lines
+ * @param line_bytes    Cache line size in bytes. Must be a multiple of the block size of the
+ *                      backing device, up to @ref NRF_BLOCK_DEV_CACHE_LINE_BLOCKS_MAX blocks.
+ * */
+#define NRF_BLOCK_DEV_CACHE_DEFINE(name, config, info, lines, line_bytes)                           \
+    static nrf_block_dev_cache_work_t CONCAT_2(name, _work);                                        \
+    static nrf_block_dev_cache_line_t CONCAT_2(name, _lines)[lines];                                \
+    static uint32_t CONCAT_2(name, _buff)[((lines) * (line_bytes)) / sizeof(uint32_t)];            \
+    NRF_LOG_INSTANCE_REGISTER(NRF_BLOCK_DEV_CACHE_LOG_NAME, name,                                   \
+                              NRF_BLOCK_DEV_CACHE_CONFIG_INFO_COLOR,                                \
+                              NRF_BLOCK_DEV_CACHE_CONFIG_DEBUG_COLOR,                               \
+                              NRF_BLOCK_DEV_CACHE_CONFIG_LOG_INIT_FILTER_LEVEL,                     \
+                              NRF_BLOCK_DEV_CACHE_CONFIG_LOG_ENABLED ?                              \
+                                   NRF_BLOCK_DEV_CACHE_CONFIG_LOG_LEVEL : NRF_LOG_SEVERITY_NONE);   \
+    static const nrf_block_dev_cache_t name = {                                                     \
+        .block_dev = { .p_ops = &nrf_block_device_cache_ops },                                      \
+        .info_strings = BRACKET_EXTRACT(info),                                                      \
+        .cache_config = config,                                                                     \
+        .p_work = &CONCAT_2(name, _work),                                                           \
+        .p_lines = CONCAT_2(name, _lines),                                                          \
+        .p_line_buff = (uint8_t *)CONCAT_2(name, _buff),                                            \
+        .line_count = (lines),                                                                      \
+        .line_size = (line_bytes),                                                                  \
+        NRF_LOG_INSTANCE_PTR_INIT(p_log, NRF_BLOCK_DEV_CACHE_LOG_NAME, name)                        \
+    }
+
+/**
+ * @brief Returns block device API handle from caching block device.
+ *
+ * @param[in] p_blk_cache Caching block device
+ * @return Block device handle
+ */
+static inline nrf_block_dev_t const *
+nrf_block_dev_cache_ops_get(nrf_block_dev_cache_t const * p_blk_cache)
+{
+    return &p_blk_cache->block_dev;
+}
+
+/**
+ * @brief Returns statistics of caching block device.
+ *
+ * @param[in] p_blk_cache Caching block device
+ * @return Cache statistics
+ */
+static inline nrf_block_dev_cache_stats_t const *
+nrf_block_dev_cache_stats_get(nrf_block_dev_cache_t const * p_blk_cache)
+{
+    return &p_blk_cache->p_work->stats;
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_BLOCK_DEV_CACHE_H__ */
@@ -0,0 +1,619 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+
+#if NRF_DFU_ECDSA_FIXED_KEY
+
+#include <string.h>
+#include "nrf_dfu_ecdsa_fixed_key.h"
+
+/* Numbers are stored as 8 little-endian 32-bit limbs. Field elements are kept in the
+ * Montgomery domain (a * 2^256 mod p), points in Jacobian coordinates with a = -3.
+ */
+
+#define LIMBS           8                   /**< Number of 32-bit limbs in a 256-bit number. */
+#define COMB_TEETH      4                   /**< Number of teeth of the comb. */
+#define COMB_SPACING    (256 / COMB_TEETH)  /**< Distance in bits between the teeth, and number of doublings. */
+#define COMB_POINTS     ((1 << COMB_TEETH) - 1)
+
+typedef uint32_t num_t[LIMBS];
+
+/**@brief Modulus and its Montgomery constants. */
+typedef struct
+{
+    num_t    m;         /**< Modulus. */
+    num_t    r2;        /**< 2^512 mod m. */
+    num_t    one;       /**< 2^256 mod m, the Montgomery form of 1. */
+    uint32_t m_inv;     /**< -m^-1 mod 2^32. */
+} modulus_t;
+
+/**@brief Point in affine coordinates. */
+typedef struct
+{
+    num_t x;
+    num_t y;
+} affine_point_t;
+
+/**@brief Point in Jacobian coordinates. Z == 0 is the point at infinity. */
+typedef struct
+{
+    num_t x;
+    num_t y;
+    num_t z;
+} jacobian_point_t;
+
+static const modulus_t m_p =
+{
+    .m     = {0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0xffffffff},
+    .r2    = {0x00000003, 0x00000000, 0xffffffff, 0xfffffffb, 0xfffffffe, 0xffffffff, 0xfffffffd, 0x00000004},
+    .one   = {0x00000001, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffffffe, 0x00000000},
+    .m_inv = 0x00000001,
+};
+
+static const modulus_t m_n =
+{
+    .m     = {0xfc632551, 0xf3b9cac2, 0xa7179e84, 0xbce6faad, 0xffffffff, 0xffffffff, 0x00000000, 0xffffffff},
+    .r2    = {0xbe79eea2, 0x83244c95, 0x49bd6fa6, 0x4699799c, 0x2b6bec59, 0x2845b239, 0xf3d95620, 0x66e12d94},
+    .one   = {0x039cdaaf, 0x0c46353d, 0x58e8617b, 0x43190552, 0x00000000, 0x00000000, 0xffffffff, 0x00000000},
+    .m_inv = 0xee00bc4f,
+};
+
+/** Curve parameter b in the Montgomery domain. */
+static const num_t m_b =
+    {0x29c4bddf, 0xd89cdf62, 0x78843090, 0xacf005cd, 0xf7212ed6, 0xe5a220ab, 0x04874834, 0xdc30061d};
+
+/** Comb table of the generator: entry j - 1 is the sum of 2^(64 * t) * G over the bits t set in j.
+ *  Coordinates are in the Montgomery domain.
+ */
+static const affine_point_t m_g_comb[COMB_POINTS] =
+{
+    {{0x18a9143c, 0x79e730d4, 0x5fedb601, 0x75ba95fc, 0x77622510, 0x79fb732b, 0xa53755c6, 0x18905f76},
+     {0xce95560a, 0xddf25357, 0xba19e45c, 0x8b4ab8e4, 0xdd21f325, 0xd2e88688, 0x25885d85, 0x8571ff18}},
+    {{0x16a0d2bb, 0x4f922fc5, 0x1a623499, 0x0d5cc16c, 0x57c62c8b, 0x9241cf3a, 0xfd1b667f, 0x2f5e6961},
+     {0xf5a01797, 0x5c15c70b, 0x60956192, 0x3d20b44d, 0x071fdb52, 0x04911b37, 0x8d6f0f7b, 0xf648f916}},
+    {{0xe137bbbc, 0x9e566847, 0x8a6a0bec, 0xe434469e, 0x79d73463, 0xb1c42761, 0x133d0015, 0x5abe0285},
+     {0xc04c7dab, 0x92aa837c, 0x43260c07, 0x573d9f4c, 0x78e6cc37, 0x0c931562, 0x6b6f7383, 0x94bb725b}},
+    {{0xbfe20925, 0x62a8c244, 0x8fdce867, 0x91c19ac3, 0xdd387063, 0x5a96a5d5, 0x21d324f6, 0x61d587d4},
+     {0xa37173ea, 0xe87673a2, 0x53778b65, 0x23848008, 0x05bab43e, 0x10f8441e, 0x4621efbe, 0xfa11fe12}},
+    {{0x2cb19ffd, 0x1c891f2b, 0xb1923c23, 0x01ba8d5b, 0x8ac5ca8e, 0xb6d03d67, 0x1f13bedc, 0x586eb04c},
+     {0x27e8ed09, 0x0c35c6e5, 0x1819ede2, 0x1e81a33c, 0x56c652fa, 0x278fd6c0, 0x70864f11, 0x19d5ac08}},
+    {{0xd2b533d5, 0x62577734, 0xa1bdddc0, 0x673b8af6, 0xa79ec293, 0x577e7c9a, 0xc3b266b1, 0xbb6de651},
+     {0xb65259b3, 0xe7e9303a, 0xd03a7480, 0xd6a0afd3, 0x9b3cfc27, 0xc5ac83d1, 0x5d18b99b, 0x60b4619a}},
+    {{0x1ae5aa1c, 0xbd6a38e1, 0x49e73658, 0xb8b7652b, 0xee5f87ed, 0x0b130014, 0xaeebffcd, 0x9d0f27b2},
+     {0x7a730a55, 0xca924631, 0xddbbc83a, 0x9c955b2f, 0xac019a71, 0x07c1dfe0, 0x356ec48d, 0x244a566d}},
+    {{0xf4f8b16a, 0x56f8410e, 0xc47b266a, 0x97241afe, 0x6d9c87c1, 0x0a406b8e, 0xcd42ab1b, 0x803f3e02},
+     {0x04dbec69, 0x7f0309a8, 0x3bbad05f, 0xa83b85f7, 0xad8e197f, 0xc6097273, 0x5067adc1, 0xc097440e}},
+    {{0xc379ab34, 0x846a56f2, 0x841df8d1, 0xa8ee068b, 0x176c68ef, 0x20314459, 0x915f1f30, 0xf1af32d5},
+     {0x5d75bd50, 0x99c37531, 0xf72f67bc, 0x837cffba, 0x48d7723f, 0x0613a418, 0xe2d41c8b, 0x23d0f130}},
+    {{0xd5be5a2b, 0xed93e225, 0x5934f3c6, 0x6fe79983, 0x22626ffc, 0x43140926, 0x7990216a, 0x50bbb4d9},
+     {0xe57ec63e, 0x378191c6, 0x181dcdb2, 0x65422c40, 0x0236e0f6, 0x41a8099b, 0x01fe49c3, 0x2b100118}},
+    {{0x9b391593, 0xfc68b5c5, 0x598270fc, 0xc385f5a2, 0xd19adcbb, 0x7144f3aa, 0x83fbae0c, 0xdd558999},
+     {0x74b82ff4, 0x93b88b8e, 0x71e734c9, 0xd2e03c40, 0x43c0322a, 0x9a7a9eaf, 0x149d6041, 0xe6e4c551}},
+    {{0x80ec21fe, 0x5fe14bfe, 0xc255be82, 0xf6ce116a, 0x2f4a5d67, 0x98bc5a07, 0xdb7e63af, 0xfad27148},
+     {0x29ab05b3, 0x90c0b6ac, 0x4e251ae6, 0x37a9a83c, 0xc2aade7d, 0x0a7dc875, 0x9f0e1a84, 0x77387de3}},
+    {{0xa56c0dd7, 0x1e9ecc49, 0x46086c74, 0xa5cffcd8, 0xf505aece, 0x8f7a1408, 0xbef0c47e, 0xb37b85c0},
+     {0xcc0e6a8f, 0x3596b6e4, 0x6b388f23, 0xfd6d4bbf, 0xc39cef4e, 0xaba453fa, 0xf9f628d5, 0x9c135ac8}},
+    {{0x95c8f8be, 0x0a1c7294, 0x3bf362bf, 0x2961c480, 0xdf63d4ac, 0x9e418403, 0x91ece900, 0xc109f9cb},
+     {0x58945705, 0xc2d095d0, 0xddeb85c0, 0xb9083d96, 0x7a40449b, 0x84692b8d, 0x2eee1ee1, 0x9bc3344f}},
+    {{0x42913074, 0x0d5ae356, 0x48a542b1, 0x55491b27, 0xb310732a, 0x469ca665, 0x5f1a4cc1, 0x29591d52},
+     {0xb84f983f, 0xe76f5b6b, 0x9f5f84e1, 0xbe7eef41, 0x80baa189, 0x1200d496, 0x18ef332c, 0x6376551f}},
+};
+
+static affine_point_t m_pk_comb[COMB_POINTS];   /**< Comb table of the public key, see @ref m_g_comb. */
+static bool           m_pk_comb_valid;
+
+
+static bool num_is_zero(num_t const a)
+{
+    uint32_t acc = 0;
+
+    for (uint32_t i = 0; i < LIMBS; i++)
+    {
+        acc |= a[i];
+    }
+    return (acc == 0);
+}
+
+
+/** Returns true if a >= b. */
+static bool num_gte(num_t const a, num_t const b)
+{
+    for (int32_t i = LIMBS - 1; i >= 0; i--)
+    {
+        if (a[i] != b[i])
+        {
+            return (a[i] > b[i]);
+        }
+    }
+    return true;
+}
+
+
+/** r = a - b, returns the borrow. */
+static uint32_t num_sub(num_t r, num_t const a, num_t const b)
+{
+    uint64_t borrow = 0;
+
+    for (uint32_t i = 0; i < LIMBS; i++)
+    {
+        uint64_t d = (uint64_t)a[i] - b[i] - borrow;
+        r[i]   = (uint32_t)d;
+        borrow = (d >> 32) & 1;
+    }
+    return (uint32_t)borrow;
+}
+
+
+/** r = a + b, returns the carry. */
+static uint32_t num_add(num_t r, num_t const a, num_t const b)
+{
+    uint64_t carry = 0;
+
+    for (uint32_t i = 0; i < LIMBS; i++)
+    {
+        uint64_t s = (uint64_t)a[i] + b[i] + carry;
+        r[i]  = (uint32_t)s;
+        carry = s >> 32;
+    }
+    return (uint32_t)carry;
+}
+
+
+static void num_from_le_bytes(num_t r, uint8_t const * p_in)
+{
+    for (uint32_t i = 0; i < LIMBS; i++)
+    {
+        r[i] = uint32_decode(&p_in[4 * i]);
+    }
+}
+
+
+static void num_from_be_bytes(num_t r, uint8_t const * p_in)
+{
+    for (uint32_t i = 0; i < LIMBS; i++)
+    {
+        r[i] = uint32_big_decode(&p_in[4 * (LIMBS - 1 - i)]);
+    }
+}
+
+
+static void mod_add(num_t r, num_t const a, num_t const b, modulus_t const * p_mod)
+{
+    uint32_t carry = num_add(r, a, b);
+
+    if (carry || num_gte(r, p_mod->m))
+    {
+        (void)num_sub(r, r, p_mod->m);
+    }
+}
+
+
+static void mod_sub(num_t r, num_t const a, num_t const b, modulus_t const * p_mod)
+{
+    if (num_sub(r, a, b))
+    {
+        (void)num_add(r, r, p_mod->m);
+    }
+}
+
+
+/** Montgomery multiplication: r = a * b * 2^-256 mod m. r may alias a or b. */
+static void mod_mul(num_t r, num_t const a, num_t const b, modulus_t const * p_mod)
+{
+    uint32_t t[LIMBS + 2] = {0};
+
+    for (uint32_t i = 0; i < LIMBS; i++)
+    {
+        uint64_t carry = 0;
+
+        for (uint32_t j = 0; j < LIMBS; j++)
+        {
+            uint64_t acc = (uint64_t)a[j] * b[i] + t[j] + carry;
+            t[j]  = (uint32_t)acc;
+            carry = acc >> 32;
+        }
+        uint64_t acc = (uint64_t)t[LIMBS] + carry;
+        t[LIMBS]     = (uint32_t)acc;
+        t[LIMBS + 1] = (uint32_t)(acc >> 32);
+
+        uint32_t q = t[0] * p_mod->m_inv;
+
+        acc   = (uint64_t)q * p_mod->m[0] + t[0];
+        carry = acc >> 32;
+        for (uint32_t j = 1; j < LIMBS; j++)
+        {
+            acc      = (uint64_t)q * p_mod->m[j] + t[j] + carry;
+            t[j - 1] = (uint32_t)acc;
+            carry    = acc >> 32;
+        }
+        acc              = (uint64_t)t[LIMBS] + carry;
+        t[LIMBS - 1]     = (uint32_t)acc;
+        t[LIMBS]         = t[LIMBS + 1] + (uint32_t)(acc >> 32);
+    }
+
+    if (t[LIMBS] || num_gte(t, p_mod->m))
+    {
+        (void)num_sub(t, t, p_mod->m);
+    }
+    memcpy(r, t, sizeof(num_t));
+}
+
+
+static void mod_sqr(num_t r, num_t const a, modulus_t const * p_mod)
+{
+    mod_mul(r, a, a, p_mod);
+}
+
+
+/** r = a^-1 in the Montgomery domain, computed as a^(m - 2). a must not be zero. */
+static void mod_inv(num_t r, num_t const a, modulus_t const * p_mod)
+{
+    num_t e;
+    num_t acc;
+    num_t two = {2};
+
+    (void)num_sub(e, p_mod->m, two);
+    memcpy(acc, p_mod->one, sizeof(num_t));
+
+    for (int32_t i = 255; i >= 0; i--)
+    {
+        mod_sqr(acc, acc, p_mod);
+        if ((e[i / 32] >> (i % 32)) & 1)
+        {
+            mod_mul(acc, acc, a, p_mod);
+        }
+    }
+    memcpy(r, acc, sizeof(num_t));
+}
+
+
+static void mod_to_mont(num_t r, num_t const a, modulus_t const * p_mod)
+{
+    mod_mul(r, a, p_mod->r2, p_mod);
+}
+
+
+static void mod_from_mont(num_t r, num_t const a, modulus_t const * p_mod)
+{
+    num_t one = {1};
+
+    mod_mul(r, a, one, p_mod);
+}
+
+
+static void point_set_infinity(jacobian_point_t * p_r)
+{
+    memset(p_r, 0, sizeof(jacobian_point_t));
+}
+
+
+static void point_from_affine(jacobian_point_t * p_r, affine_point_t const * p_a)
+{
+    memcpy(p_r->x, p_a->x, sizeof(num_t));
+    memcpy(p_r->y, p_a->y, sizeof(num_t));
+    memcpy(p_r->z, m_p.one, sizeof(num_t));
+}
+
+
+/** Point doubling, dbl-2001-b. p_r may alias p_a. */
+static void point_double(jacobian_point_t * p_r, jacobian_point_t const * p_a)
+{
+    num_t delta;
+    num_t gamma;
+    num_t beta;
+    num_t alpha;
+    num_t t;
+
+    mod_sqr(delta, p_a->z, &m_p);
+    mod_sqr(gamma, p_a->y, &m_p);
+    mod_mul(beta, p_a->x, gamma, &m_p);
+
+    // alpha = 3 * (x - delta) * (x + delta)
+    mod_sub(t, p_a->x, delta, &m_p);
+    mod_add(alpha, p_a->x, delta, &m_p);
+    mod_mul(alpha, alpha, t, &m_p);
+    mod_add(t, alpha, alpha, &m_p);
+    mod_add(alpha, alpha, t, &m_p);
+
+    // z3 = (y + z)^2 - gamma - delta
+    mod_add(t, p_a->y, p_a->z, &m_p);
+    mod_sqr(t, t, &m_p);
+    mod_sub(t, t, gamma, &m_p);
+    mod_sub(p_r->z, t, delta, &m_p);
+
+    // x3 = alpha^2 - 8 * beta
+    mod_add(beta, beta, beta, &m_p);
+    mod_add(beta, beta, beta, &m_p);
+    mod_add(t, beta, beta, &m_p);
+    mod_sqr(p_r->x, alpha, &m_p);
+    mod_sub(p_r->x, p_r->x, t, &m_p);
+
+    // y3 = alpha * (4 * beta - x3) - 8 * gamma^2
+    mod_sub(t, beta, p_r->x, &m_p);
+    mod_mul(t, alpha, t, &m_p);
+    mod_sqr(gamma, gamma, &m_p);
+    mod_add(gamma, gamma, gamma, &m_p);
+    mod_add(gamma, gamma, gamma, &m_p);
+    mod_add(gamma, gamma, gamma, &m_p);
+    mod_sub(p_r->y, t, gamma, &m_p);
+}
+
+
+/** Mixed point addition, madd-2004-hmv. p_r may alias p_a. */
+static void point_add_affine(jacobian_point_t * p_r,
+                             jacobian_point_t const * p_a,
+                             affine_point_t const * p_b)
+{
+    num_t z1z1;
+    num_t u2;
+    num_t s2;
+    num_t h;
+    num_t r;
+    num_t t;
+
+    if (num_is_zero(p_a->z))
+    {
+        point_from_affine(p_r, p_b);
+        return;
+    }
+
+    mod_sqr(z1z1, p_a->z, &m_p);
+    mod_mul(u2, p_b->x, z1z1, &m_p);
+    mod_mul(s2, p_a->z, z1z1, &m_p);
+    mod_mul(s2, p_b->y, s2, &m_p);
+    mod_sub(h, u2, p_a->x, &m_p);
+    mod_sub(r, s2, p_a->y, &m_p);
+
+    if (num_is_zero(h))
+    {
+        if (num_is_zero(r))
+        {
+            jacobian_point_t b;
+
+            point_from_affine(&b, p_b);
+            point_double(p_r, &b);
+        }
+        else
+        {
+            point_set_infinity(p_r);
+        }
+        return;
+    }
+
+    // z3 = z1 * h
+    mod_mul(p_r->z, p_a->z, h, &m_p);
+
+    // u2 = x1 * h^2, s2 = h^3
+    mod_sqr(t, h, &m_p);
+    mod_mul(s2, t, h, &m_p);
+    mod_mul(u2, p_a->x, t, &m_p);
+
+    // x3 = r^2 - h^3 - 2 * x1 * h^2
+    mod_sqr(t, r, &m_p);
+    mod_sub(t, t, s2, &m_p);
+    mod_sub(t, t, u2, &m_p);
+    mod_sub(t, t, u2, &m_p);
+
+    // y3 = r * (x1 * h^2 - x3) - y1 * h^3
+    mod_mul(s2, p_a->y, s2, &m_p);
+    mod_sub(u2, u2, t, &m_p);
+    mod_mul(u2, r, u2, &m_p);
+    mod_sub(p_r->y, u2, s2, &m_p);
+    memcpy(p_r->x, t, sizeof(num_t));
+}
+
+
+static void point_to_affine(affine_point_t * p_r, jacobian_point_t const * p_a)
+{
+    num_t zinv;
+    num_t zinv2;
+
+    mod_inv(zinv, p_a->z, &m_p);
+    mod_sqr(zinv2, zinv, &m_p);
+    mod_mul(p_r->x, p_a->x, zinv2, &m_p);
+    mod_mul(zinv2, zinv2, zinv, &m_p);
+    mod_mul(p_r->y, p_a->y, zinv2, &m_p);
+}
+
+
+static uint32_t comb_index(num_t const k, uint32_t i)
+{
+    uint32_t index = 0;
+
+    for (uint32_t t = 0; t < COMB_TEETH; t++)
+    {
+        uint32_t bit = i + t * COMB_SPACING;
+
+        index |= ((k[bit / 32] >> (bit % 32)) & 1) << t;
+    }
+    return index;
+}
+
+
+ret_code_t nrf_dfu_ecdsa_fixed_key_init(uint8_t const * p_pk)
+{
+    affine_point_t   base[COMB_TEETH];
+    jacobian_point_t point;
+    num_t            lhs;
+    num_t            rhs;
+    num_t            t;
+
+    VERIFY_PARAM_NOT_NULL(p_pk);
+
+    m_pk_comb_valid = false;
+
+    num_from_le_bytes(base[0].x, p_pk);
+    num_from_le_bytes(base[0].y, p_pk + NRF_DFU_ECDSA_FIXED_KEY_PK_SIZE / 2);
+    if (num_gte(base[0].x, m_p.m) || num_gte(base[0].y, m_p.m))
+    {
+        return NRF_ERROR_INVALID_DATA;
+    }
+    mod_to_mont(base[0].x, base[0].x, &m_p);
+    mod_to_mont(base[0].y, base[0].y, &m_p);
+
+    // Check that y^2 = x^3 - 3x + b.
+    mod_sqr(lhs, base[0].y, &m_p);
+    mod_sqr(rhs, base[0].x, &m_p);
+    mod_mul(rhs, rhs, base[0].x, &m_p);
+    mod_add(t, base[0].x, base[0].x, &m_p);
+    mod_add(t, t, base[0].x, &m_p);
+    mod_sub(rhs, rhs, t, &m_p);
+    mod_add(rhs, rhs, m_b, &m_p);
+    if (memcmp(lhs, rhs, sizeof(num_t)) != 0)
+    {
+        return NRF_ERROR_INVALID_DATA;
+    }
+
+    // base[t] = 2^(64 * t) * Q
+    point_from_affine(&point, &base[0]);
+    for (uint32_t i = 1; i < COMB_TEETH; i++)
+    {
+        for (uint32_t j = 0; j < COMB_SPACING; j++)
+        {
+            point_double(&point, &point);
+        }
+        point_to_affine(&base[i], &point);
+    }
+
+    for (uint32_t j = 1; j <= COMB_POINTS; j++)
+    {
+        point_set_infinity(&point);
+        for (uint32_t i = 0; i < COMB_TEETH; i++)
+        {
+            if (j & (1 << i))
+            {
+                point_add_affine(&point, &point, &base[i]);
+            }
+        }
+        if (num_is_zero(point.z))
+        {
+            // Only possible for a key of small order, which P-256 does not have.
+            return NRF_ERROR_INVALID_DATA;
+        }
+        point_to_affine(&m_pk_comb[j - 1], &point);
+    }
+
+    m_pk_comb_valid = true;
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t nrf_dfu_ecdsa_fixed_key_verify(uint8_t const * p_hash, uint8_t const * p_signature)
+{
+    jacobian_point_t point;
+    num_t            r;
+    num_t            s;
+    num_t            e;
+    num_t            u1;
+    num_t            u2;
+
+    VERIFY_PARAM_NOT_NULL(p_hash);
+    VERIFY_PARAM_NOT_NULL(p_signature);
+
+    if (!m_pk_comb_valid)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    num_from_le_bytes(r, p_signature);
+    num_from_le_bytes(s, p_signature + NRF_DFU_ECDSA_FIXED_KEY_SIG_SIZE / 2);
+    if (num_is_zero(r) || num_is_zero(s) || num_gte(r, m_n.m) || num_gte(s, m_n.m))
+    {
+        return NRF_ERROR_INVALID_DATA;
+    }
+
+    num_from_be_bytes(e, p_hash);
+    if (num_gte(e, m_n.m))
+    {
+        (void)num_sub(e, e, m_n.m);
+    }
+
+    // w = s^-1 in the Montgomery domain, so that multiplying it by a plain number gives a plain
+    // product: u1 = e * w, u2 = r * w.
+    mod_to_mont(s, s, &m_n);
+    mod_inv(s, s, &m_n);
+    mod_mul(u1, e, s, &m_n);
+    mod_mul(u2, r, s, &m_n);
+
+    // u1 * G + u2 * Q, sharing the doublings between the two combs.
+    point_set_infinity(&point);
+    for (int32_t i = COMB_SPACING - 1; i >= 0; i--)
+    {
+        uint32_t index;
+
+        point_double(&point, &point);
+
+        index = comb_index(u1, i);
+        if (index != 0)
+        {
+            point_add_affine(&point, &point, &m_g_comb[index - 1]);
+        }
+        index = comb_index(u2, i);
+        if (index != 0)
+        {
+            point_add_affine(&point, &point, &m_pk_comb[index - 1]);
+        }
+    }
+
+    if (num_is_zero(point.z))
+    {
+        return NRF_ERROR_INVALID_DATA;
+    }
+
+    // The signature is valid if the x coordinate, reduced mod n, equals r.
+    mod_inv(e, point.z, &m_p);
+    mod_sqr(e, e, &m_p);
+    mod_mul(e, point.x, e, &m_p);
+    mod_from_mont(e, e, &m_p);
+    if (num_gte(e, m_n.m))
+    {
+        (void)num_sub(e, e, m_n.m);
+    }
+
+    if (memcmp(e, r, sizeof(num_t)) != 0)
+    {
+        return NRF_ERROR_INVALID_DATA;
+    }
+
+    return NRF_SUCCESS;
+}
+
+#endif // NRF_DFU_ECDSA_FIXED_KEY
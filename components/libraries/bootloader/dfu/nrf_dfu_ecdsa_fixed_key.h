@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @defgroup nrf_dfu_ecdsa_fixed_key ECDSA verification against the fixed DFU public key
+ * @{
+ * @ingroup  nrf_dfu
+ *
+ * @brief ECDSA P-256 signature verification specialized for the public key built into the bootloader.
+ *
+ * @details The signing key of a bootloader never changes, so both scalar multiplications of
+ *          an ECDSA verification have a fixed base: the curve generator and the public key.
+ *          This module precomputes a comb table for the public key once, in
+ *          @ref nrf_dfu_ecdsa_fixed_key_init, and uses it together with a constant table for
+ *          the generator. A verification then takes 64 point doublings, shared by both scalars,
+ *          and at most 128 mixed point additions.
+ *
+ *          The module only handles public data, so it does not need to run in constant time.
+ */
+
+#ifndef NRF_DFU_ECDSA_FIXED_KEY_H__
+#define NRF_DFU_ECDSA_FIXED_KEY_H__
+
+#include <stdint.h>
+#include "sdk_errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Size of the public key: X and Y coordinates, 32 bytes each. */
+#define NRF_DFU_ECDSA_FIXED_KEY_PK_SIZE     64
+
+/**@brief Size of the signature: R and S components, 32 bytes each. */
+#define NRF_DFU_ECDSA_FIXED_KEY_SIG_SIZE    64
+
+/**@brief Size of the hash that is signed (SHA-256). */
+#define NRF_DFU_ECDSA_FIXED_KEY_HASH_SIZE   32
+
+
+/**@brief Function for precomputing the comb table of the public key.
+ *
+ * @param[in] p_pk  Public key. X and Y are each stored in little-endian format, as in
+ *                  dfu_public_key.c.
+ *
+ * @retval NRF_SUCCESS              If the table was computed.
+ * @retval NRF_ERROR_NULL           If @p p_pk was NULL.
+ * @retval NRF_ERROR_INVALID_DATA   If the public key is not a point on the P-256 curve.
+ */
+ret_code_t nrf_dfu_ecdsa_fixed_key_init(uint8_t const * p_pk);
+
+
+/**@brief Function for verifying a signature with the public key given to
+ *        @ref nrf_dfu_ecdsa_fixed_key_init.
+ *
+ * @param[in] p_hash       SHA-256 hash of the signed data, in big-endian format.
+ * @param[in] p_signature  Signature. R and S are each stored in little-endian format, as
+ *                         received in the init packet.
+ *
+ * @retval NRF_SUCCESS              If the signature is valid.
+ * @retval NRF_ERROR_NULL           If a parameter was NULL.
+ * @retval NRF_ERROR_INVALID_STATE  If the module has not been initialized.
+ * @retval NRF_ERROR_INVALID_DATA   If the signature is not valid.
+ */
+ret_code_t nrf_dfu_ecdsa_fixed_key_verify(uint8_t const * p_hash, uint8_t const * p_signature);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_DFU_ECDSA_FIXED_KEY_H__
+
+/** @} */
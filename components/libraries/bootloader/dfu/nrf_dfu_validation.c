@@ -53,6 +53,7 @@
 #include "nrf_assert.h"
 #include "nrf_dfu_validation.h"
 #include "nrf_dfu_ver_validation.h"
+#include "nrf_dfu_ecdsa_fixed_key.h"
 #include "nrf_strerror.h"
 
 #define NRF_LOG_MODULE_NAME nrf_dfu_validation
@@ -83,11 +84,13 @@ static dfu_init_command_t const * mp_init = NULL;
 
 __ALIGN(4) extern const uint8_t pk[64];
 
+#if !NRF_DFU_ECDSA_FIXED_KEY
 /** @brief Value length structure holding the public key.
  *
  * @details The pk value pointed to is the public key present in dfu_public_key.c
  */
 static nrf_crypto_ecc_public_key_t                  m_public_key;
+#endif
 
 /** @brief Structure to hold a signature
  */
@@ -208,7 +211,6 @@ static bool stored_init_cmd_decode(void)
 static void crypto_init(void)
 {
     ret_code_t err_code;
-    uint8_t    pk_copy[sizeof(pk)];
 
     if (m_crypto_initialized)
     {
@@ -219,6 +221,14 @@ static void crypto_init(void)
     ASSERT(err_code == NRF_SUCCESS);
     UNUSED_PARAMETER(err_code);
 
+#if NRF_DFU_ECDSA_FIXED_KEY
+    // Precompute the comb table of the public key once, for all signature checks.
+    err_code = nrf_dfu_ecdsa_fixed_key_init(pk);
+    ASSERT(err_code == NRF_SUCCESS);
+    UNUSED_PARAMETER(err_code);
+#else
+    uint8_t pk_copy[sizeof(pk)];
+
     // Convert public key to big-endian format for use in nrf_crypto.
     nrf_crypto_internal_double_swap_endian(pk_copy, pk, sizeof(pk) / 2);
 
@@ -228,6 +238,7 @@ static void crypto_init(void)
                                                   sizeof(pk));
     ASSERT(err_code == NRF_SUCCESS);
     UNUSED_PARAMETER(err_code);
+#endif
 
     m_crypto_initialized = true;
 }
@@ -341,7 +352,9 @@ static nrf_dfu_result_t nrf_dfu_validation_signature_check(dfu_signature_type_t
     size_t     hash_len = NRF_CRYPTO_HASH_SIZE_SHA256;
 
     nrf_crypto_hash_context_t         hash_context   = {0};
+#if !NRF_DFU_ECDSA_FIXED_KEY
     nrf_crypto_ecdsa_verify_context_t verify_context = {0};
+#endif
 
     crypto_init();
 
@@ -381,6 +394,10 @@ static nrf_dfu_result_t nrf_dfu_validation_signature_check(dfu_signature_type_t
     // Calculate the signature.
     NRF_LOG_INFO("Verify signature");
 
+#if NRF_DFU_ECDSA_FIXED_KEY
+    // The fixed-key verifier takes the signature in little-endian format, as received.
+    err_code = nrf_dfu_ecdsa_fixed_key_verify(m_sig_hash, m_signature);
+#else
     // The signature is in little-endian format. Change it to big-endian format for nrf_crypto use.
     nrf_crypto_internal_double_swap_endian_in_place(m_signature, sizeof(m_signature) / 2);
 
@@ -390,6 +407,7 @@ static nrf_dfu_result_t nrf_dfu_validation_signature_check(dfu_signature_type_t
                                        hash_len,
                                        m_signature,
                                        sizeof(m_signature));
+#endif
     if (err_code != NRF_SUCCESS)
     {
         NRF_LOG_ERROR("Signature failed (err_code: 0x%x)", err_code);
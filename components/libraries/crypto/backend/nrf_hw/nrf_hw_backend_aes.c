@@ -0,0 +1,888 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_CRYPTO)
+
+#include <string.h>
+#include "nrf.h"
+#include "nrf_ecb.h"
+#include "nrf_crypto_error.h"
+#include "nrf_hw_backend_aes.h"
+#ifdef SOFTDEVICE_PRESENT
+#include "nrf_sdh.h"
+#include "nrf_soc.h"
+#endif
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES)
+
+#define NRF_HW_AES_BATCH_BLOCKS     (4)     /**< Number of blocks encrypted per SoftDevice call and per CTR keystream batch. */
+#define NRF_HW_AES_ROUNDS           (10)    /**< Number of AES-128 rounds. */
+
+/**@internal @brief Data structure read by the ECB peripheral through EasyDMA.
+ */
+typedef struct
+{
+    uint8_t key[NRF_HW_BACKEND_AES_KEY_SIZE];
+    uint8_t cleartext[NRF_CRYPTO_AES_BLOCK_SIZE];
+    uint8_t ciphertext[NRF_CRYPTO_AES_BLOCK_SIZE];
+} nrf_hw_aes_ecb_data_t;
+
+
+ret_code_t nrf_hw_backend_aes_blocks_encrypt(uint8_t const * p_key,
+                                             uint8_t const * p_in,
+                                             uint8_t       * p_out,
+                                             size_t          block_count)
+{
+    nrf_hw_aes_ecb_data_t ecb_data;
+
+#ifdef SOFTDEVICE_PRESENT
+    if (nrf_sdh_is_enabled())
+    {
+        // The ECB peripheral is restricted while the SoftDevice is enabled.
+        nrf_ecb_hal_data_block_t blocks[NRF_HW_AES_BATCH_BLOCKS];
+
+        while (block_count > 0)
+        {
+            uint8_t count = (uint8_t)MIN(block_count, NRF_HW_AES_BATCH_BLOCKS);
+
+            for (uint8_t i = 0; i < count; i++)
+            {
+                blocks[i].p_key        = (soc_ecb_key_t const *)p_key;
+                blocks[i].p_cleartext  = (soc_ecb_cleartext_t const *)(p_in + (i * NRF_CRYPTO_AES_BLOCK_SIZE));
+                blocks[i].p_ciphertext = (soc_ecb_ciphertext_t *)(p_out + (i * NRF_CRYPTO_AES_BLOCK_SIZE));
+            }
+
+            if (sd_ecb_blocks_encrypt(count, blocks) != NRF_SUCCESS)
+            {
+                return NRF_ERROR_CRYPTO_INTERNAL;
+            }
+
+            p_in        += count * NRF_CRYPTO_AES_BLOCK_SIZE;
+            p_out       += count * NRF_CRYPTO_AES_BLOCK_SIZE;
+            block_count -= count;
+        }
+
+        return NRF_SUCCESS;
+    }
+#endif // SOFTDEVICE_PRESENT
+
+    memcpy(ecb_data.key, p_key, sizeof(ecb_data.key));
+    nrf_ecb_data_pointer_set(NRF_ECB, &ecb_data);
+
+    for (size_t i = 0; i < block_count; i++)
+    {
+        memcpy(ecb_data.cleartext, p_in, NRF_CRYPTO_AES_BLOCK_SIZE);
+
+        // ERRORECB is only generated if the block was aborted, e.g. by the CCM. Retry then.
+        do
+        {
+            nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+            nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ERRORECB);
+            nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STARTECB);
+
+            while (!nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ENDECB) &&
+                   !nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ERRORECB))
+            {
+                // Wait for the block to be encrypted.
+            }
+        } while (nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ERRORECB));
+
+        nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+        memcpy(p_out, ecb_data.ciphertext, NRF_CRYPTO_AES_BLOCK_SIZE);
+
+        p_in  += NRF_CRYPTO_AES_BLOCK_SIZE;
+        p_out += NRF_CRYPTO_AES_BLOCK_SIZE;
+    }
+
+    // Do not leave the key on the stack.
+    memset(&ecb_data, 0, sizeof(ecb_data));
+
+    return NRF_SUCCESS;
+}
+
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_NRF_HW_AES)
+
+/**@internal @brief Type declarations of templates matching all possible context sizes
+ *                  for this backend.
+ */
+typedef struct
+{
+    nrf_crypto_aes_internal_context_t header;                           /**< Common header for context. */
+    nrf_crypto_backend_aes_ctx_t      backend;                          /**< Backend-specific internal context. */
+    uint8_t                           key[NRF_HW_BACKEND_AES_KEY_SIZE]; /**< AES key. */
+} nrf_crypto_backend_nrf_hw_aes_any_context_t;
+
+/**@internal @brief Type declarations of templates matching all possible context sizes
+ *                  for this backend.
+ */
+typedef union
+{
+    nrf_crypto_backend_nrf_hw_aes_any_context_t any;   /**< Common for all contexts. */
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB)
+    nrf_crypto_backend_aes_ecb_context_t ecb;
+#endif
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR)
+    nrf_crypto_backend_aes_ctr_context_t ctr;
+#endif
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC)
+    nrf_crypto_backend_aes_cbc_mac_context_t cbc_mac;
+#endif
+} nrf_crypto_backend_nrf_hw_aes_context_t;
+
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB)
+/* The ECB peripheral only implements the forward cipher. ECB decryption is done in software,
+   with the tables and key schedule below. */
+static uint8_t const m_sbox[256] =
+{
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16
+};
+
+static uint8_t const m_inv_sbox[256] =
+{
+    0x52, 0x09, 0x6a, 0xd5, 0x30, 0x36, 0xa5, 0x38, 0xbf, 0x40, 0xa3, 0x9e, 0x81, 0xf3, 0xd7, 0xfb,
+    0x7c, 0xe3, 0x39, 0x82, 0x9b, 0x2f, 0xff, 0x87, 0x34, 0x8e, 0x43, 0x44, 0xc4, 0xde, 0xe9, 0xcb,
+    0x54, 0x7b, 0x94, 0x32, 0xa6, 0xc2, 0x23, 0x3d, 0xee, 0x4c, 0x95, 0x0b, 0x42, 0xfa, 0xc3, 0x4e,
+    0x08, 0x2e, 0xa1, 0x66, 0x28, 0xd9, 0x24, 0xb2, 0x76, 0x5b, 0xa2, 0x49, 0x6d, 0x8b, 0xd1, 0x25,
+    0x72, 0xf8, 0xf6, 0x64, 0x86, 0x68, 0x98, 0x16, 0xd4, 0xa4, 0x5c, 0xcc, 0x5d, 0x65, 0xb6, 0x92,
+    0x6c, 0x70, 0x48, 0x50, 0xfd, 0xed, 0xb9, 0xda, 0x5e, 0x15, 0x46, 0x57, 0xa7, 0x8d, 0x9d, 0x84,
+    0x90, 0xd8, 0xab, 0x00, 0x8c, 0xbc, 0xd3, 0x0a, 0xf7, 0xe4, 0x58, 0x05, 0xb8, 0xb3, 0x45, 0x06,
+    0xd0, 0x2c, 0x1e, 0x8f, 0xca, 0x3f, 0x0f, 0x02, 0xc1, 0xaf, 0xbd, 0x03, 0x01, 0x13, 0x8a, 0x6b,
+    0x3a, 0x91, 0x11, 0x41, 0x4f, 0x67, 0xdc, 0xea, 0x97, 0xf2, 0xcf, 0xce, 0xf0, 0xb4, 0xe6, 0x73,
+    0x96, 0xac, 0x74, 0x22, 0xe7, 0xad, 0x35, 0x85, 0xe2, 0xf9, 0x37, 0xe8, 0x1c, 0x75, 0xdf, 0x6e,
+    0x47, 0xf1, 0x1a, 0x71, 0x1d, 0x29, 0xc5, 0x89, 0x6f, 0xb7, 0x62, 0x0e, 0xaa, 0x18, 0xbe, 0x1b,
+    0xfc, 0x56, 0x3e, 0x4b, 0xc6, 0xd2, 0x79, 0x20, 0x9a, 0xdb, 0xc0, 0xfe, 0x78, 0xcd, 0x5a, 0xf4,
+    0x1f, 0xdd, 0xa8, 0x33, 0x88, 0x07, 0xc7, 0x31, 0xb1, 0x12, 0x10, 0x59, 0x27, 0x80, 0xec, 0x5f,
+    0x60, 0x51, 0x7f, 0xa9, 0x19, 0xb5, 0x4a, 0x0d, 0x2d, 0xe5, 0x7a, 0x9f, 0x93, 0xc9, 0x9c, 0xef,
+    0xa0, 0xe0, 0x3b, 0x4d, 0xae, 0x2a, 0xf5, 0xb0, 0xc8, 0xeb, 0xbb, 0x3c, 0x83, 0x53, 0x99, 0x61,
+    0x17, 0x2b, 0x04, 0x7e, 0xba, 0x77, 0xd6, 0x26, 0xe1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0c, 0x7d
+};
+
+static uint8_t xtime(uint8_t x)
+{
+    return (uint8_t)((x << 1) ^ ((x & 0x80) ? 0x1B : 0x00));
+}
+
+/* Expands the key in the first 16 bytes of p_round_keys into the full key schedule. */
+static void sw_aes_key_expand(uint8_t * p_round_keys)
+{
+    uint8_t rcon = 0x01;
+    uint8_t temp[4];
+
+    for (size_t i = NRF_HW_BACKEND_AES_KEY_SIZE; i < NRF_HW_BACKEND_AES_ROUND_KEYS_SIZE; i += 4)
+    {
+        memcpy(temp, &p_round_keys[i - 4], sizeof(temp));
+
+        if ((i % NRF_HW_BACKEND_AES_KEY_SIZE) == 0)
+        {
+            uint8_t first = temp[0];
+
+            temp[0] = m_sbox[temp[1]] ^ rcon;
+            temp[1] = m_sbox[temp[2]];
+            temp[2] = m_sbox[temp[3]];
+            temp[3] = m_sbox[first];
+            rcon    = xtime(rcon);
+        }
+
+        for (size_t j = 0; j < 4; j++)
+        {
+            p_round_keys[i + j] = p_round_keys[i + j - NRF_HW_BACKEND_AES_KEY_SIZE] ^ temp[j];
+        }
+    }
+}
+
+static void sw_aes_block_decrypt(uint8_t const * p_round_keys,
+                                 uint8_t const * p_in,
+                                 uint8_t       * p_out)
+{
+    uint8_t state[NRF_CRYPTO_AES_BLOCK_SIZE];
+    uint8_t temp[NRF_CRYPTO_AES_BLOCK_SIZE];
+
+    for (size_t i = 0; i < NRF_CRYPTO_AES_BLOCK_SIZE; i++)
+    {
+        state[i] = p_in[i] ^ p_round_keys[(NRF_HW_AES_ROUNDS * NRF_CRYPTO_AES_BLOCK_SIZE) + i];
+    }
+
+    for (int round = NRF_HW_AES_ROUNDS - 1; round >= 0; round--)
+    {
+        uint8_t const * p_round_key = &p_round_keys[round * NRF_CRYPTO_AES_BLOCK_SIZE];
+
+        // InvShiftRows and InvSubBytes, then AddRoundKey. The state is stored column by column.
+        for (size_t col = 0; col < 4; col++)
+        {
+            for (size_t row = 0; row < 4; row++)
+            {
+                size_t i = (col * 4) + row;
+                temp[i]  = m_inv_sbox[state[(((col + 4 - row) & 3) * 4) + row]] ^ p_round_key[i];
+            }
+        }
+
+        if (round == 0)
+        {
+            memcpy(state, temp, sizeof(state));
+            break;
+        }
+
+        // InvMixColumns, as a pre-multiplication followed by MixColumns.
+        for (size_t col = 0; col < NRF_CRYPTO_AES_BLOCK_SIZE; col += 4)
+        {
+            uint8_t * a = &temp[col];
+            uint8_t   u = xtime(xtime(a[0] ^ a[2]));
+            uint8_t   v = xtime(xtime(a[1] ^ a[3]));
+            uint8_t   t;
+
+            a[0] ^= u;
+            a[1] ^= v;
+            a[2] ^= u;
+            a[3] ^= v;
+
+            t = a[0] ^ a[1] ^ a[2] ^ a[3];
+            state[col + 0] = a[0] ^ t ^ xtime(a[0] ^ a[1]);
+            state[col + 1] = a[1] ^ t ^ xtime(a[1] ^ a[2]);
+            state[col + 2] = a[2] ^ t ^ xtime(a[2] ^ a[3]);
+            state[col + 3] = a[3] ^ t ^ xtime(a[3] ^ a[0]);
+        }
+    }
+
+    memcpy(p_out, state, sizeof(state));
+}
+
+static ret_code_t backend_nrf_hw_ecb_crypt(nrf_crypto_backend_aes_ecb_context_t * const p_ctx,
+                                           uint8_t *                                    p_text_in,
+                                           uint8_t *                                    p_text_out,
+                                           size_t                                       text_size)
+{
+    if ((text_size & 0x0F) != 0)
+    {
+        return NRF_ERROR_CRYPTO_INPUT_LENGTH;
+    }
+
+    if (p_ctx->backend.operation == NRF_CRYPTO_ENCRYPT)
+    {
+        return nrf_hw_backend_aes_blocks_encrypt(p_ctx->u.key,
+                                                 p_text_in,
+                                                 p_text_out,
+                                                 text_size / NRF_CRYPTO_AES_BLOCK_SIZE);
+    }
+
+    for (size_t i = 0; i < text_size; i += NRF_CRYPTO_AES_BLOCK_SIZE)
+    {
+        sw_aes_block_decrypt(p_ctx->u.round_keys, p_text_in + i, p_text_out + i);
+    }
+
+    return NRF_SUCCESS;
+}
+#endif // NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB)
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR)
+/* Increments the 128-bit big-endian counter block. */
+static void ctr_increment(uint8_t * p_counter)
+{
+    for (int i = NRF_CRYPTO_AES_BLOCK_SIZE - 1; i >= 0; i--)
+    {
+        if (++p_counter[i] != 0)
+        {
+            break;
+        }
+    }
+}
+
+static ret_code_t backend_nrf_hw_ctr_crypt(nrf_crypto_backend_aes_ctr_context_t * const p_ctx,
+                                           uint8_t *                                    p_text_in,
+                                           uint8_t *                                    p_text_out,
+                                           size_t                                       text_size)
+{
+    ret_code_t ret_val;
+    uint8_t    keystream[NRF_HW_AES_BATCH_BLOCKS * NRF_CRYPTO_AES_BLOCK_SIZE];
+
+    // Use up the keystream left over from a partial block of the previous call first.
+    while ((text_size > 0) && (p_ctx->stream_offset < NRF_CRYPTO_AES_BLOCK_SIZE))
+    {
+        *p_text_out++ = *p_text_in++ ^ p_ctx->stream[p_ctx->stream_offset++];
+        text_size--;
+    }
+
+    while (text_size > 0)
+    {
+        size_t chunk  = MIN(text_size, sizeof(keystream));
+        size_t blocks = (chunk + NRF_CRYPTO_AES_BLOCK_SIZE - 1) / NRF_CRYPTO_AES_BLOCK_SIZE;
+
+        // Counter blocks for the whole batch are encrypted in one go.
+        for (size_t i = 0; i < blocks; i++)
+        {
+            memcpy(&keystream[i * NRF_CRYPTO_AES_BLOCK_SIZE],
+                   p_ctx->backend.iv,
+                   NRF_CRYPTO_AES_BLOCK_SIZE);
+            ctr_increment(p_ctx->backend.iv);
+        }
+
+        ret_val = nrf_hw_backend_aes_blocks_encrypt(p_ctx->key, keystream, keystream, blocks);
+        VERIFY_SUCCESS(ret_val);
+
+        for (size_t i = 0; i < chunk; i++)
+        {
+            p_text_out[i] = p_text_in[i] ^ keystream[i];
+        }
+
+        // Only the last batch can end inside a block. Keep the rest of it for the next call.
+        if ((chunk % NRF_CRYPTO_AES_BLOCK_SIZE) != 0)
+        {
+            memcpy(p_ctx->stream,
+                   &keystream[(blocks - 1) * NRF_CRYPTO_AES_BLOCK_SIZE],
+                   NRF_CRYPTO_AES_BLOCK_SIZE);
+            p_ctx->stream_offset = chunk % NRF_CRYPTO_AES_BLOCK_SIZE;
+        }
+
+        p_text_in  += chunk;
+        p_text_out += chunk;
+        text_size  -= chunk;
+    }
+
+    memset(keystream, 0, sizeof(keystream));
+
+    return NRF_SUCCESS;
+}
+#endif // NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR)
+
+static ret_code_t backend_nrf_hw_init(void * const p_context, nrf_crypto_operation_t operation)
+{
+    nrf_crypto_backend_nrf_hw_aes_context_t * p_ctx =
+        (nrf_crypto_backend_nrf_hw_aes_context_t *)p_context;
+
+    // The ECB peripheral only supports 128-bit keys.
+    if (p_ctx->any.header.p_info->key_size != NRF_CRYPTO_KEY_SIZE_128)
+    {
+        return NRF_ERROR_CRYPTO_KEY_SIZE;
+    }
+
+    switch (p_ctx->any.header.p_info->mode)
+    {
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR)
+        case NRF_CRYPTO_AES_MODE_CTR:
+            VERIFY_FALSE(((operation != NRF_CRYPTO_ENCRYPT) && (operation != NRF_CRYPTO_DECRYPT)),
+                         NRF_ERROR_CRYPTO_INVALID_PARAM);
+            memset(&p_ctx->ctr.backend, 0, sizeof(p_ctx->ctr.backend));
+            p_ctx->ctr.stream_offset = NRF_CRYPTO_AES_BLOCK_SIZE;
+            break;
+#endif
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB)
+        case NRF_CRYPTO_AES_MODE_ECB:
+        case NRF_CRYPTO_AES_MODE_ECB_PAD_PCKS7:
+            VERIFY_FALSE(((operation != NRF_CRYPTO_ENCRYPT) && (operation != NRF_CRYPTO_DECRYPT)),
+                         NRF_ERROR_CRYPTO_INVALID_PARAM);
+            memset(&p_ctx->ecb.backend, 0, sizeof(p_ctx->ecb.backend));
+            break;
+#endif
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC)
+        case NRF_CRYPTO_AES_MODE_CBC_MAC:
+        case NRF_CRYPTO_AES_MODE_CBC_MAC_PAD_PCKS7:
+            VERIFY_TRUE((operation == NRF_CRYPTO_MAC_CALCULATE), NRF_ERROR_CRYPTO_INVALID_PARAM);
+            memset(&p_ctx->cbc_mac.backend, 0, sizeof(p_ctx->cbc_mac.backend));
+            break;
+#endif
+
+        default:
+            return NRF_ERROR_CRYPTO_FEATURE_UNAVAILABLE;
+    }
+
+    p_ctx->any.backend.operation = operation;
+
+    return NRF_SUCCESS;
+}
+
+static ret_code_t backend_nrf_hw_uninit(void * const p_context)
+{
+    nrf_crypto_backend_nrf_hw_aes_context_t * p_ctx =
+        (nrf_crypto_backend_nrf_hw_aes_context_t *)p_context;
+
+    switch (p_ctx->any.header.p_info->mode)
+    {
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR)
+        case NRF_CRYPTO_AES_MODE_CTR:
+            memset(p_ctx->ctr.key, 0, sizeof(p_ctx->ctr.key));
+            memset(p_ctx->ctr.stream, 0, sizeof(p_ctx->ctr.stream));
+            break;
+#endif
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB)
+        case NRF_CRYPTO_AES_MODE_ECB:
+        case NRF_CRYPTO_AES_MODE_ECB_PAD_PCKS7:
+            memset(&p_ctx->ecb.u, 0, sizeof(p_ctx->ecb.u));
+            break;
+#endif
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC)
+        case NRF_CRYPTO_AES_MODE_CBC_MAC:
+        case NRF_CRYPTO_AES_MODE_CBC_MAC_PAD_PCKS7:
+            memset(p_ctx->cbc_mac.key, 0, sizeof(p_ctx->cbc_mac.key));
+            break;
+#endif
+
+        default:
+            return NRF_ERROR_CRYPTO_FEATURE_UNAVAILABLE;
+    }
+
+    return NRF_SUCCESS;
+}
+
+static ret_code_t backend_nrf_hw_key_set(void * const p_context, uint8_t * p_key)
+{
+    nrf_crypto_backend_nrf_hw_aes_context_t * p_ctx =
+        (nrf_crypto_backend_nrf_hw_aes_context_t *)p_context;
+
+    switch (p_ctx->any.header.p_info->mode)
+    {
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR)
+        case NRF_CRYPTO_AES_MODE_CTR:
+            memcpy(p_ctx->ctr.key, p_key, sizeof(p_ctx->ctr.key));
+            break;
+#endif
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB)
+        case NRF_CRYPTO_AES_MODE_ECB:
+        case NRF_CRYPTO_AES_MODE_ECB_PAD_PCKS7:
+            memcpy(p_ctx->ecb.u.key, p_key, sizeof(p_ctx->ecb.u.key));
+            if (p_ctx->ecb.backend.operation == NRF_CRYPTO_DECRYPT)
+            {
+                sw_aes_key_expand(p_ctx->ecb.u.round_keys);
+            }
+            break;
+#endif
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC)
+        case NRF_CRYPTO_AES_MODE_CBC_MAC:
+        case NRF_CRYPTO_AES_MODE_CBC_MAC_PAD_PCKS7:
+            memcpy(p_ctx->cbc_mac.key, p_key, sizeof(p_ctx->cbc_mac.key));
+            break;
+#endif
+
+        default:
+            return NRF_ERROR_CRYPTO_FEATURE_UNAVAILABLE;
+    }
+
+    return NRF_SUCCESS;
+}
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR)      ||  \
+    NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC)
+static ret_code_t backend_nrf_hw_iv_set(void * const p_context, uint8_t * p_iv)
+{
+    nrf_crypto_backend_nrf_hw_aes_context_t * p_ctx =
+        (nrf_crypto_backend_nrf_hw_aes_context_t *)p_context;
+
+    memcpy(&p_ctx->any.backend.iv[0], p_iv, sizeof(p_ctx->any.backend.iv));
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR)
+    // Keystream left over from the previous counter does not belong to the new one.
+    if (p_ctx->any.header.p_info->mode == NRF_CRYPTO_AES_MODE_CTR)
+    {
+        p_ctx->ctr.stream_offset = NRF_CRYPTO_AES_BLOCK_SIZE;
+    }
+#endif
+
+    return NRF_SUCCESS;
+}
+
+static ret_code_t backend_nrf_hw_iv_get(void * const p_context, uint8_t * p_iv)
+{
+    nrf_crypto_backend_nrf_hw_aes_context_t * p_ctx =
+        (nrf_crypto_backend_nrf_hw_aes_context_t *)p_context;
+
+    memcpy(p_iv, p_ctx->any.backend.iv, sizeof(p_ctx->any.backend.iv));
+
+    return NRF_SUCCESS;
+}
+#endif
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC)
+static ret_code_t backend_nrf_hw_cbc_mac_update(void * const p_context,
+                                                uint8_t *    p_data_in,
+                                                size_t       data_size,
+                                                uint8_t *    p_data_out)
+{
+    ret_code_t ret_val;
+
+    nrf_crypto_backend_nrf_hw_aes_context_t * p_ctx =
+        (nrf_crypto_backend_nrf_hw_aes_context_t *)p_context;
+
+    if ((data_size & 0x0F) != 0)
+    {
+        return NRF_ERROR_CRYPTO_INPUT_LENGTH;
+    }
+
+    for (size_t i = 0; i < data_size; i += NRF_CRYPTO_AES_BLOCK_SIZE)
+    {
+        for (size_t j = 0; j < NRF_CRYPTO_AES_BLOCK_SIZE; j++)
+        {
+            p_ctx->cbc_mac.backend.iv[j] ^= p_data_in[i + j];
+        }
+
+        ret_val = nrf_hw_backend_aes_blocks_encrypt(p_ctx->cbc_mac.key,
+                                                    p_ctx->cbc_mac.backend.iv,
+                                                    p_ctx->cbc_mac.backend.iv,
+                                                    1);
+        VERIFY_SUCCESS(ret_val);
+    }
+
+    if (data_size > 0)
+    {
+        memcpy(p_data_out, p_ctx->cbc_mac.backend.iv, NRF_CRYPTO_AES_BLOCK_SIZE);
+    }
+
+    return NRF_SUCCESS;
+}
+
+static ret_code_t backend_nrf_hw_cbc_mac_finalize(void * const p_context,
+                                                  uint8_t *    p_data_in,
+                                                  size_t       data_size,
+                                                  uint8_t *    p_data_out,
+                                                  size_t *     p_data_out_size)
+{
+    ret_code_t ret_val;
+
+    if (*p_data_out_size < NRF_CRYPTO_AES_BLOCK_SIZE)
+    {
+        return NRF_ERROR_CRYPTO_OUTPUT_LENGTH;
+    }
+
+    /* this function does not support padding */
+    if ((data_size & 0xF) != 0)
+    {
+        return NRF_ERROR_CRYPTO_INPUT_LENGTH;
+    }
+
+    ret_val = backend_nrf_hw_cbc_mac_update(p_context, p_data_in, data_size, p_data_out);
+    VERIFY_SUCCESS(ret_val);
+
+    *p_data_out_size = NRF_CRYPTO_AES_BLOCK_SIZE;
+
+    return NRF_SUCCESS;
+}
+
+static ret_code_t backend_nrf_hw_cbc_mac_padding_finalize(void * const p_context,
+                                                          uint8_t *    p_data_in,
+                                                          size_t       data_size,
+                                                          uint8_t *    p_data_out,
+                                                          size_t *     p_data_out_size)
+{
+    ret_code_t  ret_val;
+    uint8_t     padding_buffer[NRF_CRYPTO_AES_BLOCK_SIZE] = {0};
+    uint8_t     msg_ending = (uint8_t)(data_size & (size_t)0x0F);
+
+    if (*p_data_out_size < NRF_CRYPTO_AES_BLOCK_SIZE)
+    {
+        /* output buffer too small */
+        return NRF_ERROR_CRYPTO_OUTPUT_LENGTH;
+    }
+
+    data_size -= msg_ending;
+
+    if (data_size > 0)
+    {
+        ret_val = backend_nrf_hw_cbc_mac_update(p_context,
+                                                p_data_in,
+                                                data_size,
+                                                p_data_out);
+        VERIFY_SUCCESS(ret_val);
+    }
+
+    ret_val = padding_pkcs7_add(&padding_buffer[0],
+                                p_data_in + data_size,
+                                msg_ending);
+    VERIFY_SUCCESS(ret_val);
+
+    ret_val = backend_nrf_hw_cbc_mac_finalize(p_context,
+                                              &padding_buffer[0],
+                                              NRF_CRYPTO_AES_BLOCK_SIZE,
+                                              p_data_out,
+                                              p_data_out_size);
+    VERIFY_SUCCESS(ret_val);
+
+    return ret_val;
+}
+#endif
+
+static ret_code_t backend_nrf_hw_update(void * const p_context,
+                                        uint8_t *    p_data_in,
+                                        size_t       data_size,
+                                        uint8_t *    p_data_out)
+{
+    ret_code_t ret_val;
+
+    nrf_crypto_backend_nrf_hw_aes_context_t * p_ctx =
+        (nrf_crypto_backend_nrf_hw_aes_context_t *)p_context;
+
+    switch (p_ctx->any.header.p_info->mode)
+    {
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR)
+        case NRF_CRYPTO_AES_MODE_CTR:
+            ret_val = backend_nrf_hw_ctr_crypt(&p_ctx->ctr, p_data_in, p_data_out, data_size);
+            break;
+#endif
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB)
+        case NRF_CRYPTO_AES_MODE_ECB:
+        case NRF_CRYPTO_AES_MODE_ECB_PAD_PCKS7:
+            ret_val = backend_nrf_hw_ecb_crypt(&p_ctx->ecb, p_data_in, p_data_out, data_size);
+            break;
+#endif
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC)
+        case NRF_CRYPTO_AES_MODE_CBC_MAC:
+        case NRF_CRYPTO_AES_MODE_CBC_MAC_PAD_PCKS7:
+            ret_val = backend_nrf_hw_cbc_mac_update(p_context, p_data_in, data_size, p_data_out);
+            break;
+#endif
+
+        default:
+            return NRF_ERROR_CRYPTO_CONTEXT_NOT_INITIALIZED;
+    }
+
+    return ret_val;
+}
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR) || \
+    NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB)
+static ret_code_t backend_nrf_hw_finalize(void * const p_context,
+                                          uint8_t *    p_data_in,
+                                          size_t       data_size,
+                                          uint8_t *    p_data_out,
+                                          size_t *     p_data_out_size)
+{
+    ret_code_t ret_val;
+
+    nrf_crypto_backend_nrf_hw_aes_context_t * p_ctx =
+        (nrf_crypto_backend_nrf_hw_aes_context_t *)p_context;
+
+    if (*p_data_out_size < data_size)
+    {
+        return NRF_ERROR_CRYPTO_OUTPUT_LENGTH;
+    }
+
+    /* data is not multiple of 16 bytes */
+    if (((data_size & 0x0F) != 0) && (p_ctx->any.header.p_info->mode != NRF_CRYPTO_AES_MODE_CTR))
+    {
+        /* There are separate handlers for AES modes with padding and for MAC modes. */
+        return NRF_ERROR_CRYPTO_INPUT_LENGTH;
+    }
+
+    ret_val = backend_nrf_hw_update(p_context, p_data_in, data_size, p_data_out);
+    VERIFY_SUCCESS(ret_val);
+
+    *p_data_out_size = data_size;
+
+    return ret_val;
+}
+#endif
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB)
+static ret_code_t backend_nrf_hw_padding_finalize(void * const p_context,
+                                                  uint8_t *    p_data_in,
+                                                  size_t       data_size,
+                                                  uint8_t *    p_data_out,
+                                                  size_t *     p_data_out_size)
+{
+    ret_code_t ret_val;
+    size_t     buff_out_size;
+    uint8_t    padding_buffer[NRF_CRYPTO_AES_BLOCK_SIZE] = {0};
+    uint8_t    msg_ending = (uint8_t)(data_size & (size_t)0x0F);
+
+    nrf_crypto_backend_nrf_hw_aes_context_t * p_ctx =
+        (nrf_crypto_backend_nrf_hw_aes_context_t *)p_context;
+
+    if (p_ctx->any.backend.operation == NRF_CRYPTO_DECRYPT)
+    {
+        ret_val = backend_nrf_hw_finalize(p_context,
+                                          p_data_in,
+                                          data_size,
+                                          p_data_out,
+                                          p_data_out_size);
+        VERIFY_SUCCESS(ret_val);
+
+        ret_val = padding_pkcs7_remove(p_data_out,
+                                       p_data_out_size);
+        return ret_val;
+    }
+
+    /* -------------- ENCRYPTION --------------*/
+    data_size -= msg_ending;
+
+    if (*p_data_out_size < (data_size + NRF_CRYPTO_AES_BLOCK_SIZE))
+    {
+        /* no space for padding */
+        return NRF_ERROR_CRYPTO_OUTPUT_LENGTH;
+    }
+
+    if (data_size > 0)
+    {
+        /* Encrypt 16 byte blocks */
+        ret_val = backend_nrf_hw_update(p_context,
+                                        p_data_in,
+                                        data_size,
+                                        p_data_out);
+        VERIFY_SUCCESS(ret_val);
+    }
+
+    ret_val = padding_pkcs7_add(&padding_buffer[0],
+                                p_data_in + data_size,
+                                msg_ending);
+    VERIFY_SUCCESS(ret_val);
+
+    buff_out_size = *p_data_out_size - data_size;
+
+    ret_val = backend_nrf_hw_finalize(p_context,
+                                      &padding_buffer[0],
+                                      NRF_CRYPTO_AES_BLOCK_SIZE,
+                                      p_data_out + data_size,
+                                      &buff_out_size);
+    VERIFY_SUCCESS(ret_val);
+
+    *p_data_out_size = buff_out_size + data_size;
+
+    return ret_val;
+}
+#endif
+
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR)
+nrf_crypto_aes_info_t const g_nrf_crypto_aes_ctr_128_info =
+{
+    .mode           = NRF_CRYPTO_AES_MODE_CTR,
+    .key_size       = NRF_CRYPTO_KEY_SIZE_128,
+    .context_size   = sizeof(nrf_crypto_backend_aes_ctr_context_t),
+
+    .init_fn        = backend_nrf_hw_init,
+    .uninit_fn      = backend_nrf_hw_uninit,
+    .key_set_fn     = backend_nrf_hw_key_set,
+    .iv_set_fn      = backend_nrf_hw_iv_set,
+    .iv_get_fn      = backend_nrf_hw_iv_get,
+    .update_fn      = backend_nrf_hw_update,
+    .finalize_fn    = backend_nrf_hw_finalize
+};
+#endif
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB)
+nrf_crypto_aes_info_t const g_nrf_crypto_aes_ecb_128_info =
+{
+    .mode           = NRF_CRYPTO_AES_MODE_ECB,
+    .key_size       = NRF_CRYPTO_KEY_SIZE_128,
+    .context_size   = sizeof(nrf_crypto_backend_aes_ecb_context_t),
+
+    .init_fn        = backend_nrf_hw_init,
+    .uninit_fn      = backend_nrf_hw_uninit,
+    .key_set_fn     = backend_nrf_hw_key_set,
+    .iv_set_fn      = NULL,
+    .iv_get_fn      = NULL,
+    .update_fn      = backend_nrf_hw_update,
+    .finalize_fn    = backend_nrf_hw_finalize
+};
+
+nrf_crypto_aes_info_t const g_nrf_crypto_aes_ecb_128_pad_pkcs7_info =
+{
+    .mode           = NRF_CRYPTO_AES_MODE_ECB_PAD_PCKS7,
+    .key_size       = NRF_CRYPTO_KEY_SIZE_128,
+    .context_size   = sizeof(nrf_crypto_backend_aes_ecb_context_t),
+
+    .init_fn        = backend_nrf_hw_init,
+    .uninit_fn      = backend_nrf_hw_uninit,
+    .key_set_fn     = backend_nrf_hw_key_set,
+    .iv_set_fn      = NULL,
+    .iv_get_fn      = NULL,
+    .update_fn      = backend_nrf_hw_update,
+    .finalize_fn    = backend_nrf_hw_padding_finalize
+};
+#endif
+
+// CBC MAC
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC)
+nrf_crypto_aes_info_t const g_nrf_crypto_aes_cbc_mac_128_info =
+{
+    .mode           = NRF_CRYPTO_AES_MODE_CBC_MAC,
+    .key_size       = NRF_CRYPTO_KEY_SIZE_128,
+    .context_size   = sizeof(nrf_crypto_backend_aes_cbc_mac_context_t),
+
+    .init_fn        = backend_nrf_hw_init,
+    .uninit_fn      = backend_nrf_hw_uninit,
+    .key_set_fn     = backend_nrf_hw_key_set,
+    .iv_set_fn      = backend_nrf_hw_iv_set,
+    .iv_get_fn      = backend_nrf_hw_iv_get,
+    .update_fn      = backend_nrf_hw_update,
+    .finalize_fn    = backend_nrf_hw_cbc_mac_finalize
+};
+
+nrf_crypto_aes_info_t const g_nrf_crypto_aes_cbc_mac_128_pad_pkcs7_info =
+{
+    .mode           = NRF_CRYPTO_AES_MODE_CBC_MAC_PAD_PCKS7,
+    .key_size       = NRF_CRYPTO_KEY_SIZE_128,
+    .context_size   = sizeof(nrf_crypto_backend_aes_cbc_mac_context_t),
+
+    .init_fn        = backend_nrf_hw_init,
+    .uninit_fn      = backend_nrf_hw_uninit,
+    .key_set_fn     = backend_nrf_hw_key_set,
+    .iv_set_fn      = backend_nrf_hw_iv_set,
+    .iv_get_fn      = backend_nrf_hw_iv_get,
+    .update_fn      = backend_nrf_hw_update,
+    .finalize_fn    = backend_nrf_hw_cbc_mac_padding_finalize
+};
+#endif
+
+#endif // NRF_MODULE_ENABLED(NRF_CRYPTO_NRF_HW_AES)
+#endif // NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES)
+#endif // NRF_MODULE_ENABLED(NRF_CRYPTO)
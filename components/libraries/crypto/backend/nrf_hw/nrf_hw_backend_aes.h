@@ -0,0 +1,172 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_HW_BACKEND_AES_H__
+#define NRF_HW_BACKEND_AES_H__
+
+/** @file
+ *
+ * @defgroup nrf_crypto_nrf_hw_backend_aes nrf_crypto nRF HW backend AES
+ * @{
+ * @ingroup nrf_crypto_backends
+ *
+ * @brief AES functionality provided by the nrf_crypto nRF HW backend.
+ *
+ * @details The backend uses the AES ECB peripheral, or the SoftDevice ECB API when the
+ *          SoftDevice is enabled. The peripheral only implements the AES-128 forward cipher,
+ *          so only 128-bit keys are supported. ECB decryption uses a software inverse cipher.
+ */
+
+#include "sdk_config.h"
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES)
+
+#include "nrf_crypto_error.h"
+#include "nrf_crypto_types.h"
+#include "nrf_crypto_aes_shared.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRF_HW_BACKEND_AES_KEY_SIZE         (16)    /**< Size of the AES-128 key in bytes. */
+#define NRF_HW_BACKEND_AES_ROUND_KEYS_SIZE  (176)   /**< Size of the AES-128 key schedule in bytes. */
+
+/* AES CTR */
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR)
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_AES_CTR)
+#error "Duplicate definition of AES CTR mode. More than one backend enabled");
+#endif
+#define NRF_CRYPTO_AES_CTR_ENABLED 1
+#undef  NRF_CRYPTO_AES_ENABLED
+#define NRF_CRYPTO_AES_ENABLED 1    // Flag that nrf_crypto_aes frontend can be compiled
+#undef  NRF_CRYPTO_NRF_HW_AES_ENABLED
+#define NRF_CRYPTO_NRF_HW_AES_ENABLED 1
+
+/* defines for test purposes */
+#define NRF_CRYPTO_AES_CTR_128_ENABLED  1
+
+typedef struct
+{
+    nrf_crypto_aes_internal_context_t header;                           /**< Common header for context. */
+    nrf_crypto_backend_aes_ctx_t      backend;                          /**< Backend-specific internal context. */
+    uint8_t                           key[NRF_HW_BACKEND_AES_KEY_SIZE]; /**< AES key. */
+    uint8_t                           stream[NRF_CRYPTO_AES_BLOCK_SIZE];  /**< Keystream of the last, partially used counter block. */
+    size_t                            stream_offset;                      /**< Number of bytes of stream already used. */
+} nrf_crypto_backend_aes_ctr_context_t;
+#endif
+
+/* AES ECB */
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB)
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_AES_ECB)
+#error "Duplicate definition of AES ECB mode. More than one backend enabled");
+#endif
+#define NRF_CRYPTO_AES_ECB_ENABLED 1
+#undef  NRF_CRYPTO_AES_ENABLED
+#define NRF_CRYPTO_AES_ENABLED 1
+#undef  NRF_CRYPTO_NRF_HW_AES_ENABLED
+#define NRF_CRYPTO_NRF_HW_AES_ENABLED 1
+
+/* defines for test purposes */
+#define NRF_CRYPTO_AES_ECB_128_ENABLED  1
+
+typedef struct
+{
+    nrf_crypto_aes_internal_context_t   header;   /**< Common header for context. */
+    nrf_crypto_backend_no_iv_aes_ctx_t  backend;  /**< Backend-specific internal context. */
+    union
+    {
+        uint8_t key[NRF_HW_BACKEND_AES_KEY_SIZE];                   /**< AES key, used for encryption. */
+        uint8_t round_keys[NRF_HW_BACKEND_AES_ROUND_KEYS_SIZE];     /**< Key schedule, used for decryption. */
+    } u;
+} nrf_crypto_backend_aes_ecb_context_t;
+#endif
+
+/* AES CBC MAC */
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC)
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_AES_CBC_MAC)
+#error "Duplicate definition of AES CBC MAC mode. More than one backend enabled");
+#endif
+/* Flag that AES CBC MAC is enabled in backend */
+#define NRF_CRYPTO_AES_CBC_MAC_ENABLED 1
+#undef  NRF_CRYPTO_AES_ENABLED
+#define NRF_CRYPTO_AES_ENABLED 1    // Flag that nrf_crypto_aes frontend can be compiled
+#undef  NRF_CRYPTO_NRF_HW_AES_ENABLED
+#define NRF_CRYPTO_NRF_HW_AES_ENABLED 1
+
+/* defines for test purposes */
+#define NRF_CRYPTO_AES_CBC_MAC_128_ENABLED  1
+
+typedef struct
+{
+    nrf_crypto_aes_internal_context_t header;                           /**< Common header for context. */
+    nrf_crypto_backend_aes_ctx_t      backend;                          /**< Backend-specific internal context. */
+    uint8_t                           key[NRF_HW_BACKEND_AES_KEY_SIZE]; /**< AES key. */
+} nrf_crypto_backend_aes_cbc_mac_context_t;
+#endif
+
+
+/**@internal @brief Function for encrypting AES-128 blocks with the ECB peripheral.
+ *
+ * @details Uses the SoftDevice ECB API when the SoftDevice is enabled, and the ECB peripheral
+ *          directly otherwise. Input and output may overlap.
+ *
+ * @param[in]  p_key        Pointer to the 128-bit key.
+ * @param[in]  p_in         Pointer to the plaintext blocks.
+ * @param[out] p_out        Pointer to the buffer for the ciphertext blocks.
+ * @param[in]  block_count  Number of 16-byte blocks to encrypt.
+ *
+ * @retval NRF_SUCCESS                  Blocks encrypted.
+ * @retval NRF_ERROR_CRYPTO_INTERNAL    The SoftDevice refused the request.
+ */
+ret_code_t nrf_hw_backend_aes_blocks_encrypt(uint8_t const * p_key,
+                                             uint8_t const * p_in,
+                                             uint8_t       * p_out,
+                                             size_t          block_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES)
+
+/** @} */
+
+#endif // NRF_HW_BACKEND_AES_H__
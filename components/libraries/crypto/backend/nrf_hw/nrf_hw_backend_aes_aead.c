@@ -0,0 +1,514 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NRF_CRYPTO)
+
+#include <string.h>
+#include "nrf.h"
+#include "nrf_ccm.h"
+#include "nrf_crypto_error.h"
+#include "nrf_hw_backend_aes_aead.h"
+#ifdef SOFTDEVICE_PRESENT
+#include "nrf_sdh.h"
+#endif
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_NRF_HW_AES_AEAD)
+
+#define CCM_BATCH_BLOCKS            (4)     /**< Number of keystream blocks encrypted in one go. */
+#define CCM_B0_FLAG_ADATA           (0x40)  /**< Flag in the B0 block indicating that additional data is present. */
+#define CCM_ADATA_SHORT_LIMIT       (0xFF00)/**< Additional data shorter than this has a 2-byte length encoding. */
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_PERIPHERAL)
+#define CCM_PERIPH_NONCE_SIZE       (13)    /**< Nonce size used by the CCM peripheral: 39-bit counter, direction bit and 8-byte IV. */
+#define CCM_PERIPH_MAC_SIZE         (4)     /**< MIC size appended by the CCM peripheral. */
+#define CCM_PERIPH_ADATA_MASK       (0xE3)  /**< Bits of the packet header byte authenticated by the CCM peripheral. */
+#define CCM_PERIPH_HEADER_SIZE      (3)     /**< Size of the S0, LENGTH and S1 fields in the CCM packet. */
+#define CCM_PERIPH_PAYLOAD_MAX      (251)   /**< Maximum payload in extended length mode. */
+#define CCM_PERIPH_PACKET_SIZE      (CCM_PERIPH_HEADER_SIZE + CCM_PERIPH_PAYLOAD_MAX + CCM_PERIPH_MAC_SIZE)
+#define CCM_PERIPH_SCRATCH_SIZE     (16 + CCM_PERIPH_PAYLOAD_MAX)
+
+/**@internal @brief CCM data structure read by the CCM peripheral through EasyDMA.
+ */
+typedef struct
+{
+    uint8_t key[NRF_HW_BACKEND_AES_KEY_SIZE];
+    uint8_t counter[8];                         /**< 39-bit packet counter, little endian. */
+    uint8_t direction;
+    uint8_t iv[8];
+} ccm_periph_cnf_t;
+
+__ALIGN(4) static ccm_periph_cnf_t m_ccm_cnf;
+static uint32_t                    m_ccm_packet_in[CEIL_DIV(CCM_PERIPH_PACKET_SIZE, sizeof(uint32_t))];
+static uint32_t                    m_ccm_packet_out[CEIL_DIV(CCM_PERIPH_PACKET_SIZE, sizeof(uint32_t))];
+static uint32_t                    m_ccm_scratch[CEIL_DIV(CCM_PERIPH_SCRATCH_SIZE, sizeof(uint32_t))];
+#endif // NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_PERIPHERAL)
+
+/**@internal @brief State of the CBC-MAC computation of the CCM tag.
+ */
+typedef struct
+{
+    uint8_t x[NRF_CRYPTO_AES_BLOCK_SIZE];   /**< Chaining value. */
+    size_t  fill;                           /**< Number of bytes added to the current block. */
+} ccm_mac_state_t;
+
+
+static ret_code_t ccm_mac_feed(uint8_t const *   p_key,
+                               ccm_mac_state_t * p_state,
+                               uint8_t const *   p_data,
+                               size_t            size)
+{
+    ret_code_t ret_val;
+
+    while (size > 0)
+    {
+        p_state->x[p_state->fill++] ^= *p_data++;
+        size--;
+
+        if (p_state->fill == NRF_CRYPTO_AES_BLOCK_SIZE)
+        {
+            ret_val = nrf_hw_backend_aes_blocks_encrypt(p_key, p_state->x, p_state->x, 1);
+            VERIFY_SUCCESS(ret_val);
+            p_state->fill = 0;
+        }
+    }
+
+    return NRF_SUCCESS;
+}
+
+/* Zero-pads the current block, as CCM does after the additional data and the payload. */
+static ret_code_t ccm_mac_pad(uint8_t const * p_key, ccm_mac_state_t * p_state)
+{
+    if (p_state->fill == 0)
+    {
+        return NRF_SUCCESS;
+    }
+
+    p_state->fill = 0;
+
+    return nrf_hw_backend_aes_blocks_encrypt(p_key, p_state->x, p_state->x, 1);
+}
+
+static ret_code_t ccm_mac_compute(uint8_t const * p_key,
+                                  uint8_t const * p_nonce,
+                                  uint8_t         nonce_size,
+                                  uint8_t const * p_adata,
+                                  size_t          adata_size,
+                                  uint8_t const * p_data,
+                                  size_t          data_size,
+                                  uint8_t         mac_size,
+                                  uint8_t *       p_mac)
+{
+    ret_code_t      ret_val;
+    ccm_mac_state_t state;
+    uint8_t         b0[NRF_CRYPTO_AES_BLOCK_SIZE];
+    uint8_t         adata_len[6];
+    size_t          adata_len_size;
+    uint8_t         q = (uint8_t)(NRF_CRYPTO_AES_BLOCK_SIZE - 1 - nonce_size);
+    size_t          len = data_size;
+
+    b0[0] = (uint8_t)(((adata_size > 0) ? CCM_B0_FLAG_ADATA : 0) |
+                      (((mac_size - 2) / 2) << 3) |
+                      (q - 1));
+    memcpy(&b0[1], p_nonce, nonce_size);
+    for (uint8_t i = 0; i < q; i++)
+    {
+        b0[NRF_CRYPTO_AES_BLOCK_SIZE - 1 - i] = (uint8_t)len;
+        len >>= 8;
+    }
+
+    memset(&state, 0, sizeof(state));
+    ret_val = ccm_mac_feed(p_key, &state, b0, sizeof(b0));
+    VERIFY_SUCCESS(ret_val);
+
+    if (adata_size > 0)
+    {
+        if (adata_size < CCM_ADATA_SHORT_LIMIT)
+        {
+            adata_len[0]   = (uint8_t)(adata_size >> 8);
+            adata_len[1]   = (uint8_t)adata_size;
+            adata_len_size = 2;
+        }
+        else
+        {
+            adata_len[0]   = 0xFF;
+            adata_len[1]   = 0xFE;
+            adata_len[2]   = (uint8_t)(adata_size >> 24);
+            adata_len[3]   = (uint8_t)(adata_size >> 16);
+            adata_len[4]   = (uint8_t)(adata_size >> 8);
+            adata_len[5]   = (uint8_t)adata_size;
+            adata_len_size = 6;
+        }
+
+        ret_val = ccm_mac_feed(p_key, &state, adata_len, adata_len_size);
+        VERIFY_SUCCESS(ret_val);
+        ret_val = ccm_mac_feed(p_key, &state, p_adata, adata_size);
+        VERIFY_SUCCESS(ret_val);
+        ret_val = ccm_mac_pad(p_key, &state);
+        VERIFY_SUCCESS(ret_val);
+    }
+
+    ret_val = ccm_mac_feed(p_key, &state, p_data, data_size);
+    VERIFY_SUCCESS(ret_val);
+    ret_val = ccm_mac_pad(p_key, &state);
+    VERIFY_SUCCESS(ret_val);
+
+    memcpy(p_mac, state.x, mac_size);
+
+    return NRF_SUCCESS;
+}
+
+/* Runs CTR mode starting at counter block A1 and returns the first mac_size bytes of the
+   S0 keystream block, used to encrypt the tag, in p_tag_mask. */
+static ret_code_t ccm_ctr_crypt(uint8_t const * p_key,
+                                uint8_t const * p_nonce,
+                                uint8_t         nonce_size,
+                                uint8_t const * p_data_in,
+                                size_t          data_size,
+                                uint8_t *       p_data_out,
+                                uint8_t *       p_tag_mask,
+                                uint8_t         mac_size)
+{
+    ret_code_t ret_val;
+    uint8_t    keystream[CCM_BATCH_BLOCKS * NRF_CRYPTO_AES_BLOCK_SIZE];
+    uint8_t    q       = (uint8_t)(NRF_CRYPTO_AES_BLOCK_SIZE - 1 - nonce_size);
+    uint32_t   counter = 0;
+    size_t     offset  = 0;
+    bool       first   = true;
+
+    while (first || (offset < data_size))
+    {
+        size_t chunk;
+        size_t blocks;
+        size_t skip = first ? NRF_CRYPTO_AES_BLOCK_SIZE : 0;
+
+        chunk  = MIN(data_size - offset, sizeof(keystream) - skip);
+        blocks = CEIL_DIV(chunk + skip, NRF_CRYPTO_AES_BLOCK_SIZE);
+
+        for (size_t i = 0; i < blocks; i++)
+        {
+            uint8_t * p_block = &keystream[i * NRF_CRYPTO_AES_BLOCK_SIZE];
+            uint32_t  value   = counter++;
+
+            memset(p_block, 0, NRF_CRYPTO_AES_BLOCK_SIZE);
+            p_block[0] = q - 1;
+            memcpy(&p_block[1], p_nonce, nonce_size);
+            for (uint8_t j = 0; (j < q) && (j < sizeof(value)); j++)
+            {
+                p_block[NRF_CRYPTO_AES_BLOCK_SIZE - 1 - j] = (uint8_t)value;
+                value >>= 8;
+            }
+        }
+
+        ret_val = nrf_hw_backend_aes_blocks_encrypt(p_key, keystream, keystream, blocks);
+        VERIFY_SUCCESS(ret_val);
+
+        if (first)
+        {
+            memcpy(p_tag_mask, keystream, mac_size);
+            first = false;
+        }
+
+        for (size_t i = 0; i < chunk; i++)
+        {
+            p_data_out[offset + i] = p_data_in[offset + i] ^ keystream[skip + i];
+        }
+
+        offset += chunk;
+    }
+
+    memset(keystream, 0, sizeof(keystream));
+
+    return NRF_SUCCESS;
+}
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_PERIPHERAL)
+static bool ccm_periph_usable(uint8_t         nonce_size,
+                              uint8_t const * p_adata,
+                              size_t          adata_size,
+                              size_t          data_size,
+                              uint8_t         mac_size)
+{
+#ifdef SOFTDEVICE_PRESENT
+    // The CCM peripheral is restricted while the SoftDevice is enabled.
+    if (nrf_sdh_is_enabled())
+    {
+        return false;
+    }
+#endif
+
+    return (nonce_size == CCM_PERIPH_NONCE_SIZE)                                &&
+           (mac_size   == CCM_PERIPH_MAC_SIZE)                                  &&
+           (adata_size == 1)                                                    &&
+           ((p_adata[0] & CCM_PERIPH_ADATA_MASK) == p_adata[0])                 &&
+           (data_size > 0) && (data_size <= CCM_PERIPH_PAYLOAD_MAX);
+}
+
+/* Processes one packet with the CCM peripheral. The 13-byte nonce maps onto the 39-bit packet
+   counter, the direction bit and the 8-byte IV, and the single byte of additional data is the
+   packet header. */
+static ret_code_t ccm_periph_crypt(uint8_t const *        p_key,
+                                   nrf_crypto_operation_t operation,
+                                   uint8_t const *        p_nonce,
+                                   uint8_t                adata,
+                                   uint8_t const *        p_data_in,
+                                   size_t                 data_size,
+                                   uint8_t *              p_data_out,
+                                   uint8_t *              p_mac)
+{
+    ret_code_t         ret_val = NRF_SUCCESS;
+    uint8_t          * p_in    = (uint8_t *)m_ccm_packet_in;
+    uint8_t          * p_out   = (uint8_t *)m_ccm_packet_out;
+    nrf_ccm_config_t   config  =
+    {
+        .mode     = (operation == NRF_CRYPTO_ENCRYPT) ? NRF_CCM_MODE_ENCRYPTION
+                                                      : NRF_CCM_MODE_DECRYPTION,
+        .datarate = NRF_CCM_DATARATE_2M,
+        .length   = NRF_CCM_LENGTH_EXTENDED,
+    };
+
+    memcpy(m_ccm_cnf.key, p_key, sizeof(m_ccm_cnf.key));
+    memset(m_ccm_cnf.counter, 0, sizeof(m_ccm_cnf.counter));
+    memcpy(m_ccm_cnf.counter, p_nonce, 5);
+    m_ccm_cnf.counter[4] &= 0x7F;
+    m_ccm_cnf.direction   = (uint8_t)(p_nonce[4] >> 7);
+    memcpy(m_ccm_cnf.iv, &p_nonce[5], sizeof(m_ccm_cnf.iv));
+
+    p_in[0] = adata;
+    p_in[2] = 0;
+    memcpy(&p_in[CCM_PERIPH_HEADER_SIZE], p_data_in, data_size);
+    if (operation == NRF_CRYPTO_ENCRYPT)
+    {
+        p_in[1] = (uint8_t)data_size;
+    }
+    else
+    {
+        p_in[1] = (uint8_t)(data_size + CCM_PERIPH_MAC_SIZE);
+        memcpy(&p_in[CCM_PERIPH_HEADER_SIZE + data_size], p_mac, CCM_PERIPH_MAC_SIZE);
+    }
+
+    nrf_ccm_enable(NRF_CCM);
+    nrf_ccm_configure(NRF_CCM, &config);
+    nrf_ccm_cnfptr_set(NRF_CCM, (uint32_t const *)&m_ccm_cnf);
+    nrf_ccm_inptr_set(NRF_CCM, m_ccm_packet_in);
+    nrf_ccm_outptr_set(NRF_CCM, m_ccm_packet_out);
+    nrf_ccm_scratchptr_set(NRF_CCM, m_ccm_scratch);
+    NRF_CCM->SHORTS = CCM_SHORTS_ENDKSGEN_CRYPT_Msk;
+
+    nrf_ccm_event_clear(NRF_CCM, NRF_CCM_EVENT_ENDKSGEN);
+    nrf_ccm_event_clear(NRF_CCM, NRF_CCM_EVENT_ENDCRYPT);
+    nrf_ccm_event_clear(NRF_CCM, NRF_CCM_EVENT_ERROR);
+    nrf_ccm_task_trigger(NRF_CCM, NRF_CCM_TASK_KSGEN);
+
+    while (!nrf_ccm_event_check(NRF_CCM, NRF_CCM_EVENT_ENDCRYPT) &&
+           !nrf_ccm_event_check(NRF_CCM, NRF_CCM_EVENT_ERROR))
+    {
+        // Wait for the packet to be processed.
+    }
+
+    if (nrf_ccm_event_check(NRF_CCM, NRF_CCM_EVENT_ERROR))
+    {
+        ret_val = NRF_ERROR_CRYPTO_INTERNAL;
+    }
+    else if (operation == NRF_CRYPTO_ENCRYPT)
+    {
+        memcpy(p_data_out, &p_out[CCM_PERIPH_HEADER_SIZE], data_size);
+        memcpy(p_mac, &p_out[CCM_PERIPH_HEADER_SIZE + data_size], CCM_PERIPH_MAC_SIZE);
+    }
+    else if (nrf_ccm_micstatus_get(NRF_CCM))
+    {
+        memcpy(p_data_out, &p_out[CCM_PERIPH_HEADER_SIZE], data_size);
+    }
+    else
+    {
+        memset(p_data_out, 0, data_size);
+        ret_val = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC;
+    }
+
+    NRF_CCM->SHORTS = 0;
+    nrf_ccm_disable(NRF_CCM);
+
+    memset(&m_ccm_cnf, 0, sizeof(m_ccm_cnf));
+    memset(m_ccm_packet_in, 0, sizeof(m_ccm_packet_in));
+    memset(m_ccm_packet_out, 0, sizeof(m_ccm_packet_out));
+
+    return ret_val;
+}
+#endif // NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_PERIPHERAL)
+
+static ret_code_t backend_nrf_hw_init(void * const p_context, uint8_t * p_key)
+{
+    nrf_crypto_backend_aes_ccm_context_t * p_ctx =
+        (nrf_crypto_backend_aes_ccm_context_t *)p_context;
+
+    // The ECB and CCM peripherals only support 128-bit keys.
+    if (p_ctx->header.p_info->key_size != NRF_CRYPTO_KEY_SIZE_128)
+    {
+        return NRF_ERROR_CRYPTO_KEY_SIZE;
+    }
+
+    if (p_ctx->header.p_info->mode != NRF_CRYPTO_AEAD_MODE_AES_CCM)
+    {
+        return NRF_ERROR_CRYPTO_FEATURE_UNAVAILABLE;
+    }
+
+    memcpy(p_ctx->key, p_key, sizeof(p_ctx->key));
+
+    return NRF_SUCCESS;
+}
+
+static ret_code_t backend_nrf_hw_uninit(void * const p_context)
+{
+    nrf_crypto_backend_aes_ccm_context_t * p_ctx =
+        (nrf_crypto_backend_aes_ccm_context_t *)p_context;
+
+    memset(p_ctx->key, 0, sizeof(p_ctx->key));
+
+    return NRF_SUCCESS;
+}
+
+static ret_code_t backend_nrf_hw_ccm_crypt(void * const            p_context,
+                                           nrf_crypto_operation_t  operation,
+                                           uint8_t *               p_nonce,
+                                           uint8_t                 nonce_size,
+                                           uint8_t *               p_adata,
+                                           size_t                  adata_size,
+                                           uint8_t *               p_data_in,
+                                           size_t                  data_in_size,
+                                           uint8_t *               p_data_out,
+                                           uint8_t *               p_mac,
+                                           uint8_t                 mac_size)
+{
+    ret_code_t ret_val;
+    uint8_t    tag[NRF_CRYPTO_AES_CCM_MAC_MAX];
+    uint8_t    tag_mask[NRF_CRYPTO_AES_CCM_MAC_MAX];
+    uint8_t    diff = 0;
+
+    nrf_crypto_backend_aes_ccm_context_t * p_ctx =
+        (nrf_crypto_backend_aes_ccm_context_t *)p_context;
+
+    /* CCM mode allows following MAC sizes: [4, 6, 8, 10, 12, 14, 16] */
+    if ((mac_size < NRF_CRYPTO_AES_CCM_MAC_MIN) || (mac_size > NRF_CRYPTO_AES_CCM_MAC_MAX) ||
+        ((mac_size & 0x01) != 0))
+    {
+        return NRF_ERROR_CRYPTO_AEAD_MAC_SIZE;
+    }
+
+    if ((nonce_size < NRF_CRYPTO_AES_CCM_NONCE_SIZE_MIN) ||
+        (nonce_size > NRF_CRYPTO_AES_CCM_NONCE_SIZE_MAX))
+    {
+        return NRF_ERROR_CRYPTO_AEAD_NONCE_SIZE;
+    }
+
+    if ((operation != NRF_CRYPTO_ENCRYPT) && (operation != NRF_CRYPTO_DECRYPT))
+    {
+        return NRF_ERROR_CRYPTO_INVALID_PARAM;
+    }
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_PERIPHERAL)
+    if (ccm_periph_usable(nonce_size, p_adata, adata_size, data_in_size, mac_size))
+    {
+        return ccm_periph_crypt(p_ctx->key,
+                                operation,
+                                p_nonce,
+                                p_adata[0],
+                                p_data_in,
+                                data_in_size,
+                                p_data_out,
+                                p_mac);
+    }
+#endif
+
+    if (operation == NRF_CRYPTO_ENCRYPT)
+    {
+        // The tag covers the plaintext, so it is computed before p_data_in may be overwritten.
+        ret_val = ccm_mac_compute(p_ctx->key, p_nonce, nonce_size, p_adata, adata_size,
+                                  p_data_in, data_in_size, mac_size, tag);
+        VERIFY_SUCCESS(ret_val);
+
+        ret_val = ccm_ctr_crypt(p_ctx->key, p_nonce, nonce_size, p_data_in, data_in_size,
+                                p_data_out, tag_mask, mac_size);
+        VERIFY_SUCCESS(ret_val);
+
+        for (uint8_t i = 0; i < mac_size; i++)
+        {
+            p_mac[i] = tag[i] ^ tag_mask[i];
+        }
+
+        return NRF_SUCCESS;
+    }
+
+    ret_val = ccm_ctr_crypt(p_ctx->key, p_nonce, nonce_size, p_data_in, data_in_size,
+                            p_data_out, tag_mask, mac_size);
+    VERIFY_SUCCESS(ret_val);
+
+    ret_val = ccm_mac_compute(p_ctx->key, p_nonce, nonce_size, p_adata, adata_size,
+                              p_data_out, data_in_size, mac_size, tag);
+    VERIFY_SUCCESS(ret_val);
+
+    // Constant time comparison of the tag.
+    for (uint8_t i = 0; i < mac_size; i++)
+    {
+        diff |= (uint8_t)(p_mac[i] ^ tag[i] ^ tag_mask[i]);
+    }
+
+    if (diff != 0)
+    {
+        memset(p_data_out, 0, data_in_size);
+        return NRF_ERROR_CRYPTO_AEAD_INVALID_MAC;
+    }
+
+    return NRF_SUCCESS;
+}
+
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM)
+nrf_crypto_aead_info_t const g_nrf_crypto_aes_ccm_128_info =
+{
+    .key_size  = NRF_CRYPTO_KEY_SIZE_128,
+    .mode      = NRF_CRYPTO_AEAD_MODE_AES_CCM,
+
+    .init_fn   = backend_nrf_hw_init,
+    .uninit_fn = backend_nrf_hw_uninit,
+    .crypt_fn  = backend_nrf_hw_ccm_crypt
+};
+#endif
+
+#endif // NRF_MODULE_ENABLED(NRF_CRYPTO_NRF_HW_AES_AEAD)
+#endif // NRF_MODULE_ENABLED(NRF_CRYPTO)
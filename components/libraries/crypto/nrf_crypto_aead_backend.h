@@ -45,6 +45,7 @@
 #include "cc310_backend_chacha_poly_aead.h"
 #include "cifra_backend_aes_aead.h"
 #include "mbedtls_backend_aes_aead.h"
+#include "nrf_hw_backend_aes_aead.h"
 #include "oberon_backend_chacha_poly_aead.h"
 
 #ifdef __cplusplus
@@ -76,7 +76,7 @@ extern "C" {
  */
 typedef enum
 {
-    NRF_CRYPTO_AEAD_MODE_AES_CCM,       // supported by: MBEDTLS & CC310
+    NRF_CRYPTO_AEAD_MODE_AES_CCM,       // supported by: MBEDTLS & CC310 & NRF_HW
     NRF_CRYPTO_AEAD_MODE_AES_CCM_STAR,  // supported by: CC310
     NRF_CRYPTO_AEAD_MODE_AES_EAX,       // supported by: CIFRA
     NRF_CRYPTO_AEAD_MODE_AES_GCM,       // supported by: MBEDTLS
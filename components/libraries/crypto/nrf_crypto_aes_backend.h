@@ -43,6 +43,7 @@
 
 #include "cc310_backend_aes.h"
 #include "mbedtls_backend_aes.h"
+#include "nrf_hw_backend_aes.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -73,13 +73,13 @@ typedef enum
     NRF_CRYPTO_AES_MODE_CBC,                // supported by: MBEDTLS & CC310
     NRF_CRYPTO_AES_MODE_CBC_PAD_PCKS7,      // supported by: MBEDTLS & CC310
     NRF_CRYPTO_AES_MODE_CFB,                // supported by: MBEDTLS
-    NRF_CRYPTO_AES_MODE_CTR,                // supported by: MBEDTLS & CC310
-    NRF_CRYPTO_AES_MODE_ECB,                // supported by: MBEDTLS & CC310
-    NRF_CRYPTO_AES_MODE_ECB_PAD_PCKS7,      // supported by: MBEDTLS & CC310
+    NRF_CRYPTO_AES_MODE_CTR,                // supported by: MBEDTLS & CC310 & NRF_HW
+    NRF_CRYPTO_AES_MODE_ECB,                // supported by: MBEDTLS & CC310 & NRF_HW
+    NRF_CRYPTO_AES_MODE_ECB_PAD_PCKS7,      // supported by: MBEDTLS & CC310 & NRF_HW
 
     // Authentication modes
-    NRF_CRYPTO_AES_MODE_CBC_MAC,            // supported by: MBEDTLS & CC310
-    NRF_CRYPTO_AES_MODE_CBC_MAC_PAD_PCKS7,  // supported by: MBEDTLS & CC310
+    NRF_CRYPTO_AES_MODE_CBC_MAC,            // supported by: MBEDTLS & CC310 & NRF_HW
+    NRF_CRYPTO_AES_MODE_CBC_MAC_PAD_PCKS7,  // supported by: MBEDTLS & CC310 & NRF_HW
     NRF_CRYPTO_AES_MODE_CMAC,               // supported by: MBEDTLS & CC310
 } nrf_crypto_aes_mode_t;
 
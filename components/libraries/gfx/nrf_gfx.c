@@ -154,6 +154,41 @@ static void line_draw(nrf_lcd_t const * p_instance,
     }
 }
 
+/* Applications with an sdk_config.h that predates the option get the template value. */
+#ifndef NRF_GFX_LINE_BUFFER_SIZE
+#define NRF_GFX_LINE_BUFFER_SIZE 320
+#endif
+
+static uint16_t m_line_buffer[NRF_GFX_LINE_BUFFER_SIZE];
+
+static inline bool glyph_bit_get(uint8_t const * p_glyph,
+                                 uint16_t bytes_in_line,
+                                 uint16_t row,
+                                 uint16_t column)
+{
+    return (p_glyph[row * bytes_in_line + column / 8] & (0x80 >> (column % 8))) != 0;
+}
+
+static uint16_t char_width_get(nrf_gfx_font_desc_t const * p_font, uint8_t character)
+{
+    if (character == ' ')
+    {
+        return p_font->height / 2;
+    }
+
+    return p_font->charInfo[character - p_font->startChar].widthBits;
+}
+
+static uint16_t char_advance_get(nrf_gfx_font_desc_t const * p_font, uint8_t character)
+{
+    if (character == ' ')
+    {
+        return p_font->height / 2;
+    }
+
+    return p_font->charInfo[character - p_font->startChar].widthBits + p_font->spacePixels;
+}
+
 static void write_character(nrf_lcd_t const * p_instance,
                             nrf_gfx_font_desc_t const * p_font,
                             uint8_t character,
@@ -163,6 +198,7 @@ static void write_character(nrf_lcd_t const * p_instance,
 {
     uint8_t char_idx = character - p_font->startChar;
     uint16_t bytes_in_line = CEIL_DIV(p_font->charInfo[char_idx].widthBits, 8);
+    uint8_t const * p_glyph = &p_font->data[p_font->charInfo[char_idx].offset];
 
     if (character == ' ')
     {
@@ -170,24 +206,136 @@ static void write_character(nrf_lcd_t const * p_instance,
         return;
     }
 
+    // Horizontal runs of set pixels are drawn as one rectangle each.
     for (uint16_t i = 0; i < p_font->height; i++)
     {
-        for (uint16_t j = 0; j < bytes_in_line; j++)
+        uint16_t run_start = 0;
+        uint16_t run_length = 0;
+
+        for (uint16_t j = 0; j < bytes_in_line * 8; j++)
         {
-            for (uint8_t k = 0; k < 8; k++)
+            if (glyph_bit_get(p_glyph, bytes_in_line, i, j))
             {
-                if ((1 << (7 - k)) &
-                    p_font->data[p_font->charInfo[char_idx].offset + i * bytes_in_line + j])
+                if (run_length == 0)
                 {
-                    pixel_draw(p_instance, *p_x + j * 8 + k, y + i, font_color);
+                    run_start = j;
                 }
+                run_length++;
+            }
+            else if (run_length > 0)
+            {
+                rect_draw(p_instance, *p_x + run_start, y + i, run_length, 1, font_color);
+                run_length = 0;
             }
         }
+
+        if (run_length > 0)
+        {
+            rect_draw(p_instance, *p_x + run_start, y + i, run_length, 1, font_color);
+        }
     }
 
     *p_x += p_font->charInfo[char_idx].widthBits + p_font->spacePixels;
 }
 
+static void text_band_render(nrf_gfx_font_desc_t const * p_font,
+                             char const * string,
+                             size_t length,
+                             uint16_t band_x,
+                             uint16_t band_y,
+                             uint16_t width,
+                             uint16_t height,
+                             uint16_t font_color,
+                             uint16_t bg_color)
+{
+    uint32_t glyph_x = 0;
+
+    for (uint32_t i = 0; i < (uint32_t)width * height; i++)
+    {
+        m_line_buffer[i] = bg_color;
+    }
+
+    for (size_t i = 0; (i < length) && (glyph_x < (uint32_t)band_x + width); i++)
+    {
+        uint8_t character = (uint8_t)string[i];
+
+        if (character != ' ')
+        {
+            uint8_t char_idx = character - p_font->startChar;
+            uint16_t glyph_width = p_font->charInfo[char_idx].widthBits;
+            uint16_t bytes_in_line = CEIL_DIV(glyph_width, 8);
+            uint8_t const * p_glyph = &p_font->data[p_font->charInfo[char_idx].offset];
+
+            // Columns of the glyph that fall inside the band.
+            uint32_t first = MAX(glyph_x, band_x);
+            uint32_t last = MIN(glyph_x + glyph_width, (uint32_t)band_x + width);
+
+            for (uint16_t row = 0; row < height; row++)
+            {
+                uint16_t * p_line = &m_line_buffer[row * width];
+
+                for (uint32_t column = first; column < last; column++)
+                {
+                    if (glyph_bit_get(p_glyph, bytes_in_line, band_y + row, column - glyph_x))
+                    {
+                        p_line[column - band_x] = font_color;
+                    }
+                }
+            }
+        }
+
+        glyph_x += char_advance_get(p_font, character);
+    }
+}
+
+static void text_line_draw(nrf_lcd_t const * p_instance,
+                           nrf_gfx_font_desc_t const * p_font,
+                           char const * string,
+                           size_t length,
+                           uint16_t x,
+                           uint16_t y,
+                           uint16_t width,
+                           uint16_t font_color,
+                           uint16_t bg_color)
+{
+    if (width == 0)
+    {
+        return;
+    }
+
+    if (p_instance->lcd_bitmap_draw == NULL)
+    {
+        rect_draw(p_instance, x, y, width, p_font->height, bg_color);
+
+        for (size_t i = 0; i < length; i++)
+        {
+            write_character(p_instance, p_font, (uint8_t)string[i], &x, y, font_color);
+        }
+        return;
+    }
+
+    // The line is split into bands that fit in the line buffer, each sent as one bitmap.
+    for (uint16_t band_x = 0; band_x < width; )
+    {
+        uint16_t band_width = MIN(width - band_x, NRF_GFX_LINE_BUFFER_SIZE);
+        uint16_t rows_per_band = NRF_GFX_LINE_BUFFER_SIZE / band_width;
+
+        for (uint16_t band_y = 0; band_y < p_font->height; )
+        {
+            uint16_t band_height = MIN(p_font->height - band_y, rows_per_band);
+
+            text_band_render(p_font, string, length, band_x, band_y,
+                             band_width, band_height, font_color, bg_color);
+            p_instance->lcd_bitmap_draw(x + band_x, y + band_y,
+                                        band_width, band_height, m_line_buffer);
+
+            band_y += band_height;
+        }
+
+        band_x += band_width;
+    }
+}
+
 ret_code_t nrf_gfx_init(nrf_lcd_t const * p_instance)
 {
     ASSERT(p_instance != NULL);
@@ -610,6 +758,77 @@ ret_code_t nrf_gfx_print(nrf_lcd_t const * p_instance,
     return NRF_SUCCESS;
 }
 
+ret_code_t nrf_gfx_print_bg(nrf_lcd_t const * p_instance,
+                            nrf_gfx_point_t const * p_point,
+                            uint16_t font_color,
+                            uint16_t bg_color,
+                            const char * string,
+                            const nrf_gfx_font_desc_t * p_font,
+                            bool wrap)
+{
+    ASSERT(p_instance != NULL);
+    ASSERT(p_instance->p_lcd_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+    ASSERT(p_point != NULL);
+    ASSERT(string != NULL);
+    ASSERT(p_font != NULL);
+
+    uint16_t lcd_width = nrf_gfx_width_get(p_instance);
+    uint16_t lcd_height = nrf_gfx_height_get(p_instance);
+    uint16_t x = p_point->x;
+    uint16_t y = p_point->y;
+    uint32_t line_width = 0;
+    size_t line_start = 0;
+
+    if ((x >= lcd_width) || (y > (lcd_height - p_font->height)))
+    {
+        // Not enough space to write even single char.
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    for (size_t i = 0; ; i++)
+    {
+        uint8_t character = (uint8_t)string[i];
+        bool line_end = (character == '\0') || (character == '\n');
+
+        // A character that does not fit ends the line, unless it is the first one in the line.
+        if (!line_end &&
+            ((i == line_start) ||
+             (x + line_width + char_width_get(p_font, character) <= lcd_width)))
+        {
+            line_width += char_advance_get(p_font, character);
+            continue;
+        }
+
+        text_line_draw(p_instance, p_font, &string[line_start], i - line_start, x, y,
+                       MIN(line_width, (uint32_t)(lcd_width - x)), font_color, bg_color);
+
+        if ((character == '\0') || ((character != '\n') && !wrap))
+        {
+            break;
+        }
+
+        y += p_font->height + p_font->height / 10;
+        if (y > (lcd_height - p_font->height))
+        {
+            break;
+        }
+
+        line_width = 0;
+        if (character == '\n')
+        {
+            line_start = i + 1;
+        }
+        else
+        {
+            // Start the next line with the character that did not fit.
+            line_start = i;
+            i--;
+        }
+    }
+
+    return NRF_SUCCESS;
+}
+
 uint16_t nrf_gfx_height_get(nrf_lcd_t const * p_instance)
 {
     ASSERT(p_instance != NULL);
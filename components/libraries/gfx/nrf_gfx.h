@@ -298,6 +298,33 @@ ret_code_t nrf_gfx_print(nrf_lcd_t const * p_instance,
                          const nrf_gfx_font_desc_t * p_font,
                          bool wrap);
 
+/**
+ * @brief Function for printing a string on a filled background.
+ *
+ * Each line of text is rendered together with its background into a line buffer of
+ * @ref NRF_GFX_LINE_BUFFER_SIZE pixels and sent to the screen with the LCD bitmap draw
+ * function, so that a line costs only a few transfers. If the LCD does not provide
+ * the bitmap draw function, the background is filled and the glyphs are drawn on top of it.
+ *
+ * @param[in] p_instance            Pointer to the LCD instance.
+ * @param[in] p_point               Pointer to the point where to start drawing the object.
+ * @param[in] font_color            Color of the font in the display accepted format.
+ * @param[in] bg_color              Color of the background in the display accepted format.
+ * @param[in] p_string              Pointer to the string.
+ * @param[in] p_font                Pointer to the font descriptor.
+ * @param[in] wrap                  If true, the string will be wrapped to the new line.
+ *
+ * @retval NRF_SUCCESS              If the string was printed.
+ * @retval NRF_ERROR_INVALID_PARAM  If the starting point leaves no space for a single line.
+ */
+ret_code_t nrf_gfx_print_bg(nrf_lcd_t const * p_instance,
+                            nrf_gfx_point_t const * p_point,
+                            uint16_t font_color,
+                            uint16_t bg_color,
+                            const char * p_string,
+                            const nrf_gfx_font_desc_t * p_font,
+                            bool wrap);
+
 /**
  * @brief Function for getting the height of the screen.
  *
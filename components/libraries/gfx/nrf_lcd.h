@@ -62,6 +62,11 @@ typedef enum{
     NRF_LCD_ROTATE_270          /**< Rotate 270 degrees, clockwise. */
 }nrf_lcd_rotation_t;
 
+/**
+ * @brief Handler called when all queued drawing operations are finished.
+ */
+typedef void (* nrf_lcd_done_handler_t)(void);
+
 /**
  * @brief LCD instance control block.
  */
@@ -110,6 +115,24 @@ typedef struct
      */
     void (* lcd_rect_draw)(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint32_t color);
 
+    /**
+     * @brief Function for drawing a bitmap.
+     *
+     * The whole area is written through a single address window, so that the pixel data
+     * can be streamed to the LCD in as few transfers as possible. This function is optional.
+     * If it is NULL, the GFX library draws bitmaps with @ref lcd_pixel_draw and
+     * @ref lcd_rect_draw.
+     *
+     * @param[in] x             Horizontal coordinate of the point where to start drawing the bitmap.
+     * @param[in] y             Vertical coordinate of the point where to start drawing the bitmap.
+     * @param[in] width         Width of the bitmap.
+     * @param[in] height        Height of the bitmap.
+     * @param[in] p_data        Pointer to width * height pixels stored row by row, each in the
+     *                          same format as the color passed to @ref lcd_pixel_draw.
+     */
+    void (* lcd_bitmap_draw)(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                             uint16_t const * p_data);
+
     /**
      * @brief Function for displaying data from an internal frame buffer.
      *
@@ -133,6 +156,17 @@ typedef struct
      */
     void (* lcd_display_invert)(bool invert);
 
+    /**
+     * @brief Function for setting a handler called when all queued drawing operations are finished.
+     *
+     * This function is optional. LCDs that transfer data in the background provide it, so that
+     * the application can sleep until the screen is updated. It is NULL for LCDs that finish
+     * drawing before the drawing functions return.
+     *
+     * @param[in] handler       Handler, or NULL to disable the notification.
+     */
+    void (* lcd_done_handler_set)(nrf_lcd_done_handler_t handler);
+
     /**
      * @brief Pointer to the LCD instance control block.
      */
@@ -0,0 +1,433 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+
+#if NRF_MODULE_ENABLED(NRF_LCD_FB)
+
+#include "nrf_lcd_fb.h"
+#include "nrf_assert.h"
+
+#if (NRF_LCD_FB_BPP != 4) && (NRF_LCD_FB_BPP != 8) && (NRF_LCD_FB_BPP != 16)
+#error "Unsupported NRF_LCD_FB_BPP value."
+#endif
+
+STATIC_ASSERT(NRF_LCD_FB_TILE_SIZE > 0);
+STATIC_ASSERT(NRF_LCD_FB_FLUSH_BUFFER_SIZE >= MAX(NRF_LCD_FB_WIDTH, NRF_LCD_FB_HEIGHT));
+
+#define FB_PIXELS       ((uint32_t)NRF_LCD_FB_WIDTH * NRF_LCD_FB_HEIGHT)
+#define FB_TILES        (CEIL_DIV(NRF_LCD_FB_WIDTH, NRF_LCD_FB_TILE_SIZE) * \
+                         CEIL_DIV(NRF_LCD_FB_HEIGHT, NRF_LCD_FB_TILE_SIZE))
+#define FB_PALETTE_SIZE (1 << NRF_LCD_FB_BPP)
+
+#if NRF_LCD_FB_BPP == 16
+static uint16_t m_buffer[FB_PIXELS];
+#else
+static uint8_t m_buffer[CEIL_DIV(FB_PIXELS * NRF_LCD_FB_BPP, 8)];
+#endif
+
+static uint32_t m_dirty[CEIL_DIV(FB_TILES, 32)];           /**< One bit per tile, set if the tile was changed. */
+static uint16_t m_flush_buffer[NRF_LCD_FB_FLUSH_BUFFER_SIZE];
+static uint16_t m_tiles_x;                                  /**< Number of tile columns in the current rotation. */
+static uint16_t m_tiles_y;                                  /**< Number of tile rows in the current rotation. */
+
+static nrf_lcd_t const * mp_panel;
+static uint16_t const  * mp_palette;
+static nrf_lcd_done_handler_t m_done_handler;              /**< Done handler, if the panel does not provide one. */
+static uint32_t          m_last_color;                      /**< Last color mapped to the palette. */
+static uint16_t          m_last_value;                      /**< Palette index of @ref m_last_color. */
+
+static lcd_cb_t m_fb_cb = {
+    .height = NRF_LCD_FB_HEIGHT,
+    .width = NRF_LCD_FB_WIDTH
+};
+
+static uint16_t color_to_value(uint32_t color)
+{
+#if NRF_LCD_FB_BPP == 16
+    return (uint16_t)color;
+#else
+    if (color == m_last_color)
+    {
+        return m_last_value;
+    }
+
+    // Closest palette entry, comparing the RGB565 components.
+    uint32_t best_distance = UINT32_MAX;
+    uint16_t best = 0;
+
+    for (uint16_t i = 0; i < FB_PALETTE_SIZE; i++)
+    {
+        int32_t r = (int32_t)((color >> 11) & 0x1F) - ((mp_palette[i] >> 11) & 0x1F);
+        int32_t g = (int32_t)((color >> 5) & 0x3F)  - ((mp_palette[i] >> 5) & 0x3F);
+        int32_t b = (int32_t)(color & 0x1F)         - (mp_palette[i] & 0x1F);
+        uint32_t distance = (uint32_t)(4 * r * r + g * g + 4 * b * b);
+
+        if (distance < best_distance)
+        {
+            best_distance = distance;
+            best = i;
+            if (distance == 0)
+            {
+                break;
+            }
+        }
+    }
+
+    m_last_color = color;
+    m_last_value = best;
+
+    return best;
+#endif
+}
+
+static inline void value_set(uint32_t idx, uint16_t value)
+{
+#if NRF_LCD_FB_BPP == 4
+    uint8_t shift = (idx & 1) ? 4 : 0;
+
+    m_buffer[idx / 2] = (m_buffer[idx / 2] & ~(0x0F << shift)) | (value << shift);
+#else
+    m_buffer[idx] = value;
+#endif
+}
+
+static inline uint16_t pixel_get(uint32_t idx)
+{
+#if NRF_LCD_FB_BPP == 16
+    return m_buffer[idx];
+#elif NRF_LCD_FB_BPP == 8
+    return mp_palette[m_buffer[idx]];
+#else
+    return mp_palette[(m_buffer[idx / 2] >> ((idx & 1) ? 4 : 0)) & 0x0F];
+#endif
+}
+
+static void tiles_mark(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+    if ((width == 0) || (height == 0))
+    {
+        return;
+    }
+
+    uint16_t tx_end = (x + width - 1) / NRF_LCD_FB_TILE_SIZE;
+    uint16_t ty_end = (y + height - 1) / NRF_LCD_FB_TILE_SIZE;
+
+    for (uint16_t ty = y / NRF_LCD_FB_TILE_SIZE; ty <= ty_end; ty++)
+    {
+        for (uint16_t tx = x / NRF_LCD_FB_TILE_SIZE; tx <= tx_end; tx++)
+        {
+            uint32_t tile = ty * m_tiles_x + tx;
+
+            m_dirty[tile / 32] |= 1UL << (tile % 32);
+        }
+    }
+}
+
+static inline bool tile_is_dirty(uint16_t tx, uint16_t ty)
+{
+    uint32_t tile = ty * m_tiles_x + tx;
+
+    return (m_dirty[tile / 32] & (1UL << (tile % 32))) != 0;
+}
+
+static inline void tile_clear(uint16_t tx, uint16_t ty)
+{
+    uint32_t tile = ty * m_tiles_x + tx;
+
+    m_dirty[tile / 32] &= ~(1UL << (tile % 32));
+}
+
+static void tiles_reset(void)
+{
+    m_tiles_x = CEIL_DIV(m_fb_cb.width, NRF_LCD_FB_TILE_SIZE);
+    m_tiles_y = CEIL_DIV(m_fb_cb.height, NRF_LCD_FB_TILE_SIZE);
+    nrf_lcd_fb_invalidate();
+}
+
+static void rect_flush(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+    uint16_t fb_width = m_fb_cb.width;
+
+    if (mp_panel->lcd_bitmap_draw == NULL)
+    {
+        for (uint16_t i = 0; i < height; i++)
+        {
+            for (uint16_t j = 0; j < width; j++)
+            {
+                mp_panel->lcd_pixel_draw(x + j, y + i, pixel_get((y + i) * fb_width + x + j));
+            }
+        }
+        return;
+    }
+
+#if NRF_LCD_FB_BPP == 16
+    if (width == fb_width)
+    {
+        // Full lines are contiguous in the frame buffer and can be sent without copying.
+        mp_panel->lcd_bitmap_draw(x, y, width, height, &m_buffer[y * fb_width]);
+        return;
+    }
+#endif
+
+    uint16_t rows_per_band = NRF_LCD_FB_FLUSH_BUFFER_SIZE / width;
+
+    for (uint16_t band_y = 0; band_y < height; )
+    {
+        uint16_t band_height = MIN(height - band_y, rows_per_band);
+        uint16_t * p_pixel = m_flush_buffer;
+
+        for (uint16_t i = 0; i < band_height; i++)
+        {
+            uint32_t idx = (y + band_y + i) * fb_width + x;
+
+            for (uint16_t j = 0; j < width; j++)
+            {
+                *p_pixel++ = pixel_get(idx + j);
+            }
+        }
+
+        mp_panel->lcd_bitmap_draw(x, y + band_y, width, band_height, m_flush_buffer);
+
+        band_y += band_height;
+    }
+}
+
+static ret_code_t fb_init(void)
+{
+    ASSERT(mp_panel != NULL);
+
+    tiles_reset();
+
+    return mp_panel->lcd_init();
+}
+
+static void fb_uninit(void)
+{
+    mp_panel->lcd_uninit();
+}
+
+static void fb_pixel_draw(uint16_t x, uint16_t y, uint32_t color)
+{
+    value_set(y * m_fb_cb.width + x, color_to_value(color));
+    tiles_mark(x, y, 1, 1);
+}
+
+static void fb_rect_draw(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint32_t color)
+{
+    uint16_t value = color_to_value(color);
+
+    for (uint16_t i = 0; i < height; i++)
+    {
+        uint32_t idx = (y + i) * m_fb_cb.width + x;
+
+        for (uint16_t j = 0; j < width; j++)
+        {
+            value_set(idx + j, value);
+        }
+    }
+
+    tiles_mark(x, y, width, height);
+}
+
+static void fb_bitmap_draw(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t const * p_data)
+{
+    for (uint16_t i = 0; i < height; i++)
+    {
+        uint32_t idx = (y + i) * m_fb_cb.width + x;
+
+        for (uint16_t j = 0; j < width; j++)
+        {
+            value_set(idx + j, color_to_value(*p_data++));
+        }
+    }
+
+    tiles_mark(x, y, width, height);
+}
+
+static void fb_display(void)
+{
+    // Dirty tiles are merged into rectangles: a horizontal run of dirty tiles is extended
+    // downwards for as long as the same run is dirty in the next tile rows.
+    for (uint16_t ty = 0; ty < m_tiles_y; ty++)
+    {
+        for (uint16_t tx = 0; tx < m_tiles_x; tx++)
+        {
+            if (!tile_is_dirty(tx, ty))
+            {
+                continue;
+            }
+
+            uint16_t tx_end = tx + 1;
+            uint16_t ty_end = ty + 1;
+
+            while ((tx_end < m_tiles_x) && tile_is_dirty(tx_end, ty))
+            {
+                tx_end++;
+            }
+
+            for (bool full = true; full && (ty_end < m_tiles_y); )
+            {
+                for (uint16_t i = tx; i < tx_end; i++)
+                {
+                    if (!tile_is_dirty(i, ty_end))
+                    {
+                        full = false;
+                        break;
+                    }
+                }
+
+                if (full)
+                {
+                    ty_end++;
+                }
+            }
+
+            for (uint16_t i = ty; i < ty_end; i++)
+            {
+                for (uint16_t j = tx; j < tx_end; j++)
+                {
+                    tile_clear(j, i);
+                }
+            }
+
+            uint16_t x = tx * NRF_LCD_FB_TILE_SIZE;
+            uint16_t y = ty * NRF_LCD_FB_TILE_SIZE;
+
+            rect_flush(x,
+                       y,
+                       MIN(tx_end * NRF_LCD_FB_TILE_SIZE, m_fb_cb.width) - x,
+                       MIN(ty_end * NRF_LCD_FB_TILE_SIZE, m_fb_cb.height) - y);
+
+            tx = tx_end - 1;
+        }
+    }
+
+    mp_panel->lcd_display();
+
+    if (m_done_handler != NULL)
+    {
+        m_done_handler();
+    }
+}
+
+static void fb_rotation_set(nrf_lcd_rotation_t rotation)
+{
+    // nrf_gfx has already updated the size in the frame buffer control block.
+    mp_panel->p_lcd_cb->width = m_fb_cb.width;
+    mp_panel->p_lcd_cb->height = m_fb_cb.height;
+    mp_panel->p_lcd_cb->rotation = rotation;
+
+    mp_panel->lcd_rotation_set(rotation);
+
+    tiles_reset();
+}
+
+static void fb_display_invert(bool invert)
+{
+    mp_panel->lcd_display_invert(invert);
+}
+
+static void fb_done_handler_set(nrf_lcd_done_handler_t handler)
+{
+    // Panels that draw synchronously are finished as soon as the flush returns.
+    if (mp_panel->lcd_done_handler_set != NULL)
+    {
+        mp_panel->lcd_done_handler_set(handler);
+    }
+    else
+    {
+        m_done_handler = handler;
+    }
+}
+
+ret_code_t nrf_lcd_fb_panel_set(nrf_lcd_t const * p_panel, uint16_t const * p_palette)
+{
+    ASSERT(p_panel != NULL);
+    ASSERT(p_panel->p_lcd_cb != NULL);
+
+    if (m_fb_cb.state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    if (((NRF_LCD_FB_BPP != 16) && (p_palette == NULL)) ||
+        ((uint32_t)p_panel->p_lcd_cb->width * p_panel->p_lcd_cb->height != FB_PIXELS) ||
+        (MAX(p_panel->p_lcd_cb->width, p_panel->p_lcd_cb->height) !=
+         MAX(NRF_LCD_FB_WIDTH, NRF_LCD_FB_HEIGHT)))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    mp_panel = p_panel;
+    mp_palette = p_palette;
+    m_fb_cb.width = p_panel->p_lcd_cb->width;
+    m_fb_cb.height = p_panel->p_lcd_cb->height;
+    m_fb_cb.rotation = p_panel->p_lcd_cb->rotation;
+
+    if (mp_palette != NULL)
+    {
+        // Seed the lookup cache with an entry that is valid for this palette.
+        m_last_color = (uint32_t)mp_palette[0];
+        m_last_value = 0;
+    }
+
+    return NRF_SUCCESS;
+}
+
+void nrf_lcd_fb_invalidate(void)
+{
+    memset(m_dirty, 0, sizeof(m_dirty));
+    tiles_mark(0, 0, m_fb_cb.width, m_fb_cb.height);
+}
+
+const nrf_lcd_t nrf_lcd_fb = {
+    .lcd_init = fb_init,
+    .lcd_uninit = fb_uninit,
+    .lcd_pixel_draw = fb_pixel_draw,
+    .lcd_rect_draw = fb_rect_draw,
+    .lcd_bitmap_draw = fb_bitmap_draw,
+    .lcd_display = fb_display,
+    .lcd_rotation_set = fb_rotation_set,
+    .lcd_display_invert = fb_display_invert,
+    .lcd_done_handler_set = fb_done_handler_set,
+    .p_lcd_cb = &m_fb_cb
+};
+
+#endif // NRF_MODULE_ENABLED(NRF_LCD_FB)
@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef NRF_LCD_FB_H__
+#define NRF_LCD_FB_H__
+
+#include <stdint.h>
+#include "sdk_errors.h"
+#include "nrf_lcd.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file
+ *
+ * @defgroup nrf_lcd_fb LCD frame buffer
+ * @{
+ * @ingroup nrf_gfx
+ *
+ * @brief LCD instance that draws to a RAM frame buffer and refreshes only the changed parts of the screen.
+ *
+ * The frame buffer is divided into square tiles. Drawing functions mark the tiles they touch
+ * as dirty, and @ref nrf_gfx_display sends only the dirty tiles to the panel. Adjacent dirty
+ * tiles are merged into rectangles, and each rectangle is written with the bitmap draw function
+ * of the panel. Pixels can be stored as RGB565, or as 4-bit or 8-bit indexes into a palette
+ * to save RAM.
+ *
+ * Usage:
+ * @code
+ *     err_code = nrf_lcd_fb_panel_set(&nrf_lcd_ili9341, m_palette);
+ *     err_code = nrf_gfx_init(&nrf_lcd_fb);
+ *     ...
+ *     nrf_gfx_print_bg(&nrf_lcd_fb, &point, color, bg_color, string, p_font, false);
+ *     nrf_gfx_display(&nrf_lcd_fb);
+ * @endcode
+ */
+
+/**
+ * @brief LCD instance that draws to the frame buffer.
+ */
+extern const nrf_lcd_t nrf_lcd_fb;
+
+/**
+ * @brief Function for setting the panel to which the frame buffer is flushed.
+ *
+ * Must be called before the frame buffer instance is initialized with @ref nrf_gfx_init.
+ * The panel is initialized together with the frame buffer instance.
+ *
+ * @param[in] p_panel       Pointer to the LCD instance of the panel. Its size must match
+ *                          @ref NRF_LCD_FB_WIDTH and @ref NRF_LCD_FB_HEIGHT.
+ * @param[in] p_palette     Pointer to the palette of 2^@ref NRF_LCD_FB_BPP colors in the panel
+ *                          format. Ignored when @ref NRF_LCD_FB_BPP is 16. Colors drawn to the
+ *                          frame buffer are replaced with the closest palette entry.
+ *
+ * @retval NRF_SUCCESS              If the panel was set.
+ * @retval NRF_ERROR_INVALID_PARAM  If the panel size does not match the frame buffer size,
+ *                                  or no palette was given.
+ * @retval NRF_ERROR_INVALID_STATE  If the frame buffer instance is already initialized.
+ */
+ret_code_t nrf_lcd_fb_panel_set(nrf_lcd_t const * p_panel, uint16_t const * p_palette);
+
+/**
+ * @brief Function for marking the whole screen as changed.
+ *
+ * The next call to @ref nrf_gfx_display sends the whole frame buffer to the panel.
+ */
+void nrf_lcd_fb_invalidate(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_LCD_FB_H__
@@ -43,6 +43,58 @@
 #include "nrf_log_str_formatter.h"
 #include "nrf_log_internal.h"
 
+#if NRF_LOG_DICTIONARY_MODE
+#define DICT_SYNC_BYTE   0xA5 /**< First byte of every entry in the dictionary stream. */
+#define DICT_HEADER_SIZE 11   /**< Sync, type/severity, nargs, module ID, dropped, timestamp. */
+
+/**
+ * Entries in dictionary mode are sent as binary frames with all fields in little-endian order:
+ *
+ *    --------------------------------------------------------------------------
+ *    | SYNC | TYPE<<4 | SEVERITY | NARGS | MODULE_ID | DROPPED | TIMESTAMP |
+ *    |  1   |           1        |   1   |     2     |    2    |     4     |
+ *    --------------------------------------------------------------------------
+ *
+ * A standard entry is followed by the 4-byte format string address and NARGS 4-byte arguments.
+ * A hexdump entry is followed by the 2-byte data length and the data.
+ */
+static void dict_write(nrf_fprintf_ctx_t * p_ctx, uint8_t const * p_data, size_t length)
+{
+    while (length > 0)
+    {
+        size_t chunk = MIN(length, p_ctx->io_buffer_size - p_ctx->io_buffer_cnt);
+
+        memcpy(&p_ctx->p_io_buffer[p_ctx->io_buffer_cnt], p_data, chunk);
+        p_ctx->io_buffer_cnt += chunk;
+        p_data               += chunk;
+        length               -= chunk;
+
+        if (p_ctx->io_buffer_cnt == p_ctx->io_buffer_size)
+        {
+            nrf_fprintf_buffer_flush(p_ctx);
+        }
+    }
+}
+
+static void dict_header_write(nrf_fprintf_ctx_t * p_ctx,
+                              nrf_log_header_t const * p_header,
+                              uint8_t type,
+                              uint8_t severity,
+                              uint8_t nargs)
+{
+    uint8_t buf[DICT_HEADER_SIZE];
+
+    buf[0] = DICT_SYNC_BYTE;
+    buf[1] = (uint8_t)((type << 4) | severity);
+    buf[2] = nargs;
+    (void)uint16_encode(p_header->module_id, &buf[3]);
+    (void)uint16_encode(p_header->dropped, &buf[5]);
+    (void)uint32_encode(NRF_LOG_USES_TIMESTAMP ? p_header->timestamp : 0, &buf[7]);
+
+    dict_write(p_ctx, buf, sizeof(buf));
+}
+#endif // NRF_LOG_DICTIONARY_MODE
+
 void nrf_log_backend_serial_put(nrf_log_backend_t const * p_backend,
                                nrf_log_entry_t * p_msg,
                                uint8_t * p_buffer,
@@ -84,12 +136,26 @@ void nrf_log_backend_serial_put(nrf_log_backend_t const * p_backend,
         nrf_memobj_read(p_msg, args, nargs*sizeof(uint32_t), memobj_offset);
         memobj_offset += (nargs*sizeof(uint32_t));
 
+#if NRF_LOG_DICTIONARY_MODE
+        uint8_t addr[sizeof(uint32_t)];
+
+        dict_header_write(&fprintf_ctx, &header, HEADER_TYPE_STD,
+                          (uint8_t)params.severity, (uint8_t)nargs);
+        (void)uint32_encode((uint32_t)p_log_str, addr);
+        dict_write(&fprintf_ctx, addr, sizeof(addr));
+        for (uint32_t i = 0; i < nargs; i++)
+        {
+            (void)uint32_encode(args[i], addr);
+            dict_write(&fprintf_ctx, addr, sizeof(addr));
+        }
+        nrf_fprintf_buffer_flush(&fprintf_ctx);
+#else
         nrf_log_std_entry_process(p_log_str,
                                   args,
                                   nargs,
                                   &params,
                                   &fprintf_ctx);
-
+#endif
     }
     else if (header.base.generic.type == HEADER_TYPE_HEXDUMP)
     {
@@ -97,6 +163,22 @@ void nrf_log_backend_serial_put(nrf_log_backend_t const * p_backend,
         params.severity   = (nrf_log_severity_t)header.base.hexdump.severity;
         uint8_t data_buf[8];
         uint32_t chunk_len;
+#if NRF_LOG_DICTIONARY_MODE
+        dict_header_write(&fprintf_ctx, &header, HEADER_TYPE_HEXDUMP,
+                          (uint8_t)params.severity, 0);
+        (void)uint16_encode((uint16_t)data_len, data_buf);
+        dict_write(&fprintf_ctx, data_buf, sizeof(uint16_t));
+        while (data_len > 0)
+        {
+            chunk_len = sizeof(data_buf) > data_len ? data_len : sizeof(data_buf);
+            nrf_memobj_read(p_msg, data_buf, chunk_len, memobj_offset);
+            memobj_offset += chunk_len;
+            data_len -= chunk_len;
+
+            dict_write(&fprintf_ctx, data_buf, chunk_len);
+        }
+        nrf_fprintf_buffer_flush(&fprintf_ctx);
+#else
         do
         {
             chunk_len = sizeof(data_buf) > data_len ? data_len : sizeof(data_buf);
@@ -109,6 +191,7 @@ void nrf_log_backend_serial_put(nrf_log_backend_t const * p_backend,
                                          &params,
                                          &fprintf_ctx);
         } while (data_len > 0);
+#endif
     }
     nrf_memobj_put(p_msg);
     /*lint -restore*/
@@ -85,6 +85,10 @@
 #define NRF_LOG_FILTERS_ENABLED   0
 #endif
 
+#ifndef NRF_LOG_DICTIONARY_MODE
+#define NRF_LOG_DICTIONARY_MODE   0
+#endif
+
 #ifndef NRF_LOG_MODULE_NAME
     #define NRF_LOG_MODULE_NAME app
 #endif
@@ -137,7 +141,43 @@
 #define LOG_INTERNAL_X(N, ...)          CONCAT_2(LOG_INTERNAL_, N) (__VA_ARGS__)
 #define LOG_INTERNAL(type, ...) LOG_INTERNAL_X(NUM_VA_ARGS_LESS_1( \
                                                            __VA_ARGS__), type, __VA_ARGS__)
-#if NRF_LOG_ENABLED
+#if NRF_LOG_ENABLED && NRF_LOG_DICTIONARY_MODE
+/**
+ * In dictionary mode format strings are placed in a dedicated log_strings section. The section
+ * is not loaded to the device (see nrf_common.ld), only the string address is logged and the
+ * host-side decoder looks the string up in the ELF file. Because of that, the format string
+ * must be a string literal.
+ */
+#define LOG_INTERNAL_STR_DEF(str) \
+    static NRF_SECTION_ITEM_REGISTER(log_strings, char const m_nrf_log_str[]) = str
+#define NRF_LOG_INTERNAL_LOG_PUSH(_str) nrf_log_push(_str)
+#define LOG_INTERNAL_0(type, str) \
+    { LOG_INTERNAL_STR_DEF(str); nrf_log_frontend_std_0(type, m_nrf_log_str); }
+#define LOG_INTERNAL_1(type, str, arg0) \
+    { LOG_INTERNAL_STR_DEF(str); \
+    /*lint -save -e571*/nrf_log_frontend_std_1(type, m_nrf_log_str, (uint32_t)(arg0))/*lint -restore*/; }
+#define LOG_INTERNAL_2(type, str, arg0, arg1) \
+    { LOG_INTERNAL_STR_DEF(str); \
+    /*lint -save -e571*/nrf_log_frontend_std_2(type, m_nrf_log_str, (uint32_t)(arg0), \
+            (uint32_t)(arg1))/*lint -restore*/; }
+#define LOG_INTERNAL_3(type, str, arg0, arg1, arg2) \
+    { LOG_INTERNAL_STR_DEF(str); \
+    /*lint -save -e571*/nrf_log_frontend_std_3(type, m_nrf_log_str, (uint32_t)(arg0), \
+            (uint32_t)(arg1), (uint32_t)(arg2))/*lint -restore*/; }
+#define LOG_INTERNAL_4(type, str, arg0, arg1, arg2, arg3) \
+    { LOG_INTERNAL_STR_DEF(str); \
+    /*lint -save -e571*/nrf_log_frontend_std_4(type, m_nrf_log_str, (uint32_t)(arg0), \
+            (uint32_t)(arg1), (uint32_t)(arg2), (uint32_t)(arg3))/*lint -restore*/; }
+#define LOG_INTERNAL_5(type, str, arg0, arg1, arg2, arg3, arg4) \
+    { LOG_INTERNAL_STR_DEF(str); \
+    /*lint -save -e571*/nrf_log_frontend_std_5(type, m_nrf_log_str, (uint32_t)(arg0), \
+            (uint32_t)(arg1), (uint32_t)(arg2), (uint32_t)(arg3), (uint32_t)(arg4))/*lint -restore*/; }
+#define LOG_INTERNAL_6(type, str, arg0, arg1, arg2, arg3, arg4, arg5) \
+    { LOG_INTERNAL_STR_DEF(str); \
+    /*lint -save -e571*/nrf_log_frontend_std_6(type, m_nrf_log_str, (uint32_t)(arg0), \
+            (uint32_t)(arg1), (uint32_t)(arg2), (uint32_t)(arg3), (uint32_t)(arg4), (uint32_t)(arg5))/*lint -restore*/; }
+
+#elif NRF_LOG_ENABLED
 #define NRF_LOG_INTERNAL_LOG_PUSH(_str) nrf_log_push(_str)
 #define LOG_INTERNAL_0(type, str) \
     nrf_log_frontend_std_0(type, str)
@@ -161,6 +161,15 @@ void nrf_log_std_entry_process(char const * p_str,
 
     prefix_process(p_params, p_ctx);
 
+#if NRF_LOG_DICTIONARY_MODE
+    // Format strings are not present on the target, print the string address and raw arguments
+    // so that the entry can still be matched against the ELF file.
+    nrf_fprintf(p_ctx, "@0x%06x", (uint32_t)p_str);
+    for (uint32_t i = 0; i < nargs; i++)
+    {
+        nrf_fprintf(p_ctx, " 0x%08x", p_args[i]);
+    }
+#else
     switch (nargs)
     {
         case 0:
@@ -188,6 +197,7 @@ void nrf_log_std_entry_process(char const * p_str,
         default:
             break;
     }
+#endif
 
     postfix_process(p_params, p_ctx, false);
     p_ctx->auto_flush = auto_flush;
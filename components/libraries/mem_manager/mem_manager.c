@@ -430,7 +430,33 @@ NRF_LOG_MODULE_REGISTER();
 #define BLOCK_CAT_XXL                  6                                                            /**< Extra Extra Large category identifier. */
 
 #define BITMAP_SIZE                    32                                                           /**< Bitmap size for each word used to contain block information. */
-#define BLOCK_BITMAP_ARRAY_SIZE        CEIL_DIV(TOTAL_BLOCK_COUNT, BITMAP_SIZE)                     /**< Determines number of blocks needed for book keeping availability status of all blocks. */
+#define BITMAP_WORD_MAX                32                                                           /**< Maximum number of bitmap words per block category, limited by the width of the word summary mask. */
+
+#define XXSMALL_BITMAP_SIZE  CEIL_DIV(MEMORY_MANAGER_XXSMALL_BLOCK_COUNT, BITMAP_SIZE)              /**< Number of bitmap words used by XXSmall blocks. */
+#define XSMALL_BITMAP_SIZE   CEIL_DIV(MEMORY_MANAGER_XSMALL_BLOCK_COUNT,  BITMAP_SIZE)              /**< Number of bitmap words used by XSmall blocks. */
+#define SMALL_BITMAP_SIZE    CEIL_DIV(MEMORY_MANAGER_SMALL_BLOCK_COUNT,   BITMAP_SIZE)              /**< Number of bitmap words used by Small blocks. */
+#define MEDIUM_BITMAP_SIZE   CEIL_DIV(MEMORY_MANAGER_MEDIUM_BLOCK_COUNT,  BITMAP_SIZE)              /**< Number of bitmap words used by Medium blocks. */
+#define LARGE_BITMAP_SIZE    CEIL_DIV(MEMORY_MANAGER_LARGE_BLOCK_COUNT,   BITMAP_SIZE)              /**< Number of bitmap words used by Large blocks. */
+#define XLARGE_BITMAP_SIZE   CEIL_DIV(MEMORY_MANAGER_XLARGE_BLOCK_COUNT,  BITMAP_SIZE)              /**< Number of bitmap words used by XLarge blocks. */
+#define XXLARGE_BITMAP_SIZE  CEIL_DIV(MEMORY_MANAGER_XXLARGE_BLOCK_COUNT, BITMAP_SIZE)              /**< Number of bitmap words used by XXLarge blocks. */
+
+#define XXSMALL_BITMAP_START 0                                                                      /**< First bitmap word of XXSmall blocks. */
+#define XSMALL_BITMAP_START  (XXSMALL_BITMAP_START + XXSMALL_BITMAP_SIZE)                           /**< First bitmap word of XSmall blocks. */
+#define SMALL_BITMAP_START   (XSMALL_BITMAP_START  + XSMALL_BITMAP_SIZE)                            /**< First bitmap word of Small blocks. */
+#define MEDIUM_BITMAP_START  (SMALL_BITMAP_START   + SMALL_BITMAP_SIZE)                             /**< First bitmap word of Medium blocks. */
+#define LARGE_BITMAP_START   (MEDIUM_BITMAP_START  + MEDIUM_BITMAP_SIZE)                            /**< First bitmap word of Large blocks. */
+#define XLARGE_BITMAP_START  (LARGE_BITMAP_START   + LARGE_BITMAP_SIZE)                             /**< First bitmap word of XLarge blocks. */
+#define XXLARGE_BITMAP_START (XLARGE_BITMAP_START  + XLARGE_BITMAP_SIZE)                            /**< First bitmap word of XXLarge blocks. */
+
+#define BLOCK_BITMAP_ARRAY_SIZE        (XXLARGE_BITMAP_START + XXLARGE_BITMAP_SIZE)                 /**< Determines number of words needed for book keeping availability status of all blocks. Each category starts on a word boundary. */
+
+STATIC_ASSERT(XXSMALL_BITMAP_SIZE <= BITMAP_WORD_MAX);
+STATIC_ASSERT(XSMALL_BITMAP_SIZE  <= BITMAP_WORD_MAX);
+STATIC_ASSERT(SMALL_BITMAP_SIZE   <= BITMAP_WORD_MAX);
+STATIC_ASSERT(MEDIUM_BITMAP_SIZE  <= BITMAP_WORD_MAX);
+STATIC_ASSERT(LARGE_BITMAP_SIZE   <= BITMAP_WORD_MAX);
+STATIC_ASSERT(XLARGE_BITMAP_SIZE  <= BITMAP_WORD_MAX);
+STATIC_ASSERT(XXLARGE_BITMAP_SIZE <= BITMAP_WORD_MAX);
 
 
 /**@brief Lookup table for maximum memory size per block category. */
@@ -481,8 +507,22 @@ static const uint32_t m_block_mem_start[BLOCK_CAT_COUNT] =
     XXLARGE_MEMORY_START
 };
 
+/**@brief Lookup table for first bitmap word for each block category. */
+static const uint32_t m_block_bitmap_start[BLOCK_CAT_COUNT] =
+{
+    XXSMALL_BITMAP_START,
+    XSMALL_BITMAP_START,
+    SMALL_BITMAP_START,
+    MEDIUM_BITMAP_START,
+    LARGE_BITMAP_START,
+    XLARGE_BITMAP_START,
+    XXLARGE_BITMAP_START
+};
+
 static uint8_t  m_memory[TOTAL_MEMORY_SIZE];                                                        /**< Memory managed by the module. */
-static uint32_t m_mem_pool[BLOCK_BITMAP_ARRAY_SIZE];                                                /**< Bitmap used for book-keeping availability of all blocks managed by the module.  */
+static uint32_t m_mem_pool[BLOCK_BITMAP_ARRAY_SIZE];                                                /**< Bitmap used for book-keeping availability of all blocks managed by the module. The first block of a word is stored in its most significant bit. */
+static uint32_t m_word_free_mask[BLOCK_CAT_COUNT];                                                  /**< Per category mask of bitmap words that have at least one free block. The first word is stored in the most significant bit. */
+static uint32_t m_cat_free_mask;                                                                    /**< Mask of block categories that have at least one free block. Category 0 is stored in the most significant bit. */
 
 #if defined(MEM_MANAGER_ENABLE_DIAGNOSTICS) && (MEM_MANAGER_ENABLE_DIAGNOSTICS == 1)
 
@@ -554,20 +594,23 @@ static bool     m_module_initialized = false;
  *
  * @details Function to get X and Y co-ordinates for the block identified by index.
  *          Here, X determines relevant word for the block. Y determines the actual bit in the word.
+ *          Blocks are stored starting from the most significant bit, so that the first free block
+ *          in a word is found with a single count-leading-zeros operation.
  *
- * @param[in]  index Identifies the block.
- * @param[out] p_x   Points to the word that contains the bit representing the block.
- * @param[out] p_y   Contains the bitnumber in the the word 'X' relevant to the block.
+ * @param[in]  block_cat   Category of the block.
+ * @param[in]  block_index Identifies the block.
+ * @param[out] p_x         Points to the word that contains the bit representing the block.
+ * @param[out] p_y         Contains the bitnumber in the the word 'X' relevant to the block.
  */
-static __INLINE void get_block_coordinates(uint32_t block_index, uint32_t * p_x, uint32_t * p_y)
+static __INLINE void get_block_coordinates(uint32_t   block_cat,
+                                           uint32_t   block_index,
+                                           uint32_t * p_x,
+                                           uint32_t * p_y)
 {
-    // Determine position of the block in the bitmap.
-    // X determines relevant word for the block. Y determines the actual bit in the word.
-    const uint32_t x = block_index / BITMAP_SIZE;
-    const uint32_t y = (block_index - x * BITMAP_SIZE);
+    const uint32_t offset = block_index - m_block_start[block_cat];
 
-    (*p_x) = x;
-    (*p_y) = y;
+    (*p_x) = m_block_bitmap_start[block_cat] + (offset / BITMAP_SIZE);
+    (*p_y) = (BITMAP_SIZE - 1) - (offset % BITMAP_SIZE);
 }
 
 
@@ -588,26 +631,30 @@ static __INLINE uint32_t get_block_cat(uint32_t size, uint32_t block_index)
 }
 
 /**@brief Initializes the block by setting it to be free. */
-static void block_init (uint32_t block_index)
+static void block_init(uint32_t block_cat, uint32_t block_index)
 {
     uint32_t x;
     uint32_t y;
 
     // Determine position of the block in the bitmap.
     // X determines relevant word for the block. Y determines the actual bit in the word.
-    get_block_coordinates(block_index, &x, &y);
+    get_block_coordinates(block_cat, block_index, &x, &y);
 
 #if defined(MEM_MANAGER_ENABLE_DIAGNOSTICS) && (MEM_MANAGER_ENABLE_DIAGNOSTICS == 1)
     // Update current use statistics: lower current count in block
     if (!IS_SET(m_mem_pool[x], y))
     {
-        uint32_t block_cat = get_block_cat(0, block_index);
         m_cur_count[block_cat]--;
     }
 #endif // MEM_MANAGER_ENABLE_DIAGNOSTICS
 
     // Set bit related to the block to indicate that the block is free.
     SET_BIT(m_mem_pool[x], y);
+
+    // The word and the category now have at least one free block.
+    SET_BIT(m_word_free_mask[block_cat],
+            (BITMAP_SIZE - 1) - (x - m_block_bitmap_start[block_cat]));
+    SET_BIT(m_cat_free_mask, (BITMAP_SIZE - 1) - block_cat);
 }
 
 
@@ -625,7 +672,7 @@ static __INLINE uint32_t get_block_size(uint32_t block_index)
 }
 
 
-/**@brief Function to free the block identified by block number 'block_index'. */
+/**@brief Function to check if the block identified by block number 'block_index' is free. */
 static bool is_block_free(uint32_t block_index)
 {
     uint32_t x;
@@ -633,27 +680,71 @@ static bool is_block_free(uint32_t block_index)
 
     // Determine position of the block in the bitmap.
     // X determines relevant word for the block. Y determines the actual bit in the word.
-    get_block_coordinates(block_index, &x, &y);
+    get_block_coordinates(get_block_cat(0, block_index), block_index, &x, &y);
 
     return IS_SET(m_mem_pool[x], y);
 }
 
 
+/**@brief Function to find the first free block of category 'block_cat' or any larger category.
+ *
+ * @details The search does not depend on the number of blocks: the category mask gives the first
+ *          category with a free block, the word mask of that category gives the first word with a
+ *          free block and the word itself gives the block.
+ *
+ * @param[in]  block_cat     Smallest category that can hold the requested size.
+ * @param[out] p_block_cat   Category of the free block found.
+ * @param[out] p_block_index Index of the free block found.
+ *
+ * @retval true  If a free block was found.
+ * @retval false If all blocks of the category and of larger categories are in use.
+ */
+static bool free_block_find(uint32_t block_cat, uint32_t * p_block_cat, uint32_t * p_block_index)
+{
+    const uint32_t cat_mask = m_cat_free_mask & (0xFFFFFFFFUL >> block_cat);
+
+    if (cat_mask == 0)
+    {
+        return false;
+    }
+
+    const uint32_t cat  = __CLZ(cat_mask);
+    const uint32_t word = __CLZ(m_word_free_mask[cat]);
+    const uint32_t bit  = __CLZ(m_mem_pool[m_block_bitmap_start[cat] + word]);
+
+    (*p_block_cat)   = cat;
+    (*p_block_index) = m_block_start[cat] + (word * BITMAP_SIZE) + bit;
+
+    return true;
+}
+
+
 /**@brief Function to allocate the block identified by block number 'block_index'. */
-static void block_allocate(uint32_t block_index)
+static void block_allocate(uint32_t block_cat, uint32_t block_index)
 {
     uint32_t x;
     uint32_t y;
 
     // Determine position of the block in the bitmap.
     // X determines relevant word for the block. Y determines the actual bit in the word.
-    get_block_coordinates(block_index, &x, &y);
+    get_block_coordinates(block_cat, block_index, &x, &y);
 
     CLR_BIT(m_mem_pool[x], y);
 
+    if (m_mem_pool[x] == 0)
+    {
+        // Last free block of the word, and possibly of the category, was taken.
+        CLR_BIT(m_word_free_mask[block_cat],
+                (BITMAP_SIZE - 1) - (x - m_block_bitmap_start[block_cat]));
+
+        if (m_word_free_mask[block_cat] == 0)
+        {
+            CLR_BIT(m_cat_free_mask, (BITMAP_SIZE - 1) - block_cat);
+        }
+    }
+
 #if defined(MEM_MANAGER_ENABLE_DIAGNOSTICS) && (MEM_MANAGER_ENABLE_DIAGNOSTICS == 1)
     // Update statistics: Add to current count in block.
-    uint32_t block_cat = get_block_cat(0, block_index);
     m_cur_count[block_cat]++;
 
     // Report if the peak usage goes up in current block
@@ -678,7 +769,7 @@ uint32_t nrf_mem_init(void)
 
     for (block_index = 0; block_index < TOTAL_BLOCK_COUNT; block_index++)
     {
-        block_init(block_index);
+        block_init(get_block_cat(0, block_index), block_index);
     }
 
     NRF_MEM_MANAGER_DIAGNOSE_RESET
@@ -711,40 +802,36 @@ uint32_t nrf_mem_reserve(uint8_t ** pp_buffer, uint32_t * p_size)
 
     MM_MUTEX_LOCK();
 
-    const uint32_t block_cat    = get_block_cat(requested_size, TOTAL_BLOCK_COUNT);
-    uint32_t       block_index  = m_block_start[block_cat];
-    uint32_t       memory_index = m_block_mem_start[block_cat];
-    uint32_t       err_code     = (NRF_ERROR_NO_MEM | NRF_ERROR_MEMORY_MANAGER_ERR_BASE);
+    const uint32_t block_cat   = get_block_cat(requested_size, TOTAL_BLOCK_COUNT);
+    uint32_t       found_cat;
+    uint32_t       block_index;
+    uint32_t       err_code    = (NRF_ERROR_NO_MEM | NRF_ERROR_MEMORY_MANAGER_ERR_BASE);
 
     NRF_LOG_DEBUG("Start index for the pool = 0x%08lX, total block count 0x%08X",
-           block_index,
+           m_block_start[block_cat],
            TOTAL_BLOCK_COUNT);
 
-    for (; block_index < TOTAL_BLOCK_COUNT; block_index++)
+    // Falls through to larger categories when the requested one is exhausted.
+    if (free_block_find(block_cat, &found_cat, &block_index))
     {
-        uint32_t block_size = get_block_size(block_index);
-
-        if (is_block_free(block_index) == true)
-        {
-            NRF_LOG_DEBUG("Reserving block 0x%08lX", block_index);
+        const uint32_t block_size = get_block_size(block_index);
 
-            // Search succeeded, found free block.
-            err_code     = NRF_SUCCESS;
+        NRF_LOG_DEBUG("Reserving block 0x%08lX", block_index);
 
-            // Allocate block.
-            block_allocate(block_index);
+        // Search succeeded, found free block.
+        err_code = NRF_SUCCESS;
 
-            (*pp_buffer) = &m_memory[memory_index];
-            (*p_size)    = block_size;
+        // Allocate block.
+        block_allocate(found_cat, block_index);
 
-        #if defined(MEM_MANAGER_ENABLE_DIAGNOSTICS) && (MEM_MANAGER_ENABLE_DIAGNOSTICS == 1)
-            (*p_min_size) = MIN((*p_min_size), requested_size);
-            (*p_max_size) = MAX((*p_max_size), requested_size);
-        #endif // MEM_MANAGER_ENABLE_DIAGNOSTICS
+        (*pp_buffer) = &m_memory[m_block_mem_start[found_cat] +
+                                 (block_index - m_block_start[found_cat]) * block_size];
+        (*p_size)    = block_size;
 
-            break;
-        }
-        memory_index += block_size;
+    #if defined(MEM_MANAGER_ENABLE_DIAGNOSTICS) && (MEM_MANAGER_ENABLE_DIAGNOSTICS == 1)
+        (*p_min_size) = MIN((*p_min_size), requested_size);
+        (*p_max_size) = MAX((*p_max_size), requested_size);
+    #endif // MEM_MANAGER_ENABLE_DIAGNOSTICS
     }
     if (err_code != NRF_SUCCESS)
     {
@@ -814,19 +901,30 @@ void nrf_free(void * p_mem)
 
     MM_MUTEX_LOCK();
 
-    uint32_t index;
-    uint32_t memory_index = 0;
+    const uint8_t * p_byte = (uint8_t *)p_mem;
 
-    for (index = 0; index < TOTAL_BLOCK_COUNT; index++)
+    for (uint32_t block_cat = 0; block_cat < BLOCK_CAT_COUNT; block_cat++)
     {
-        if (&m_memory[memory_index] == p_mem)
+        const uint8_t * p_cat_start = &m_memory[m_block_mem_start[block_cat]];
+        const uint32_t  cat_size    = (m_block_end[block_cat] - m_block_start[block_cat]) *
+                                      m_block_size[block_cat];
+
+        if ((p_byte >= p_cat_start) && (p_byte < p_cat_start + cat_size))
         {
-            // Found a free block of memory, assign.
-            NRF_LOG_DEBUG("<< Freeing block %d.", index);
-            block_init(index);
+            const uint32_t offset = (uint32_t)(p_byte - p_cat_start);
+
+            // Only the start of a block can be freed.
+            if ((offset % m_block_size[block_cat]) == 0)
+            {
+                const uint32_t index = m_block_start[block_cat] +
+                                       (offset / m_block_size[block_cat]);
+
+                // Found a free block of memory, assign.
+                NRF_LOG_DEBUG("<< Freeing block %d.", index);
+                block_init(block_cat, index);
+            }
             break;
         }
-        memory_index += get_block_size(index);
     }
 
     MM_MUTEX_UNLOCK();
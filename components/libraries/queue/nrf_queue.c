@@ -93,7 +93,8 @@ static void nrf_queue_status(nrf_cli_t const * p_cli, size_t argc, char **argv)
                         p_name, element_size,
                         100ul * util/size, util,size,
                         100ul * max_util/size, max_util,size,
-                        (p_instance->mode == NRF_QUEUE_MODE_OVERFLOW) ? "Overflow" : "No overflow");
+                        (p_instance->mode == NRF_QUEUE_MODE_OVERFLOW) ? "Overflow" :
+                        (p_instance->mode == NRF_QUEUE_MODE_SPSC)     ? "SPSC"     : "No overflow");
 
     }
 }
@@ -147,6 +148,338 @@ __STATIC_INLINE size_t queue_utilization_get(nrf_queue_t const * p_queue)
         (circullar_buffer_size_get(p_queue) - front + back);
 }
 
+/**@brief Update the maximum utilization statistics.
+ *
+ * @param[in]   p_queue     Pointer to the queue instance.
+ * @param[in]   utilization Current queue utilization.
+ */
+__STATIC_INLINE void max_utilization_update(nrf_queue_t const * p_queue, size_t utilization)
+{
+    if (p_queue->p_cb->max_utilization < utilization)
+    {
+        p_queue->p_cb->max_utilization = utilization;
+    }
+}
+
+/**@brief Get the address of an element in the queue storage.
+ *
+ * @param[in]   p_queue     Pointer to the queue instance.
+ * @param[in]   idx         Element index.
+ *
+ * @return      Address of the element.
+ */
+__STATIC_INLINE void * element_ptr_get(nrf_queue_t const * p_queue, size_t idx)
+{
+    return (void *)((size_t)p_queue->p_buffer + idx * p_queue->element_size);
+}
+
+/**@brief Copy one element into the queue storage.
+ *
+ * @param[in]   p_queue     Pointer to the queue instance.
+ * @param[in]   idx         Element index.
+ * @param[in]   p_element   Element to copy.
+ */
+static void element_write(nrf_queue_t const * p_queue, size_t idx, void const * p_element)
+{
+    switch (p_queue->element_size)
+    {
+        case sizeof(uint8_t):
+            ((uint8_t *)p_queue->p_buffer)[idx] = *((uint8_t *)p_element);
+            break;
+
+        case sizeof(uint16_t):
+            ((uint16_t *)p_queue->p_buffer)[idx] = *((uint16_t *)p_element);
+            break;
+
+        case sizeof(uint32_t):
+            ((uint32_t *)p_queue->p_buffer)[idx] = *((uint32_t *)p_element);
+            break;
+
+        case sizeof(uint64_t):
+            ((uint64_t *)p_queue->p_buffer)[idx] = *((uint64_t *)p_element);
+            break;
+
+        default:
+            memcpy(element_ptr_get(p_queue, idx), p_element, p_queue->element_size);
+            break;
+    }
+}
+
+/**@brief Copy one element out of the queue storage.
+ *
+ * @param[in]   p_queue     Pointer to the queue instance.
+ * @param[in]   idx         Element index.
+ * @param[out]  p_element   Where the element is copied.
+ */
+static void element_read(nrf_queue_t const * p_queue, size_t idx, void * p_element)
+{
+    switch (p_queue->element_size)
+    {
+        case sizeof(uint8_t):
+            *((uint8_t *)p_element) = ((uint8_t *)p_queue->p_buffer)[idx];
+            break;
+
+        case sizeof(uint16_t):
+            *((uint16_t *)p_element) = ((uint16_t *)p_queue->p_buffer)[idx];
+            break;
+
+        case sizeof(uint32_t):
+            *((uint32_t *)p_element) = ((uint32_t *)p_queue->p_buffer)[idx];
+            break;
+
+        case sizeof(uint64_t):
+            *((uint64_t *)p_element) = ((uint64_t *)p_queue->p_buffer)[idx];
+            break;
+
+        default:
+            memcpy(p_element, element_ptr_get(p_queue, idx), p_queue->element_size);
+            break;
+    }
+}
+
+/* Single producer, single consumer mode.
+ *
+ * The producer owns the back index and the consumer owns the front index. Each side reads the
+ * other side's index once, copies the data, and publishes its own index after a memory barrier,
+ * so the other side never sees an index before the data it covers. No critical section is used.
+ */
+
+/**@brief Get the number of free elements seen by the producer.
+ *
+ * @param[in]   p_queue     Pointer to the queue instance.
+ * @param[in]   back        Back index, owned by the producer.
+ *
+ * @return      Number of elements that can be written.
+ */
+__STATIC_INLINE size_t spsc_free_get(nrf_queue_t const * p_queue, size_t back)
+{
+    size_t front = p_queue->p_cb->front;
+
+    // Make sure that the elements are not overwritten before the index that releases them is read.
+    __DMB();
+
+    return (front > back) ? (front - back - 1) : (p_queue->size - back + front);
+}
+
+/**@brief Get the number of stored elements seen by the consumer.
+ *
+ * @param[in]   p_queue     Pointer to the queue instance.
+ * @param[in]   front       Front index, owned by the consumer.
+ *
+ * @return      Number of elements that can be read.
+ */
+__STATIC_INLINE size_t spsc_used_get(nrf_queue_t const * p_queue, size_t front)
+{
+    size_t back = p_queue->p_cb->back;
+
+    // Make sure that the elements are not read before the index that covers them.
+    __DMB();
+
+    return (back >= front) ? (back - front) : (circullar_buffer_size_get(p_queue) - front + back);
+}
+
+/**@brief Publish new elements. Called by the producer after the elements have been written.
+ *
+ * @param[in]   p_queue         Pointer to the queue instance.
+ * @param[in]   back            Current back index.
+ * @param[in]   element_count   Number of elements written at the back.
+ */
+static void spsc_back_advance(nrf_queue_t const * p_queue, size_t back, size_t element_count)
+{
+    back += element_count;
+    if (back >= circullar_buffer_size_get(p_queue))
+    {
+        back -= circullar_buffer_size_get(p_queue);
+    }
+
+    // Make sure that the elements are written before the index is published.
+    __DMB();
+    p_queue->p_cb->back = back;
+
+    max_utilization_update(p_queue, queue_utilization_get(p_queue));
+}
+
+/**@brief Release elements. Called by the consumer after the elements have been read.
+ *
+ * @param[in]   p_queue         Pointer to the queue instance.
+ * @param[in]   front           Current front index.
+ * @param[in]   element_count   Number of elements read at the front.
+ */
+static void spsc_front_advance(nrf_queue_t const * p_queue, size_t front, size_t element_count)
+{
+    front += element_count;
+    if (front >= circullar_buffer_size_get(p_queue))
+    {
+        front -= circullar_buffer_size_get(p_queue);
+    }
+
+    // Make sure that the elements are read before the producer can overwrite them.
+    __DMB();
+    p_queue->p_cb->front = front;
+}
+
+/**@brief Copy elements to the back of the queue without publishing them.
+ *
+ * @param[in]   p_queue         Pointer to the queue instance.
+ * @param[in]   back            Current back index.
+ * @param[in]   p_data          Elements to copy.
+ * @param[in]   element_count   Number of elements. Must fit in the free space.
+ */
+static void spsc_copy_in(nrf_queue_t const * p_queue,
+                         size_t              back,
+                         void const        * p_data,
+                         size_t              element_count)
+{
+    size_t continuous = MIN(element_count, circullar_buffer_size_get(p_queue) - back);
+
+    memcpy(element_ptr_get(p_queue, back), p_data, continuous * p_queue->element_size);
+    memcpy(p_queue->p_buffer,
+           (void const *)((size_t)p_data + continuous * p_queue->element_size),
+           (element_count - continuous) * p_queue->element_size);
+}
+
+/**@brief Copy elements from the front of the queue without releasing them.
+ *
+ * @param[in]   p_queue         Pointer to the queue instance.
+ * @param[in]   front           Current front index.
+ * @param[out]  p_data          Where the elements are copied.
+ * @param[in]   element_count   Number of elements. Must not exceed the stored elements.
+ */
+static void spsc_copy_out(nrf_queue_t const * p_queue,
+                          size_t              front,
+                          void              * p_data,
+                          size_t              element_count)
+{
+    size_t continuous = MIN(element_count, circullar_buffer_size_get(p_queue) - front);
+
+    memcpy(p_data, element_ptr_get(p_queue, front), continuous * p_queue->element_size);
+    memcpy((void *)((size_t)p_data + continuous * p_queue->element_size),
+           p_queue->p_buffer,
+           (element_count - continuous) * p_queue->element_size);
+}
+
+/**@brief Write elements in SPSC mode.
+ *
+ * @param[in]   p_queue         Pointer to the queue instance.
+ * @param[in]   p_data          Elements to write.
+ * @param[in]   element_count   Number of elements to write.
+ * @param[in]   partial         If true, write as many elements as fit. Otherwise, write all
+ *                              elements or none.
+ *
+ * @return      Number of written elements.
+ */
+static size_t spsc_write(nrf_queue_t const * p_queue,
+                         void const        * p_data,
+                         size_t              element_count,
+                         bool                partial)
+{
+    size_t back      = p_queue->p_cb->back;
+    size_t available = spsc_free_get(p_queue, back);
+
+    if (element_count > available)
+    {
+        if (!partial)
+        {
+            return 0;
+        }
+        element_count = available;
+    }
+
+    if (element_count > 0)
+    {
+        spsc_copy_in(p_queue, back, p_data, element_count);
+        spsc_back_advance(p_queue, back, element_count);
+    }
+
+    return element_count;
+}
+
+/**@brief Read elements in SPSC mode.
+ *
+ * @param[in]   p_queue         Pointer to the queue instance.
+ * @param[out]  p_data          Where the elements are copied.
+ * @param[in]   element_count   Number of elements to read.
+ * @param[in]   partial         If true, read as many elements as are stored. Otherwise, read
+ *                              all elements or none.
+ *
+ * @return      Number of read elements.
+ */
+static size_t spsc_read(nrf_queue_t const * p_queue,
+                        void              * p_data,
+                        size_t              element_count,
+                        bool                partial)
+{
+    size_t front = p_queue->p_cb->front;
+    size_t used  = spsc_used_get(p_queue, front);
+
+    if (element_count > used)
+    {
+        if (!partial)
+        {
+            return 0;
+        }
+        element_count = used;
+    }
+
+    if (element_count > 0)
+    {
+        spsc_copy_out(p_queue, front, p_data, element_count);
+        spsc_front_advance(p_queue, front, element_count);
+    }
+
+    return element_count;
+}
+
+size_t nrf_queue_write_span_get(nrf_queue_t const * p_queue, void ** pp_span)
+{
+    ASSERT(p_queue != NULL);
+    ASSERT(pp_span != NULL);
+    ASSERT(p_queue->mode == NRF_QUEUE_MODE_SPSC);
+
+    size_t back      = p_queue->p_cb->back;
+    size_t available = spsc_free_get(p_queue, back);
+
+    *pp_span = element_ptr_get(p_queue, back);
+
+    return MIN(available, circullar_buffer_size_get(p_queue) - back);
+}
+
+void nrf_queue_write_span_commit(nrf_queue_t const * p_queue, size_t element_count)
+{
+    ASSERT(p_queue != NULL);
+    ASSERT(p_queue->mode == NRF_QUEUE_MODE_SPSC);
+
+    if (element_count > 0)
+    {
+        spsc_back_advance(p_queue, p_queue->p_cb->back, element_count);
+    }
+}
+
+size_t nrf_queue_read_span_get(nrf_queue_t const * p_queue, void const ** pp_span)
+{
+    ASSERT(p_queue != NULL);
+    ASSERT(pp_span != NULL);
+    ASSERT(p_queue->mode == NRF_QUEUE_MODE_SPSC);
+
+    size_t front = p_queue->p_cb->front;
+    size_t used  = spsc_used_get(p_queue, front);
+
+    *pp_span = element_ptr_get(p_queue, front);
+
+    return MIN(used, circullar_buffer_size_get(p_queue) - front);
+}
+
+void nrf_queue_read_span_release(nrf_queue_t const * p_queue, size_t element_count)
+{
+    ASSERT(p_queue != NULL);
+    ASSERT(p_queue->mode == NRF_QUEUE_MODE_SPSC);
+
+    if (element_count > 0)
+    {
+        spsc_front_advance(p_queue, p_queue->p_cb->front, element_count);
+    }
+}
+
 bool nrf_queue_is_full(nrf_queue_t const * p_queue)
 {
     ASSERT(p_queue != NULL);
@@ -163,6 +496,13 @@ ret_code_t nrf_queue_push(nrf_queue_t const * p_queue, void const * p_element)
     ASSERT(p_queue != NULL);
     ASSERT(p_element != NULL);
 
+    if (p_queue->mode == NRF_QUEUE_MODE_SPSC)
+    {
+        status = (spsc_write(p_queue, p_element, 1, false) == 1) ? NRF_SUCCESS : NRF_ERROR_NO_MEM;
+        NRF_LOG_INST_DEBUG(p_queue->p_log, "pushed element 0x%08X, status:%d", p_element, status);
+        return status;
+    }
+
     CRITICAL_REGION_ENTER();
     bool is_full = nrf_queue_is_full(p_queue);
 
@@ -179,37 +519,10 @@ ret_code_t nrf_queue_push(nrf_queue_t const * p_queue, void const * p_element)
         }
 
         // Write a new element.
-        switch (p_queue->element_size)
-        {
-            case sizeof(uint8_t):
-                ((uint8_t *)p_queue->p_buffer)[write_pos] = *((uint8_t *)p_element);
-                break;
-
-            case sizeof(uint16_t):
-                ((uint16_t *)p_queue->p_buffer)[write_pos] = *((uint16_t *)p_element);
-                break;
-
-            case sizeof(uint32_t):
-                ((uint32_t *)p_queue->p_buffer)[write_pos] = *((uint32_t *)p_element);
-                break;
-
-            case sizeof(uint64_t):
-                ((uint64_t *)p_queue->p_buffer)[write_pos] = *((uint64_t *)p_element);
-                break;
-
-            default:
-                memcpy((void *)((size_t)p_queue->p_buffer + write_pos * p_queue->element_size),
-                       p_element,
-                       p_queue->element_size);
-                break;
-        }
+        element_write(p_queue, write_pos, p_element);
 
         // Update utilization.
-        size_t utilization = queue_utilization_get(p_queue);
-        if (p_queue->p_cb->max_utilization < utilization)
-        {
-            p_queue->p_cb->max_utilization = utilization;
-        }
+        max_utilization_update(p_queue, queue_utilization_get(p_queue));
     }
     else
     {
@@ -231,6 +544,27 @@ ret_code_t nrf_queue_generic_pop(nrf_queue_t const * p_queue,
     ASSERT(p_queue      != NULL);
     ASSERT(p_element    != NULL);
 
+    if (p_queue->mode == NRF_QUEUE_MODE_SPSC)
+    {
+        size_t front = p_queue->p_cb->front;
+
+        if (spsc_used_get(p_queue, front) > 0)
+        {
+            element_read(p_queue, front, p_element);
+            if (!just_peek)
+            {
+                spsc_front_advance(p_queue, front, 1);
+            }
+        }
+        else
+        {
+            status = NRF_ERROR_NOT_FOUND;
+        }
+        NRF_LOG_INST_DEBUG(p_queue->p_log, "%s element 0x%08X, status:%d",
+                                             just_peek ? "peeked" : "popped", p_element, status);
+        return status;
+    }
+
     CRITICAL_REGION_ENTER();
 
     if (!nrf_queue_is_empty(p_queue))
@@ -245,30 +579,7 @@ ret_code_t nrf_queue_generic_pop(nrf_queue_t const * p_queue,
         }
 
         // Read element.
-        switch (p_queue->element_size)
-        {
-            case sizeof(uint8_t):
-                *((uint8_t *)p_element) = ((uint8_t *)p_queue->p_buffer)[read_pos];
-                break;
-
-            case sizeof(uint16_t):
-                *((uint16_t *)p_element) = ((uint16_t *)p_queue->p_buffer)[read_pos];
-                break;
-
-            case sizeof(uint32_t):
-                *((uint32_t *)p_element) = ((uint32_t *)p_queue->p_buffer)[read_pos];
-                break;
-
-            case sizeof(uint64_t):
-                *((uint64_t *)p_element) = ((uint64_t *)p_queue->p_buffer)[read_pos];
-                break;
-
-            default:
-                memcpy(p_element,
-                       (void const *)((size_t)p_queue->p_buffer + read_pos * p_queue->element_size),
-                       p_queue->element_size);
-                break;
-        }
+        element_read(p_queue, read_pos, p_element);
     }
     else
     {
@@ -345,11 +656,7 @@ static void queue_write(nrf_queue_t const * p_queue, void const * p_data, uint32
     }
 
     // Update utilization.
-    size_t utilization = queue_utilization_get(p_queue);
-    if (p_queue->p_cb->max_utilization < utilization)
-    {
-        p_queue->p_cb->max_utilization = utilization;
-    }
+    max_utilization_update(p_queue, queue_utilization_get(p_queue));
 }
 
 ret_code_t nrf_queue_write(nrf_queue_t const * p_queue,
@@ -367,6 +674,17 @@ ret_code_t nrf_queue_write(nrf_queue_t const * p_queue,
         return NRF_SUCCESS;
     }
 
+    if (p_queue->mode == NRF_QUEUE_MODE_SPSC)
+    {
+        if (spsc_write(p_queue, p_data, element_count, false) == 0)
+        {
+            status = NRF_ERROR_NO_MEM;
+        }
+        NRF_LOG_INST_DEBUG(p_queue->p_log, "Write %d elements (start address: 0x%08X), status:%d",
+                                           element_count, p_data, status);
+        return status;
+    }
+
     CRITICAL_REGION_ENTER();
 
     if ((nrf_queue_available_get(p_queue) >= element_count)
@@ -401,6 +719,14 @@ size_t nrf_queue_in(nrf_queue_t const * p_queue,
         return 0;
     }
 
+    if (p_queue->mode == NRF_QUEUE_MODE_SPSC)
+    {
+        element_count = spsc_write(p_queue, p_data, element_count, true);
+        NRF_LOG_INST_DEBUG(p_queue->p_log, "Put in %d elements (start address: 0x%08X), requested :%d",
+                                           element_count, p_data, req_element_count);
+        return element_count;
+    }
+
     CRITICAL_REGION_ENTER();
 
     if (p_queue->mode == NRF_QUEUE_MODE_OVERFLOW)
@@ -477,6 +803,17 @@ ret_code_t nrf_queue_read(nrf_queue_t const * p_queue,
         return NRF_SUCCESS;
     }
 
+    if (p_queue->mode == NRF_QUEUE_MODE_SPSC)
+    {
+        if (spsc_read(p_queue, p_data, element_count, false) == 0)
+        {
+            status = NRF_ERROR_NOT_FOUND;
+        }
+        NRF_LOG_INST_DEBUG(p_queue->p_log, "Read %d elements (start address: 0x%08X), status :%d",
+                                           element_count, p_data, status);
+        return status;
+    }
+
     CRITICAL_REGION_ENTER();
 
     if (element_count <= queue_utilization_get(p_queue))
@@ -509,6 +846,14 @@ size_t nrf_queue_out(nrf_queue_t const * p_queue,
         return 0;
     }
 
+    if (p_queue->mode == NRF_QUEUE_MODE_SPSC)
+    {
+        element_count = spsc_read(p_queue, p_data, element_count, true);
+        NRF_LOG_INST_DEBUG(p_queue->p_log, "Out %d elements (start address: 0x%08X), requested :%d",
+                                           element_count, p_data, req_element_count);
+        return element_count;
+    }
+
     CRITICAL_REGION_ENTER();
 
     size_t utilization = queue_utilization_get(p_queue);
@@ -541,6 +886,12 @@ size_t nrf_queue_utilization_get(nrf_queue_t const * p_queue)
     size_t utilization;
     ASSERT(p_queue != NULL);
 
+    if (p_queue->mode == NRF_QUEUE_MODE_SPSC)
+    {
+        // Each index is read once, so the result is consistent without a critical section.
+        return queue_utilization_get(p_queue);
+    }
+
     CRITICAL_REGION_ENTER();
 
     utilization = queue_utilization_get(p_queue);
@@ -78,8 +78,27 @@ typedef enum
 {
     NRF_QUEUE_MODE_OVERFLOW,        //!< If the queue is full, new element will overwrite the oldest.
     NRF_QUEUE_MODE_NO_OVERFLOW,     //!< If the queue is full, new element will not be accepted.
+    NRF_QUEUE_MODE_SPSC,            //!< Lock-free single producer, single consumer queue. If the queue is full,
+                                    //!< new element will not be accepted. See @ref nrf_queue_spsc.
 } nrf_queue_mode_t;
 
+/**@defgroup nrf_queue_spsc Single producer, single consumer mode
+ * @{
+ *
+ * In @ref NRF_QUEUE_MODE_SPSC mode, the queue does not use critical sections. The back index
+ * is only written by the producer and the front index only by the consumer, and each side
+ * publishes its index only after the element data has been copied. This is safe as long as:
+ * - only one context (for example, one interrupt handler) writes to the queue, using
+ *   push, write, in or the write span functions,
+ * - only one context reads from the queue, using pop, peek, read, out or the read span
+ *   functions,
+ * - @ref nrf_queue_reset is only called when neither side is active.
+ *
+ * The span functions give the producer and the consumer direct access to the queue storage,
+ * so that data can be produced into or consumed from the queue without an extra copy.
+ * @}
+ */
+
 /**@brief Instance of the queue. */
 typedef struct
 {
@@ -410,6 +429,48 @@ size_t nrf_queue_out(nrf_queue_t const * p_queue,
                     void               * p_data,
                     size_t               element_count);
 
+/**@brief Function for getting the contiguous free space at the back of the queue.
+ *
+ * @details Only available in @ref NRF_QUEUE_MODE_SPSC mode, for the producer. The span ends
+ *          at the free space or at the end of the queue storage, whichever comes first. Fill
+ *          the span and then call @ref nrf_queue_write_span_commit.
+ *
+ * @param[in]   p_queue             Pointer to the nrf_queue_t instance.
+ * @param[out]  pp_span             Pointer to the first free element.
+ *
+ * @return      The number of elements that can be written to the span.
+ */
+size_t nrf_queue_write_span_get(nrf_queue_t const * p_queue, void ** pp_span);
+
+/**@brief Function for adding elements written to the span from @ref nrf_queue_write_span_get.
+ *
+ * @param[in]   p_queue             Pointer to the nrf_queue_t instance.
+ * @param[in]   element_count       Number of elements written. Must not exceed the size of
+ *                                  the span.
+ */
+void nrf_queue_write_span_commit(nrf_queue_t const * p_queue, size_t element_count);
+
+/**@brief Function for getting the contiguous elements at the front of the queue.
+ *
+ * @details Only available in @ref NRF_QUEUE_MODE_SPSC mode, for the consumer. The span ends
+ *          at the last element or at the end of the queue storage, whichever comes first.
+ *          Process the span and then call @ref nrf_queue_read_span_release.
+ *
+ * @param[in]   p_queue             Pointer to the nrf_queue_t instance.
+ * @param[out]  pp_span             Pointer to the oldest element.
+ *
+ * @return      The number of elements in the span.
+ */
+size_t nrf_queue_read_span_get(nrf_queue_t const * p_queue, void const ** pp_span);
+
+/**@brief Function for removing elements read from the span from @ref nrf_queue_read_span_get.
+ *
+ * @param[in]   p_queue             Pointer to the nrf_queue_t instance.
+ * @param[in]   element_count       Number of elements to remove. Must not exceed the size of
+ *                                  the span.
+ */
+void nrf_queue_read_span_release(nrf_queue_t const * p_queue, size_t element_count);
+
 /**@brief Function for checking if the queue is full.
  *
  * @param[in]   p_queue     Pointer to the queue instance.
@@ -46,16 +46,33 @@
 #include "nrf_soc.h"
 #include "nrf_assert.h"
 #include "app_util_platform.h"
+#if APP_SCHEDULER_WITH_LANES
+#include "nrf_atfifo.h"
+#endif
 
 /**@brief Structure for holding a scheduled event header. */
 typedef struct
 {
     app_sched_event_handler_t handler;          /**< Pointer to event handler to receive the event. */
     uint16_t                  event_data_size;  /**< Size of event data. */
+#if APP_SCHEDULER_WITH_LANES && APP_SCHEDULER_WITH_PROFILER
+    uint32_t                  timestamp;        /**< Time when the event was put into the lane. */
+#endif
 } event_header_t;
 
 STATIC_ASSERT(sizeof(event_header_t) <= APP_SCHED_EVENT_HEADER_SIZE);
 
+#if APP_SCHEDULER_WITH_LANES
+STATIC_ASSERT(APP_SCHEDULER_DEFAULT_LANE < APP_SCHEDULER_LANES_COUNT);
+
+static nrf_atfifo_t m_lanes[APP_SCHEDULER_LANES_COUNT]; /**< Event queues of the priority lanes. */
+static uint16_t     m_queue_event_size;                 /**< Maximum event size in queue. */
+
+#if APP_SCHEDULER_WITH_PROFILER
+static app_sched_lane_stats_t     m_lane_stats[APP_SCHEDULER_LANES_COUNT]; /**< Statistics of the priority lanes. */
+static app_sched_timestamp_func_t m_timestamp_func;                        /**< Function used for timestamping events. */
+#endif
+#else
 static event_header_t * m_queue_event_headers;  /**< Array for holding the queue event headers. */
 static uint8_t        * m_queue_event_data;     /**< Array for holding the queue event data. */
 static volatile uint8_t m_queue_start_index;    /**< Index of queue entry at the start of the queue. */
@@ -66,12 +83,215 @@ static uint16_t         m_queue_size;           /**< Number of queue entries. */
 #if APP_SCHEDULER_WITH_PROFILER
 static uint16_t m_max_queue_utilization;    /**< Maximum observed queue utilization. */
 #endif
+#endif // APP_SCHEDULER_WITH_LANES
 
 #if APP_SCHEDULER_WITH_PAUSE
 static uint32_t m_scheduler_paused_counter = 0; /**< Counter storing the difference between pausing
                                                      and resuming the scheduler. */
 #endif
 
+#if APP_SCHEDULER_WITH_LANES
+/**@brief Function for getting the number of events in the lane.
+ *
+ * @details Events which are being put or executed are included.
+ */
+static uint16_t lane_utilization_get(nrf_atfifo_t const * p_lane)
+{
+    uint16_t wr = p_lane->tail.pos.wr;
+    uint16_t rd = p_lane->head.pos.wr;
+    uint16_t used = (wr >= rd) ? (wr - rd) : (p_lane->buf_size - rd + wr);
+
+    return used / p_lane->item_size;
+}
+
+
+uint32_t app_sched_init(uint16_t event_size, uint16_t queue_size, void * p_event_buffer)
+{
+    uint16_t item_size = APP_SCHED_EVENT_HEADER_SIZE + ALIGN_NUM(sizeof(uint32_t), event_size);
+    uint32_t lane_size = (uint32_t)item_size * (queue_size + 1);
+
+    // Check that buffer is correctly aligned
+    if (!is_word_aligned(p_event_buffer))
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    if (lane_size > UINT16_MAX)
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    m_queue_event_size = event_size;
+
+    for (uint32_t i = 0; i < APP_SCHEDULER_LANES_COUNT; i++)
+    {
+        ret_code_t err_code = nrf_atfifo_init(&m_lanes[i],
+                                              &((uint8_t *)p_event_buffer)[i * lane_size],
+                                              (uint16_t)lane_size,
+                                              item_size);
+        if (err_code != NRF_SUCCESS)
+        {
+            return err_code;
+        }
+    }
+
+#if APP_SCHEDULER_WITH_PROFILER
+    memset(m_lane_stats, 0, sizeof(m_lane_stats));
+#endif
+
+    return NRF_SUCCESS;
+}
+
+
+uint16_t app_sched_lane_space_get(uint8_t lane)
+{
+    ASSERT(lane < APP_SCHEDULER_LANES_COUNT);
+
+    nrf_atfifo_t const * p_lane = &m_lanes[lane];
+    return (p_lane->buf_size / p_lane->item_size) - 1 - lane_utilization_get(p_lane);
+}
+
+
+uint16_t app_sched_queue_space_get()
+{
+    return app_sched_lane_space_get(APP_SCHEDULER_DEFAULT_LANE);
+}
+
+
+#if APP_SCHEDULER_WITH_PROFILER
+/**@brief Function for raising a 16-bit statistics maximum without masking interrupts.
+ *
+ * @details Exclusive access retries the store if another context wrote the value in between, so
+ *          the update can be done from any interrupt priority.
+ */
+static void stat_max_update_16(volatile uint16_t * p_max, uint16_t value)
+{
+    do
+    {
+        if (__LDREXH(p_max) >= value)
+        {
+            __CLREX();
+            return;
+        }
+    } while (__STREXH(value, p_max) != 0);
+}
+
+/**@brief Function for raising a 32-bit statistics maximum without masking interrupts. */
+static void stat_max_update_32(volatile uint32_t * p_max, uint32_t value)
+{
+    do
+    {
+        if (__LDREXW(p_max) >= value)
+        {
+            __CLREX();
+            return;
+        }
+    } while (__STREXW(value, p_max) != 0);
+}
+
+static void lane_utilization_check(uint8_t lane)
+{
+    stat_max_update_16(&m_lane_stats[lane].max_utilization, lane_utilization_get(&m_lanes[lane]));
+}
+
+static void lane_latency_check(uint8_t lane, event_header_t const * p_header)
+{
+    m_lane_stats[lane].event_count++;
+    if (m_timestamp_func != NULL)
+    {
+        stat_max_update_32(&m_lane_stats[lane].max_latency, m_timestamp_func() - p_header->timestamp);
+    }
+}
+
+void app_sched_timestamp_func_set(app_sched_timestamp_func_t timestamp_func)
+{
+    m_timestamp_func = timestamp_func;
+}
+
+void app_sched_lane_stats_get(uint8_t lane, app_sched_lane_stats_t * p_stats)
+{
+    ASSERT(lane < APP_SCHEDULER_LANES_COUNT);
+    ASSERT(p_stats != NULL);
+
+    CRITICAL_REGION_ENTER();
+    *p_stats = m_lane_stats[lane];
+    CRITICAL_REGION_EXIT();
+}
+
+uint16_t app_sched_queue_utilization_get(void)
+{
+    uint16_t max_utilization = 0;
+
+    for (uint32_t i = 0; i < APP_SCHEDULER_LANES_COUNT; i++)
+    {
+        if (m_lane_stats[i].max_utilization > max_utilization)
+        {
+            max_utilization = m_lane_stats[i].max_utilization;
+        }
+    }
+    return max_utilization;
+}
+#endif // APP_SCHEDULER_WITH_PROFILER
+
+
+uint32_t app_sched_event_put_prio(void const              * p_event_data,
+                                  uint16_t                  event_data_size,
+                                  app_sched_event_handler_t handler,
+                                  uint8_t                   lane)
+{
+    nrf_atfifo_item_put_t context;
+    event_header_t *      p_header;
+
+    if (lane >= APP_SCHEDULER_LANES_COUNT)
+    {
+        return NRF_ERROR_INVALID_PARAM;
+    }
+
+    if (event_data_size > m_queue_event_size)
+    {
+        return NRF_ERROR_INVALID_LENGTH;
+    }
+
+    // Allocation is lock-free, so the event can be put from any interrupt priority.
+    p_header = nrf_atfifo_item_alloc(&m_lanes[lane], &context);
+    if (p_header == NULL)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    p_header->handler = handler;
+    if ((p_event_data != NULL) && (event_data_size > 0))
+    {
+        memcpy((uint8_t *)p_header + APP_SCHED_EVENT_HEADER_SIZE, p_event_data, event_data_size);
+        p_header->event_data_size = event_data_size;
+    }
+    else
+    {
+        p_header->event_data_size = 0;
+    }
+
+#if APP_SCHEDULER_WITH_PROFILER
+    p_header->timestamp = (m_timestamp_func != NULL) ? m_timestamp_func() : 0;
+    lane_utilization_check(lane);
+#endif
+
+    // If this put interrupted another one, the event is committed together with the interrupted one.
+    UNUSED_RETURN_VALUE(nrf_atfifo_item_put(&m_lanes[lane], &context));
+
+    return NRF_SUCCESS;
+}
+
+
+uint32_t app_sched_event_put(void const              * p_event_data,
+                             uint16_t                  event_data_size,
+                             app_sched_event_handler_t handler)
+{
+    return app_sched_event_put_prio(p_event_data,
+                                    event_data_size,
+                                    handler,
+                                    APP_SCHEDULER_DEFAULT_LANE);
+}
+#else
 /**@brief Function for incrementing a queue index, and handle wrap-around.
  *
  * @param[in]   index   Old index.
@@ -218,6 +438,7 @@ uint32_t app_sched_event_put(void const              * p_event_data,
 
     return err_code;
 }
+#endif // APP_SCHEDULER_WITH_LANES
 
 
 #if APP_SCHEDULER_WITH_PAUSE
@@ -260,6 +481,37 @@ static __INLINE bool is_app_sched_paused(void)
 }
 
 
+#if APP_SCHEDULER_WITH_LANES
+void app_sched_execute(void)
+{
+    uint8_t lane = 0;
+
+    while (!is_app_sched_paused() && (lane < APP_SCHEDULER_LANES_COUNT))
+    {
+        nrf_atfifo_item_get_t context;
+        event_header_t *      p_header = nrf_atfifo_item_get(&m_lanes[lane], &context);
+
+        if (p_header == NULL)
+        {
+            // Lane is empty, continue with the next lower priority lane.
+            lane++;
+            continue;
+        }
+
+#if APP_SCHEDULER_WITH_PROFILER
+        lane_latency_check(lane, p_header);
+#endif
+
+        p_header->handler((uint8_t *)p_header + APP_SCHED_EVENT_HEADER_SIZE,
+                          p_header->event_data_size);
+
+        UNUSED_RETURN_VALUE(nrf_atfifo_item_free(&m_lanes[lane], &context));
+
+        // Higher priority events could have been put while the handler was running.
+        lane = 0;
+    }
+}
+#else
 void app_sched_execute(void)
 {
     while (!is_app_sched_paused() && !APP_SCHED_QUEUE_EMPTY())
@@ -285,4 +537,5 @@ void app_sched_execute(void)
         m_queue_start_index = next_index(m_queue_start_index);
     }
 }
+#endif // APP_SCHEDULER_WITH_LANES
 #endif //NRF_MODULE_ENABLED(APP_SCHEDULER)
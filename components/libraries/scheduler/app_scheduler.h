@@ -86,6 +86,38 @@
 extern "C" {
 #endif
 
+#ifndef APP_SCHEDULER_WITH_LANES
+#define APP_SCHEDULER_WITH_LANES 0
+#endif
+
+#if APP_SCHEDULER_WITH_LANES
+#ifndef APP_SCHEDULER_LANES_COUNT
+#define APP_SCHEDULER_LANES_COUNT 3
+#endif
+#ifndef APP_SCHEDULER_DEFAULT_LANE
+#define APP_SCHEDULER_DEFAULT_LANE (APP_SCHEDULER_LANES_COUNT - 1)
+#endif
+
+#if APP_SCHEDULER_WITH_PROFILER
+#define APP_SCHED_EVENT_HEADER_SIZE 12      /**< Size of app_scheduler.event_header_t (only for use inside APP_SCHED_BUF_SIZE()). */
+#else
+#define APP_SCHED_EVENT_HEADER_SIZE 8       /**< Size of app_scheduler.event_header_t (only for use inside APP_SCHED_BUF_SIZE()). */
+#endif
+
+/**@brief Compute number of bytes required to hold the scheduler buffer.
+ *
+ * @details Every priority lane holds QUEUE_SIZE events. Event data is padded to a word boundary.
+ *
+ * @param[in] EVENT_SIZE   Maximum size of events to be passed through the scheduler.
+ * @param[in] QUEUE_SIZE   Number of entries in each lane of the scheduler queue (i.e. the maximum
+ *                         number of events that can be scheduled for execution in one lane).
+ *
+ * @return    Required scheduler buffer size (in bytes).
+ */
+#define APP_SCHED_BUF_SIZE(EVENT_SIZE, QUEUE_SIZE)                                                 \
+            ((ALIGN_NUM(sizeof(uint32_t), (EVENT_SIZE)) + APP_SCHED_EVENT_HEADER_SIZE) *           \
+             ((QUEUE_SIZE) + 1) * APP_SCHEDULER_LANES_COUNT)
+#else
 #define APP_SCHED_EVENT_HEADER_SIZE 8       /**< Size of app_scheduler.event_header_t (only for use inside APP_SCHED_BUF_SIZE()). */
 
 /**@brief Compute number of bytes required to hold the scheduler buffer.
@@ -98,10 +130,22 @@ extern "C" {
  */
 #define APP_SCHED_BUF_SIZE(EVENT_SIZE, QUEUE_SIZE)                                                 \
             (((EVENT_SIZE) + APP_SCHED_EVENT_HEADER_SIZE) * ((QUEUE_SIZE) + 1))
+#endif // APP_SCHEDULER_WITH_LANES
 
 /**@brief Scheduler event handler type. */
 typedef void (*app_sched_event_handler_t)(void * p_event_data, uint16_t event_size);
 
+/**@brief Timestamp function type used for measuring event latency. */
+typedef uint32_t (*app_sched_timestamp_func_t)(void);
+
+/**@brief Statistics of a priority lane. */
+typedef struct
+{
+    uint16_t max_utilization; /**< Maximum observed number of events in the lane. */
+    uint32_t max_latency;     /**< Maximum observed time between putting and executing an event (in timestamp units). */
+    uint32_t event_count;     /**< Number of executed events. */
+} app_sched_lane_stats_t;
+
 /**@brief Macro for initializing the event scheduler.
  *
  * @details It will also handle dimensioning and allocation of the memory buffer required by the
@@ -164,6 +208,30 @@ uint32_t app_sched_event_put(void const *              p_event_data,
                              uint16_t                  event_size,
                              app_sched_event_handler_t handler);
 
+/**@brief Function for scheduling an event in a given priority lane.
+ *
+ * @details Puts an event into the queue of the lane. Lanes are served strictly by priority, lane 0
+ *          first, so events in a lane are executed only when all higher priority lanes are empty.
+ *          The function is lock-free and can be called from any interrupt priority.
+ *
+ * @note @ref APP_SCHEDULER_WITH_LANES must be enabled to use this functionality.
+ *       @ref app_sched_event_put uses @ref APP_SCHEDULER_DEFAULT_LANE.
+ *
+ * @param[in]   p_event_data   Pointer to event data to be scheduled.
+ * @param[in]   event_size     Size of event data to be scheduled.
+ * @param[in]   handler        Event handler to receive the event.
+ * @param[in]   lane           Priority lane (0 is the highest priority).
+ *
+ * @retval      NRF_SUCCESS               Event scheduled.
+ * @retval      NRF_ERROR_INVALID_PARAM   Invalid lane.
+ * @retval      NRF_ERROR_INVALID_LENGTH  Event data too long.
+ * @retval      NRF_ERROR_NO_MEM          Lane queue is full.
+ */
+uint32_t app_sched_event_put_prio(void const *              p_event_data,
+                                  uint16_t                  event_size,
+                                  app_sched_event_handler_t handler,
+                                  uint8_t                   lane);
+
 /**@brief Function for getting the maximum observed queue utilization.
  *
  * Function for tuning the module and determining QUEUE_SIZE value and thus module RAM usage.
@@ -183,6 +251,39 @@ uint16_t app_sched_queue_utilization_get(void);
  */
 uint16_t app_sched_queue_space_get(void);
 
+/**@brief Function for getting the current amount of free space in the queue of a priority lane.
+ *
+ * @note @ref APP_SCHEDULER_WITH_LANES must be enabled to use this functionality.
+ *       @ref app_sched_queue_space_get returns space of @ref APP_SCHEDULER_DEFAULT_LANE.
+ *
+ * @param[in]   lane   Priority lane.
+ *
+ * @return Amount of free space in the queue of the lane.
+ */
+uint16_t app_sched_lane_space_get(uint8_t lane);
+
+/**@brief Function for setting the timestamp function used for measuring event latency.
+ *
+ * @details Latency is computed as the difference of two timestamps modulo 2^32, so the function
+ *          should return a free running 32-bit counter.
+ *
+ * @note @ref APP_SCHEDULER_WITH_LANES and @ref APP_SCHEDULER_WITH_PROFILER must be enabled to use
+ *       this functionality.
+ *
+ * @param[in]   timestamp_func   Timestamp function, NULL to disable latency measurement.
+ */
+void app_sched_timestamp_func_set(app_sched_timestamp_func_t timestamp_func);
+
+/**@brief Function for getting statistics of a priority lane.
+ *
+ * @note @ref APP_SCHEDULER_WITH_LANES and @ref APP_SCHEDULER_WITH_PROFILER must be enabled to use
+ *       this functionality.
+ *
+ * @param[in]   lane     Priority lane.
+ * @param[out]  p_stats  Statistics of the lane.
+ */
+void app_sched_lane_stats_get(uint8_t lane, app_sched_lane_stats_t * p_stats);
+
 /**@brief A function to pause the scheduler.
  *
  * @details When the scheduler is paused events are not pulled from the scheduler queue for
@@ -38,6 +38,7 @@
  *
  */
 #include <stdlib.h>
+#include <string.h>
 #include "sha256.h"
 #include "sdk_errors.h"
 #include "sdk_common.h"
@@ -46,13 +47,54 @@
 #define ROTLEFT(a,b) (((a) << (b)) | ((a) >> (32 - (b))))
 #define ROTRIGHT(a,b) (((a) >> (b)) | ((a) << (32 - (b))))
 
-#define CH(x,y,z) (((x) & (y)) ^ (~(x) & (z)))
-#define MAJ(x,y,z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define CH(x,y,z) ((z) ^ ((x) & ((y) ^ (z))))
+#define MAJ(x,y,z) (((x) & (y)) | ((z) & ((x) | (y))))
 #define EP0(x) (ROTRIGHT(x,2) ^ ROTRIGHT(x,13) ^ ROTRIGHT(x,22))
 #define EP1(x) (ROTRIGHT(x,6) ^ ROTRIGHT(x,11) ^ ROTRIGHT(x,25))
 #define SIG0(x) (ROTRIGHT(x,7) ^ ROTRIGHT(x,18) ^ ((x) >> 3))
 #define SIG1(x) (ROTRIGHT(x,17) ^ ROTRIGHT(x,19) ^ ((x) >> 10))
 
+// Big-endian load of a message word. On Cortex-M the aligned variant is a single LDR and REV.
+#if defined(__CORTEX_M)
+#define LOAD_BE32_ALIGNED(p) __REV(*(const uint32_t *)(p))
+#else
+#define LOAD_BE32_ALIGNED(p) LOAD_BE32(p)
+#endif
+#define LOAD_BE32(p) (((uint32_t)(p)[0] << 24) | ((uint32_t)(p)[1] << 16) | \
+                      ((uint32_t)(p)[2] << 8)  |  (uint32_t)(p)[3])
+
+// Message schedule kept in a rolling window of 16 words.
+#define W(i) m[(i) & 15]
+#define SCHEDULE(i) (W(i) += SIG1(W((i) - 2)) + W((i) - 7) + SIG0(W((i) - 15)))
+
+// One round. Instead of shifting the eight working variables, the callers rotate the argument order.
+#define ROUND(a,b,c,d,e,f,g,h,i,w)                              \
+    do {                                                        \
+        uint32_t t1 = h + EP1(e) + CH(e,f,g) + k[i] + (w);      \
+        d += t1;                                                \
+        h  = t1 + EP0(a) + MAJ(a,b,c);                          \
+    } while (0)
+
+#define ROUNDS_8_NO_SCHEDULE(i)                         \
+    ROUND(a,b,c,d,e,f,g,h,(i) + 0, W((i) + 0));         \
+    ROUND(h,a,b,c,d,e,f,g,(i) + 1, W((i) + 1));         \
+    ROUND(g,h,a,b,c,d,e,f,(i) + 2, W((i) + 2));         \
+    ROUND(f,g,h,a,b,c,d,e,(i) + 3, W((i) + 3));         \
+    ROUND(e,f,g,h,a,b,c,d,(i) + 4, W((i) + 4));         \
+    ROUND(d,e,f,g,h,a,b,c,(i) + 5, W((i) + 5));         \
+    ROUND(c,d,e,f,g,h,a,b,(i) + 6, W((i) + 6));         \
+    ROUND(b,c,d,e,f,g,h,a,(i) + 7, W((i) + 7))
+
+#define ROUNDS_8(i)                                     \
+    ROUND(a,b,c,d,e,f,g,h,(i) + 0, SCHEDULE((i) + 0));  \
+    ROUND(h,a,b,c,d,e,f,g,(i) + 1, SCHEDULE((i) + 1));  \
+    ROUND(g,h,a,b,c,d,e,f,(i) + 2, SCHEDULE((i) + 2));  \
+    ROUND(f,g,h,a,b,c,d,e,(i) + 3, SCHEDULE((i) + 3));  \
+    ROUND(e,f,g,h,a,b,c,d,(i) + 4, SCHEDULE((i) + 4));  \
+    ROUND(d,e,f,g,h,a,b,c,(i) + 5, SCHEDULE((i) + 5));  \
+    ROUND(c,d,e,f,g,h,a,b,(i) + 6, SCHEDULE((i) + 6));  \
+    ROUND(b,c,d,e,f,g,h,a,(i) + 7, SCHEDULE((i) + 7))
+
 
 static const uint32_t k[64] = {
     0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5,0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5,
@@ -66,6 +108,65 @@ static const uint32_t k[64] = {
 };
 
 
+/**@brief Function for calculating the hash of consecutive 64-byte blocks of data.
+ *
+ * @param[in,out] ctx     Hash instance.
+ * @param[in]     data    Data to be hashed.
+ * @param[in]     blocks  Number of 64-byte blocks in @p data.
+ */
+static void sha256_blocks(sha256_context_t * ctx, const uint8_t * data, size_t blocks)
+{
+    uint32_t m[16];
+    uint32_t i;
+    bool     aligned = (((uintptr_t)data & 3) == 0);
+
+    for (; blocks > 0; blocks--, data += 64)
+    {
+        if (aligned)
+        {
+            for (i = 0; i < 16; i++)
+            {
+                m[i] = LOAD_BE32_ALIGNED(data + 4 * i);
+            }
+        }
+        else
+        {
+            for (i = 0; i < 16; i++)
+            {
+                m[i] = LOAD_BE32(data + 4 * i);
+            }
+        }
+
+        uint32_t a = ctx->state[0];
+        uint32_t b = ctx->state[1];
+        uint32_t c = ctx->state[2];
+        uint32_t d = ctx->state[3];
+        uint32_t e = ctx->state[4];
+        uint32_t f = ctx->state[5];
+        uint32_t g = ctx->state[6];
+        uint32_t h = ctx->state[7];
+
+        ROUNDS_8_NO_SCHEDULE(0);
+        ROUNDS_8_NO_SCHEDULE(8);
+        ROUNDS_8(16);
+        ROUNDS_8(24);
+        ROUNDS_8(32);
+        ROUNDS_8(40);
+        ROUNDS_8(48);
+        ROUNDS_8(56);
+
+        ctx->state[0] += a;
+        ctx->state[1] += b;
+        ctx->state[2] += c;
+        ctx->state[3] += d;
+        ctx->state[4] += e;
+        ctx->state[5] += f;
+        ctx->state[6] += g;
+        ctx->state[7] += h;
+    }
+}
+
+
 /**@brief Function for calculating the hash of a 64-byte section of data.
  *
  * @param[in,out] ctx   Hash instance.
@@ -73,43 +174,7 @@ static const uint32_t k[64] = {
  */
 void sha256_transform(sha256_context_t *ctx, const uint8_t * data)
 {
-    uint32_t a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
-
-    for (i = 0, j = 0; i < 16; ++i, j += 4)
-        m[i] = (data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]);
-    for ( ; i < 64; ++i)
-        m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
-
-    a = ctx->state[0];
-    b = ctx->state[1];
-    c = ctx->state[2];
-    d = ctx->state[3];
-    e = ctx->state[4];
-    f = ctx->state[5];
-    g = ctx->state[6];
-    h = ctx->state[7];
-
-    for (i = 0; i < 64; ++i) {
-        t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i];
-        t2 = EP0(a) + MAJ(a,b,c);
-        h = g;
-        g = f;
-        f = e;
-        e = d + t1;
-        d = c;
-        c = b;
-        b = a;
-        a = t1 + t2;
-    }
-
-    ctx->state[0] += a;
-    ctx->state[1] += b;
-    ctx->state[2] += c;
-    ctx->state[3] += d;
-    ctx->state[4] += e;
-    ctx->state[5] += f;
-    ctx->state[6] += g;
-    ctx->state[7] += h;
+    sha256_blocks(ctx, data, 1);
 }
 
 
@@ -140,18 +205,40 @@ ret_code_t sha256_update(sha256_context_t *ctx, const uint8_t * data, size_t len
         return NRF_ERROR_NULL;
     }
 
-    uint32_t i;
+    // Top up a partially filled buffer first.
+    if (ctx->datalen > 0)
+    {
+        size_t fill = MIN(len, 64 - ctx->datalen);
 
-    for (i = 0; i < len; ++i) {
-        ctx->data[ctx->datalen] = data[i];
-        ctx->datalen++;
-        if (ctx->datalen == 64) {
-            sha256_transform(ctx, ctx->data);
-            ctx->bitlen += 512;
-            ctx->datalen = 0;
+        memcpy(&ctx->data[ctx->datalen], data, fill);
+        ctx->datalen += fill;
+        data         += fill;
+        len          -= fill;
+
+        if (ctx->datalen < 64)
+        {
+            return NRF_SUCCESS;
         }
+
+        sha256_blocks(ctx, ctx->data, 1);
+        ctx->bitlen += 512;
+        ctx->datalen = 0;
     }
 
+    // Hash whole blocks straight from the input, without copying them to the buffer.
+    if (len >= 64)
+    {
+        size_t blocks = len / 64;
+
+        sha256_blocks(ctx, data, blocks);
+        ctx->bitlen += (uint64_t)blocks * 512;
+        data        += blocks * 64;
+        len         -= blocks * 64;
+    }
+
+    memcpy(ctx->data, data, len);
+    ctx->datalen = len;
+
     return NRF_SUCCESS;
 }
 
@@ -100,6 +100,10 @@ extern "C" {
 
 #define APP_TIMER_MAX_CNT_VAL          RTC_COUNTER_COUNTER_Msk    /**< Maximum counter value that can be returned by @ref app_timer_cnt_get. */
 
+#ifndef APP_TIMER_CONFIG_USE_TIMING_WHEEL
+#define APP_TIMER_CONFIG_USE_TIMING_WHEEL 0
+#endif
+
 /**@brief Convert milliseconds to timer ticks.
  *
  * This macro uses 64-bit integer arithmetic, but as long as the macro parameters are
@@ -134,9 +138,14 @@ typedef void (*app_timer_timeout_handler_t)(void * p_context);
 /**
  * @brief app_timer control block
  */
-typedef struct
+typedef struct app_timer_s
 {
+#if APP_TIMER_CONFIG_USE_TIMING_WHEEL
+    struct app_timer_s *        p_wheel_next;  /**< Next timer in the same timing wheel slot. */
+    struct app_timer_s **       pp_wheel_prev; /**< Link pointing to this timer, NULL if timer is not on the wheel. */
+#else
     nrf_sortlist_item_t         list_item;     /**< Token used by sortlist. */
+#endif
     uint64_t                    end_val;       /**< RTC counter value when timer expires. */
     uint32_t                    repeat_period; /**< Repeat period (0 if single shot mode). */
     app_timer_timeout_handler_t handler;       /**< User handler. */
@@ -69,6 +69,25 @@ NRF_LOG_MODULE_REGISTER();
 
 #define APP_TIMER_RTC_MAX_VALUE   (DRV_RTC_MAX_CNT - APP_TIMER_SAFE_WINDOW)
 
+#if APP_TIMER_CONFIG_USE_TIMING_WHEEL
+#ifndef APP_TIMER_CONFIG_WHEEL_SLOT_BITS
+#define APP_TIMER_CONFIG_WHEEL_SLOT_BITS 4
+#endif
+#ifndef APP_TIMER_CONFIG_WHEEL_LEVELS
+#define APP_TIMER_CONFIG_WHEEL_LEVELS 6
+#endif
+
+#define WHEEL_SLOT_BITS APP_TIMER_CONFIG_WHEEL_SLOT_BITS  /**< Number of timestamp bits resolved by one wheel level. */
+#define WHEEL_SLOTS     (1UL << WHEEL_SLOT_BITS)          /**< Number of slots in one wheel level. */
+#define WHEEL_SLOT_MASK (WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS    APP_TIMER_CONFIG_WHEEL_LEVELS     /**< Number of wheel levels. */
+#define WHEEL_SPAN_BITS (WHEEL_SLOT_BITS * WHEEL_LEVELS)  /**< Number of timestamp bits covered by the wheel. */
+#define WHEEL_NO_EVENT  UINT64_MAX
+
+STATIC_ASSERT(WHEEL_SLOT_BITS <= 5, "Slots of a wheel level must fit in 32 bit bitmap.");
+STATIC_ASSERT(WHEEL_SPAN_BITS < 64, "Wheel cannot span more than 64 bit timestamp.");
+#endif
+
 static drv_rtc_t m_rtc_inst = DRV_RTC_INSTANCE(1);
 
 #if APP_TIMER_WITH_PROFILER
@@ -95,7 +114,9 @@ typedef struct
     app_timer_t *        p_timer; /**< Timer instance. */
 } timer_req_t;
 
+#if !APP_TIMER_CONFIG_USE_TIMING_WHEEL
 static app_timer_t * volatile mp_active_timer; /**< Timer currently handled by RTC driver. */
+#endif
 static bool                   m_global_active; /**< Flag used to globally disable all timers. */
 static uint64_t m_base_counter;
 static uint64_t m_stamp64;
@@ -103,9 +124,31 @@ static uint64_t m_stamp64;
 /* Request FIFO instance. */
 NRF_ATFIFO_DEF(m_req_fifo, timer_req_t, APP_TIMER_CONFIG_OP_QUEUE_SIZE);
 
+#if APP_TIMER_CONFIG_USE_TIMING_WHEEL
+/**
+ * @brief Hierarchical timing wheel.
+ *
+ * A timer is put on the level which resolves the most significant bit in which its end value
+ * differs from the wheel time, in the slot selected by that level's bits of the end value. Each
+ * occupied slot is therefore ahead of the wheel time and the lowest occupied slot of the lowest
+ * occupied level holds the earliest timers. When the wheel time reaches a slot, its timers are
+ * put on the wheel again, which cascades them to lower levels or moves them to the due list.
+ */
+typedef struct
+{
+    app_timer_t * p_slot[WHEEL_LEVELS][WHEEL_SLOTS]; /**< Slot lists. */
+    uint32_t      occupied[WHEEL_LEVELS];            /**< Bitmaps of occupied slots (cleared lazily). */
+    app_timer_t * p_far;                             /**< Timers beyond the span of the wheel. */
+    app_timer_t * p_due;                             /**< Timers which reached their end value. */
+    uint64_t      now;                               /**< Time up to which the wheel was processed. */
+} timer_wheel_t;
+
+static timer_wheel_t m_wheel;
+#else
 /* Sortlist instance. */
 static bool compare_func(nrf_sortlist_item_t * p_item0, nrf_sortlist_item_t *p_item1);
 NRF_SORTLIST_DEF(m_app_timer_sortlist, compare_func); /**< Sortlist used for storing queued timers. */
+#endif
 
 /**
  * @brief Return current 64 bit timestamp
@@ -124,6 +167,8 @@ static uint64_t get_now(void)
 
     return now;
 }
+
+#if !APP_TIMER_CONFIG_USE_TIMING_WHEEL
 /**
  * @brief Function used for comparing items in sorted list.
  */
@@ -136,6 +181,7 @@ static inline bool compare_func(nrf_sortlist_item_t * p_item0, nrf_sortlist_item
     uint64_t p1_end = p1->end_val;
     return (p0_end <= p1_end) ? true : false;
 }
+#endif
 
 #if APP_TIMER_CONFIG_USE_SCHEDULER
 static void scheduled_timeout_handler(void * p_event_data, uint16_t event_size)
@@ -147,6 +193,243 @@ static void scheduled_timeout_handler(void * p_event_data, uint16_t event_size)
 }
 #endif
 
+/**
+ * @brief Function for calling (or scheduling) user handler of expired timer.
+ */
+static void timer_handler_call(app_timer_t * p_timer)
+{
+#if APP_TIMER_CONFIG_USE_SCHEDULER
+    app_timer_event_t timer_event;
+
+    timer_event.timeout_handler = p_timer->handler;
+    timer_event.p_context       = p_timer->p_context;
+    uint32_t err_code = app_sched_event_put(&timer_event,
+                                            sizeof(timer_event),
+                                            scheduled_timeout_handler);
+    APP_ERROR_CHECK(err_code);
+#else
+    NRF_LOG_DEBUG("Timer expired (context: %d)", (uint32_t)p_timer->p_context)
+    p_timer->handler(p_timer->p_context);
+#endif
+}
+
+#if APP_TIMER_CONFIG_USE_TIMING_WHEEL
+/**
+ * @brief Function for getting index of the least significant bit set in the bitmap.
+ */
+static inline uint32_t wheel_lsb_get(uint32_t bitmap)
+{
+    return __CLZ(__RBIT(bitmap));
+}
+
+/**
+ * @brief Function for linking timer at the head of the list.
+ */
+static void wheel_link(app_timer_t ** pp_head, app_timer_t * p_timer)
+{
+    p_timer->p_wheel_next = *pp_head;
+    if (*pp_head)
+    {
+        (*pp_head)->pp_wheel_prev = &p_timer->p_wheel_next;
+    }
+    p_timer->pp_wheel_prev = pp_head;
+    *pp_head = p_timer;
+}
+
+/**
+ * @brief Function for unlinking timer from the wheel list it is on.
+ *
+ * @return True if timer was on the wheel.
+ */
+static bool wheel_unlink(app_timer_t * p_timer)
+{
+    if (p_timer->pp_wheel_prev == NULL)
+    {
+        return false;
+    }
+
+    *p_timer->pp_wheel_prev = p_timer->p_wheel_next;
+    if (p_timer->p_wheel_next)
+    {
+        p_timer->p_wheel_next->pp_wheel_prev = p_timer->pp_wheel_prev;
+    }
+    p_timer->pp_wheel_prev = NULL;
+    return true;
+}
+
+/**
+ * @brief Function for putting timer on the wheel according to its end value.
+ */
+static void wheel_add(app_timer_t * p_timer)
+{
+    uint64_t diff  = p_timer->end_val ^ m_wheel.now;
+    uint32_t level = 0;
+
+    if (p_timer->end_val <= m_wheel.now)
+    {
+        wheel_link(&m_wheel.p_due, p_timer);
+    }
+    else if (diff >> WHEEL_SPAN_BITS)
+    {
+        wheel_link(&m_wheel.p_far, p_timer);
+    }
+    else
+    {
+        while (diff >> (WHEEL_SLOT_BITS * (level + 1)))
+        {
+            level++;
+        }
+
+        uint32_t slot = (uint32_t)(p_timer->end_val >> (WHEEL_SLOT_BITS * level)) & WHEEL_SLOT_MASK;
+        wheel_link(&m_wheel.p_slot[level][slot], p_timer);
+        m_wheel.occupied[level] |= (1UL << slot);
+    }
+}
+
+/**
+ * @brief Function for getting time of the next wheel event.
+ *
+ * @param[out] p_level Level of the slot due at returned time (WHEEL_LEVELS for far timers).
+ * @param[out] p_slot  Slot due at returned time.
+ *
+ * @return Time of the next event or WHEEL_NO_EVENT if there are no timers on the wheel.
+ */
+static uint64_t wheel_next_event_get(uint32_t * p_level, uint32_t * p_slot)
+{
+    for (uint32_t level = 0; level < WHEEL_LEVELS; level++)
+    {
+        while (m_wheel.occupied[level])
+        {
+            uint32_t slot  = wheel_lsb_get(m_wheel.occupied[level]);
+            uint32_t shift = WHEEL_SLOT_BITS * level;
+
+            if (m_wheel.p_slot[level][slot] == NULL)
+            {
+                /* All timers from the slot were stopped. */
+                m_wheel.occupied[level] &= ~(1UL << slot);
+                continue;
+            }
+
+            *p_level = level;
+            *p_slot  = slot;
+            return ((m_wheel.now >> (shift + WHEEL_SLOT_BITS)) << (shift + WHEEL_SLOT_BITS)) |
+                   ((uint64_t)slot << shift);
+        }
+    }
+
+    if (m_wheel.p_far)
+    {
+        *p_level = WHEEL_LEVELS;
+        *p_slot  = 0;
+        return ((m_wheel.now >> WHEEL_SPAN_BITS) + 1) << WHEEL_SPAN_BITS;
+    }
+
+    return WHEEL_NO_EVENT;
+}
+
+/**
+ * @brief Function for advancing the wheel to given time.
+ *
+ * Slots reached on the way are emptied and their timers are put on the wheel again. Timers which
+ * reached their end value end up on the due list.
+ */
+static void wheel_advance(uint64_t now)
+{
+    uint32_t level;
+    uint32_t slot;
+    uint64_t next = wheel_next_event_get(&level, &slot);
+
+    while (next <= now)
+    {
+        app_timer_t * p_list;
+
+        m_wheel.now = next;
+        if (level == WHEEL_LEVELS)
+        {
+            p_list        = m_wheel.p_far;
+            m_wheel.p_far = NULL;
+        }
+        else
+        {
+            p_list                      = m_wheel.p_slot[level][slot];
+            m_wheel.p_slot[level][slot] = NULL;
+            m_wheel.occupied[level]    &= ~(1UL << slot);
+        }
+
+        while (p_list)
+        {
+            app_timer_t * p_timer = p_list;
+            p_list = p_timer->p_wheel_next;
+            wheel_add(p_timer);
+        }
+
+        next = wheel_next_event_get(&level, &slot);
+    }
+
+    m_wheel.now = now;
+}
+
+/**
+ * @brief Function for deactivating all timers from the list.
+ */
+static void wheel_list_stop(app_timer_t ** pp_head)
+{
+    while (*pp_head)
+    {
+        app_timer_t * p_timer = *pp_head;
+        UNUSED_RETURN_VALUE(wheel_unlink(p_timer));
+        p_timer->active = false;
+    }
+}
+
+/**
+ * @brief Function for deactivating all timers which are on the wheel (active timers).
+ */
+static void wheel_stop_all(void)
+{
+    for (uint32_t level = 0; level < WHEEL_LEVELS; level++)
+    {
+        for (uint32_t slot = 0; slot < WHEEL_SLOTS; slot++)
+        {
+            wheel_list_stop(&m_wheel.p_slot[level][slot]);
+        }
+        m_wheel.occupied[level] = 0;
+    }
+    wheel_list_stop(&m_wheel.p_far);
+    wheel_list_stop(&m_wheel.p_due);
+}
+
+/**
+ * @brief Function called for timer which reached its end value.
+ *
+ * Function calls user handler if timer was not stopped before. If timer is in repeated mode then
+ * it is put back on the wheel.
+ *
+ * @param p_timer Timer instance.
+ */
+static void timer_expire(app_timer_t * p_timer)
+{
+    ASSERT(p_timer->handler);
+
+    if ((m_global_active == true) && (p_timer->active))
+    {
+        if (p_timer->repeat_period == 0)
+        {
+            p_timer->active = false;
+        }
+
+        timer_handler_call(p_timer);
+
+        /* check active flag as it may have been stopped in the user handler */
+        if ((p_timer->repeat_period) && (p_timer->active))
+        {
+            p_timer->end_val += p_timer->repeat_period;
+            wheel_add(p_timer);
+        }
+    }
+}
+#else
+
 /**
  * @brief Function called on timer expiration
  * If end value is not reached it is assumed that it was partial expiration and time is put back
@@ -170,19 +453,7 @@ static bool timer_expire(app_timer_t * p_timer)
             {
                 p_timer->active = false;
             }
-    #if APP_TIMER_CONFIG_USE_SCHEDULER
-            app_timer_event_t timer_event;
-
-            timer_event.timeout_handler = p_timer->handler;
-            timer_event.p_context       = p_timer->p_context;
-            uint32_t err_code = app_sched_event_put(&timer_event,
-                                                    sizeof(timer_event),
-                                                    scheduled_timeout_handler);
-            APP_ERROR_CHECK(err_code);
-    #else
-            NRF_LOG_DEBUG("Timer expired (context: %d)", (uint32_t)p_timer->p_context)
-            p_timer->handler(p_timer->p_context);
-    #endif
+            timer_handler_call(p_timer);
             /* check active flag as it may have been stopped in the user handler */
             if ((p_timer->repeat_period) && (p_timer->active))
             {
@@ -275,6 +546,7 @@ static void sorted_list_stop_all(void)
         }
     } while (p_next);
 }
+#endif // APP_TIMER_CONFIG_USE_TIMING_WHEEL
 
 /**
  * @brief Function for handling RTC counter overflow.
@@ -292,6 +564,10 @@ static void on_overflow_evt(void)
  */
 static void on_compare_evt(drv_rtc_t const * const  p_instance)
 {
+#if APP_TIMER_CONFIG_USE_TIMING_WHEEL
+    /* Expired timers are handled when the wheel is advanced in rtc_update(). */
+    NRF_LOG_DEBUG("Compare EVT");
+#else
     if (mp_active_timer)
     {
         /* If assert fails it suggests that safe window should be increased. */
@@ -306,6 +582,7 @@ static void on_compare_evt(drv_rtc_t const * const  p_instance)
     {
         NRF_LOG_WARNING("Compare event but no active timer (already stopped?)");
     }
+#endif
 }
 
 /**
@@ -326,6 +603,57 @@ static void on_compare1_evt(drv_rtc_t const * const  p_instance)
  */
 static void rtc_update(drv_rtc_t const * const  p_instance)
 {
+#if APP_TIMER_CONFIG_USE_TIMING_WHEEL
+    while (1)
+    {
+        uint32_t level;
+        uint32_t slot;
+
+        wheel_advance(get_now());
+        while (m_wheel.p_due)
+        {
+            app_timer_t * p_timer = m_wheel.p_due;
+            UNUSED_RETURN_VALUE(wheel_unlink(p_timer));
+            timer_expire(p_timer);
+        }
+
+        uint64_t next = wheel_next_event_get(&level, &slot);
+        if (next == WHEEL_NO_EVENT)
+        {
+            drv_rtc_compare_disable(p_instance, 0);
+            if (!APP_TIMER_KEEPS_RTC_ACTIVE)
+            {
+                drv_rtc_stop(p_instance);
+            }
+            break;
+        }
+
+        int64_t remaining = (int64_t)(next - get_now());
+        if (remaining > 0)
+        {
+            uint32_t cc_val = ((uint64_t)remaining > APP_TIMER_RTC_MAX_VALUE) ?
+                    (app_timer_cnt_get() + APP_TIMER_RTC_MAX_VALUE) : (uint32_t)next;
+
+            ret_code_t ret = drv_rtc_windowed_compare_set(p_instance, 0, cc_val, APP_TIMER_SAFE_WINDOW);
+            NRF_LOG_DEBUG("Setting CC to 0x%08x (err: %d)", cc_val & DRV_RTC_MAX_CNT, ret);
+            if (ret == NRF_SUCCESS)
+            {
+                if (!APP_TIMER_KEEPS_RTC_ACTIVE)
+                {
+                    drv_rtc_start(p_instance);
+                }
+                break;
+            }
+            else if (ret != NRF_ERROR_TIMEOUT)
+            {
+                NRF_LOG_ERROR("Unexpected error: %d", ret);
+                ASSERT(0);
+                break;
+            }
+        }
+        //Wheel event occured before RTC was configured. Wheel is advanced again.
+    }
+#else
     while(1)
     {
         app_timer_t * p_next = sortlist_peek();
@@ -390,6 +718,7 @@ static void rtc_update(drv_rtc_t const * const  p_instance)
             break;
         }
     }
+#endif
 }
 
 /**
@@ -410,12 +739,23 @@ static void timer_req_process(drv_rtc_t const * const  p_instance)
                 if (!p_req->p_timer->active)
                 {
                     p_req->p_timer->active = true;
+#if APP_TIMER_CONFIG_USE_TIMING_WHEEL
+                    UNUSED_RETURN_VALUE(wheel_unlink(p_req->p_timer));
+                    wheel_add(p_req->p_timer);
+#else
                     nrf_sortlist_add(&m_app_timer_sortlist, &(p_req->p_timer->list_item));
+#endif
                     NRF_LOG_INST_DEBUG(p_req->p_timer->p_log,"Start request (expiring at %d/0x%08x).",
                                                   p_req->p_timer->end_val, p_req->p_timer->end_val);
                 }
                 break;
             case TIMER_REQ_STOP:
+#if APP_TIMER_CONFIG_USE_TIMING_WHEEL
+                if (!wheel_unlink(p_req->p_timer))
+                {
+                    NRF_LOG_INFO("Timer not found on wheel (stopping expired timer).");
+                }
+#else
                 if (p_req->p_timer == mp_active_timer)
                 {
                     mp_active_timer = NULL;
@@ -428,10 +768,15 @@ static void timer_req_process(drv_rtc_t const * const  p_instance)
                          NRF_LOG_INFO("Timer not found on sortlist (stopping expired timer).");
                     }
                 }
+#endif
                 NRF_LOG_INST_DEBUG(p_req->p_timer->p_log,"Stop request.");
                 break;
             case TIMER_REQ_STOP_ALL:
+#if APP_TIMER_CONFIG_USE_TIMING_WHEEL
+                wheel_stop_all();
+#else
                 sorted_list_stop_all();
+#endif
                 m_global_active = true;
                 NRF_LOG_INFO("Stop all request.");
                 break;
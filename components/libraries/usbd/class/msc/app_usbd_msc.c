@@ -256,23 +256,66 @@ static inline void * msc_buff_alloc(app_usbd_msc_t const * p_msc)
 }
 
 /**
- * @brief Put the buffer block.
+ * @brief Allocate a number of consecutive buffer blocks.
  *
- * Puts previously allocated buffer and marks it as ready to be processed.
+ * Allocated blocks are placed one after another in the memory, so they can be used
+ * as a single buffer by the block device. The allocation never wraps around the end
+ * of the buffer.
+ *
+ * @param[in]  p_msc   MSC instance data.
+ * @param[in]  max_cnt Maximum number of blocks to allocate.
+ * @param[out] p_cnt   Number of blocks allocated.
+ *
+ * @return Pointer to the first data block or NULL if there is no free space available.
+ */
+static inline void * msc_buff_contig_alloc(app_usbd_msc_t const * p_msc,
+                                           uint8_t                max_cnt,
+                                           uint8_t              * p_cnt)
+{
+    app_usbd_msc_ctx_t * p_ctx = msc_ctx_get(p_msc);
+    void * p_buff = NULL;
+    *p_cnt = 0;
+    CRITICAL_REGION_ENTER();
+    if (msc_buff_space_check(p_msc))
+    {
+        uint8_t buff_cnt = p_msc->specific.inst.block_buff_count;
+        uint8_t idx = (p_ctx->current.buff.rd_idx + p_ctx->current.buff.a_count) % buff_cnt;
+        uint8_t cnt = MIN(buff_cnt - p_ctx->current.buff.a_count, buff_cnt - idx);
+        size_t offset = idx * p_msc->specific.inst.block_buff_size;
+
+        cnt = MIN(cnt, max_cnt);
+        p_buff = ((uint8_t*)(p_msc->specific.inst.p_block_buff)) + offset;
+        p_ctx->current.buff.a_count += cnt;
+        *p_cnt = cnt;
+    }
+    NRF_LOG_DEBUG("buff_contig_alloc, idx: %u, dc: %u, ac: %u",
+                  p_ctx->current.buff.rd_idx,
+                  p_ctx->current.buff.d_count,
+                  p_ctx->current.buff.a_count);
+    CRITICAL_REGION_EXIT();
+
+    return p_buff;
+}
+
+/**
+ * @brief Put the buffer blocks.
+ *
+ * Puts previously allocated buffers and marks them as ready to be processed.
  *
  * @param p_msc MSC instance data.
+ * @param cnt   Number of blocks to put.
  *
  * @note This one may be called only if the previous call of
- *       @ref msc_buff_alloc succeed.
+ *       @ref msc_buff_alloc or @ref msc_buff_contig_alloc succeed.
  */
-static inline void msc_buff_put(app_usbd_msc_t const * p_msc)
+static inline void msc_buff_put(app_usbd_msc_t const * p_msc, uint8_t cnt)
 {
     app_usbd_msc_ctx_t * p_ctx = msc_ctx_get(p_msc);
     CRITICAL_REGION_ENTER();
     /* Assert if there is any space - if it is not it means some coding error */
-    ASSERT(p_ctx->current.buff.d_count < p_ctx->current.buff.a_count);
-    ASSERT(p_ctx->current.buff.d_count < p_msc->specific.inst.block_buff_count);
-    ++(p_ctx->current.buff.d_count);
+    ASSERT(p_ctx->current.buff.d_count + cnt <= p_ctx->current.buff.a_count);
+    ASSERT(p_ctx->current.buff.d_count + cnt <= p_msc->specific.inst.block_buff_count);
+    p_ctx->current.buff.d_count += cnt;
     NRF_LOG_DEBUG("buff_put, idx: %u, dc: %u, ac: %u",
                   p_ctx->current.buff.rd_idx,
                   p_ctx->current.buff.d_count,
@@ -308,25 +351,48 @@ static inline void * msc_buff_get(app_usbd_msc_t const * p_msc)
 }
 
 /**
- * @brief Free the last used data buffer block.
+ * @brief Get the number of consecutive data blocks ready to be processed.
  *
- * Function frees the oldest data block.
+ * Counts the blocks starting from the one returned by @ref msc_buff_get,
+ * up to the end of the buffer.
  *
  * @param p_msc MSC instance data.
  *
+ * @return Number of consecutive blocks filled with data.
+ */
+static inline uint8_t msc_buff_contig_data_get(app_usbd_msc_t const * p_msc)
+{
+    app_usbd_msc_ctx_t * p_ctx = msc_ctx_get(p_msc);
+    uint8_t cnt;
+    CRITICAL_REGION_ENTER();
+    cnt = MIN(p_ctx->current.buff.d_count,
+              p_msc->specific.inst.block_buff_count - p_ctx->current.buff.rd_idx);
+    CRITICAL_REGION_EXIT();
+
+    return cnt;
+}
+
+/**
+ * @brief Free the last used data buffer blocks.
+ *
+ * Function frees the oldest data blocks.
+ *
+ * @param p_msc MSC instance data.
+ * @param cnt   Number of blocks to free.
+ *
  * @note This one may be called only if the previous call of
  *       @ref msc_buff_get succeed.
  */
-static inline void msc_buff_free(app_usbd_msc_t const * p_msc)
+static inline void msc_buff_free(app_usbd_msc_t const * p_msc, uint8_t cnt)
 {
     app_usbd_msc_ctx_t * p_ctx = msc_ctx_get(p_msc);
     CRITICAL_REGION_ENTER();
     /* Assert if there is any data - in case there is none, a coding error exists */
-    ASSERT(p_ctx->current.buff.d_count > 0);
-    ASSERT(p_ctx->current.buff.a_count > 0);
-    --(p_ctx->current.buff.d_count);
-    --(p_ctx->current.buff.a_count);
-    p_ctx->current.buff.rd_idx = (p_ctx->current.buff.rd_idx + 1) %
+    ASSERT(p_ctx->current.buff.d_count >= cnt);
+    ASSERT(p_ctx->current.buff.a_count >= cnt);
+    p_ctx->current.buff.d_count -= cnt;
+    p_ctx->current.buff.a_count -= cnt;
+    p_ctx->current.buff.rd_idx = (p_ctx->current.buff.rd_idx + cnt) %
         p_msc->specific.inst.block_buff_count;
     NRF_LOG_DEBUG("buff_free, idx: %u, dc: %u, ac: %u",
               p_ctx->current.buff.rd_idx,
@@ -834,23 +900,46 @@ static ret_code_t setup_event_handler(app_usbd_class_inst_t const * p_inst,
 
 
 /**
- * @brief Get number of blocks that should be transfered into the selected LUN
+ * @brief Get number of work buffers that a single block device request may use.
  *
- * Function calculates number of blocks for the request.
- * The number of block is calculated based on the work buffer size and the size left to transfer.
+ * A single request covers at most half of the work buffers, so the USB transfer
+ * can always go on using the other half. The number is also limited to the
+ * buffers needed for the rest of the command.
  *
  * @param p_msc MSC instance.
  * @param size  The size of the transfer left.
  *
+ * @return Maximum number of buffers for the next block device request.
+ */
+static uint8_t current_buffcnt_calc(app_usbd_msc_t const * p_msc, size_t size)
+{
+    uint8_t  cnt    = MAX(1, p_msc->specific.inst.block_buff_count / 2);
+    uint32_t needed = CEIL_DIV(size, p_msc->specific.inst.block_buff_size);
+
+    return (uint8_t)MIN(cnt, needed);
+}
+
+
+/**
+ * @brief Get number of blocks that should be transfered into the selected LUN
+ *
+ * Function calculates number of blocks for the request.
+ * The number of block is calculated based on the number of work buffers used
+ * and the size left to transfer.
+ *
+ * @param p_msc    MSC instance.
+ * @param size     The size of the transfer left.
+ * @param buff_cnt Number of work buffers used by the request.
+ *
  * @return Number of blocks required for the transfer.
  */
-static uint32_t current_blkcnt_calc(app_usbd_msc_t const * p_msc, size_t size)
+static uint32_t current_blkcnt_calc(app_usbd_msc_t const * p_msc, size_t size, uint8_t buff_cnt)
 {
     app_usbd_msc_ctx_t * p_msc_ctx = msc_ctx_get(p_msc);
 
-    if (size > p_msc->specific.inst.block_buff_size)
+    if (size > buff_cnt * p_msc->specific.inst.block_buff_size)
     {
-        size = p_msc->specific.inst.block_buff_size;
+        size = buff_cnt * p_msc->specific.inst.block_buff_size;
     }
     return CEIL_DIV(size, p_msc_ctx->current.process.blk_size);
 }
@@ -937,8 +1026,14 @@ static ret_code_t read_blockmem_processor(app_usbd_class_inst_t const * p_inst)
         else if ((p_msc_ctx->current.process.size_left > 0) && msc_buff_space_check(p_msc))
         {
             nrf_block_dev_t const * p_blkd = p_msc->specific.inst.pp_block_devs[p_msc_ctx->cbw.lun];
-            uint32_t blk_cnt = current_blkcnt_calc(p_msc, p_msc_ctx->current.process.size_left);
-            void * p_buff    = msc_buff_alloc(p_msc);
+            uint8_t  buff_cnt;
+            void *   p_buff  = msc_buff_contig_alloc(
+                p_msc,
+                current_buffcnt_calc(p_msc, p_msc_ctx->current.process.size_left),
+                &buff_cnt);
+            uint32_t blk_cnt = current_blkcnt_calc(p_msc,
+                                                   p_msc_ctx->current.process.size_left,
+                                                   buff_cnt);
             ASSERT(p_buff != NULL);
             NRF_BLOCK_DEV_REQUEST(
                 req,
@@ -946,7 +1041,8 @@ static ret_code_t read_blockmem_processor(app_usbd_class_inst_t const * p_inst)
                 blk_cnt,
                 p_buff);
 
-            p_msc_ctx->current.process.pending = true;
+            p_msc_ctx->current.process.buff_cnt = buff_cnt;
+            p_msc_ctx->current.process.pending  = true;
             ret = nrf_blk_dev_read_req(p_blkd, &req);
 
             if (ret != NRF_SUCCESS)
@@ -1007,8 +1103,13 @@ static ret_code_t write_blockmem_processor(app_usbd_class_inst_t const * p_inst)
             if (msc_buff_data_check(p_msc))
             {
                 nrf_block_dev_t const * p_blkd = p_msc->specific.inst.pp_block_devs[p_msc_ctx->cbw.lun];
-                uint32_t blk_cnt = current_blkcnt_calc(p_msc, p_msc_ctx->current.process.size_left);
-                void * p_buff    = msc_buff_get(p_msc);
+                uint8_t  buff_cnt = MIN(msc_buff_contig_data_get(p_msc),
+                                        current_buffcnt_calc(p_msc,
+                                                             p_msc_ctx->current.process.size_left));
+                uint32_t blk_cnt  = current_blkcnt_calc(p_msc,
+                                                        p_msc_ctx->current.process.size_left,
+                                                        buff_cnt);
+                void *   p_buff   = msc_buff_get(p_msc);
                 ASSERT(p_buff != NULL);
                 NRF_BLOCK_DEV_REQUEST(
                     req,
@@ -1016,7 +1117,8 @@ static ret_code_t write_blockmem_processor(app_usbd_class_inst_t const * p_inst)
                     blk_cnt,
                     p_buff);
 
-                p_msc_ctx->current.process.pending = true;
+                p_msc_ctx->current.process.buff_cnt = buff_cnt;
+                p_msc_ctx->current.process.pending  = true;
                 ret = nrf_blk_dev_write_req(p_blkd, &req);
 
                 if (ret != NRF_SUCCESS)
@@ -1867,7 +1969,7 @@ static ret_code_t state_data_in_handle(app_usbd_class_inst_t const * p_inst, siz
     ASSERT(current_size_calc(p_msc, p_msc_ctx->current.transfer.size_left) == size);
     /* Mark the fact the transfer block has been transfered */
     state_data_in_out_process(p_msc_ctx, size);
-    msc_buff_free(p_msc);
+    msc_buff_free(p_msc, 1);
 
     ret = read_transfer_processor(p_inst);
     if(ret == NRF_SUCCESS)
@@ -1978,7 +2080,7 @@ static ret_code_t state_data_out_handle(app_usbd_class_inst_t const * p_inst, si
     }
     /* Mark the fact the transfer block has been transfered */
     state_data_in_out_process(p_msc_ctx, size);
-    msc_buff_put(p_msc);
+    msc_buff_put(p_msc, 1);
 
     ret = write_transfer_processor(p_inst);
     if(ret == NRF_SUCCESS)
@@ -2360,7 +2462,7 @@ static void msc_blockdev_read_done_handler(nrf_block_dev_t const       * p_blk_d
                   (uint32_t)p_event->p_blk_req->p_buff,
                   p_event->p_blk_req->blk_count);
 
-    msc_buff_put(p_msc);
+    msc_buff_put(p_msc, p_msc_ctx->current.process.buff_cnt);
     if (p_event->result == NRF_BLOCK_DEV_RESULT_SUCCESS)
     {
         msc_blockdev_done_process(p_blk_dev, p_event);
@@ -2398,12 +2500,13 @@ static void msc_blockdev_write_done_handler(nrf_block_dev_t const       * p_blk_
     ret_code_t ret;
     app_usbd_class_inst_t const * p_inst    = p_event->p_context;
     app_usbd_msc_t const        * p_msc     = msc_get(p_inst);
+    app_usbd_msc_ctx_t          * p_msc_ctx = msc_ctx_get(p_msc);
 
     NRF_LOG_DEBUG("write_done_handler: p_buff: %p, size: %u",
                   (uint32_t)p_event->p_blk_req->p_buff,
                   p_event->p_blk_req->blk_count);
 
-    msc_buff_free(p_msc);
+    msc_buff_free(p_msc, p_msc_ctx->current.process.buff_cnt);
     if (p_event->result == NRF_BLOCK_DEV_RESULT_SUCCESS)
     {
         msc_blockdev_done_process(p_blk_dev, p_event);
@@ -63,10 +63,19 @@ extern "C" {
  * @brief Number of block buffers
  *
  * Number of buffers used for the transfer.
- * The library is designed to work with double buffering.
- * Not tested with other configuration.
+ * At least two buffers are required, so that the block device and the USB endpoint
+ * can work on separate buffers at the same time.
+ * With two buffers each request uses one of them; requests span several buffers from four on.
  */
+#ifdef APP_USBD_MSC_CONFIG_BUFFER_CNT
+#define APP_USBD_MSC_BUFFER_CNT APP_USBD_MSC_CONFIG_BUFFER_CNT
+#else
 #define APP_USBD_MSC_BUFFER_CNT 2
+#endif
+
+#if (APP_USBD_MSC_BUFFER_CNT < 2) || (APP_USBD_MSC_BUFFER_CNT > 16)
+#error "APP_USBD_MSC_BUFFER_CNT has to be in range 2 - 16."
+#endif
 
 /**
  * @brief Create the name of the block buffer
@@ -183,6 +192,7 @@ typedef struct {
             size_t   size_left;    //!< Number of bytes left to be processed by block device
             size_t   datalen_left; //!< Number of bytes left that was requested by the host
             uint32_t blk_idx;      //!< Current block index
+            uint8_t  buff_cnt;     //!< Number of buffers used by the pending block device request
             bool     pending;      //!< The flag marking the pending transfer
             bool     abort;        //!< Something fails during transfer - abort processing and mark an error,
                                    //!< Used for write access.
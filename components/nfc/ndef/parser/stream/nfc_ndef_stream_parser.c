@@ -0,0 +1,346 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "sdk_common.h"
+#if NRF_MODULE_ENABLED(NFC_NDEF_STREAM_PARSER)
+
+#include "nfc_ndef_stream_parser.h"
+
+#define NDEF_RECORD_MB_MASK 0x80 ///< Mask of the Message Begin flag in the flags byte of an NDEF record.
+#define NDEF_RECORD_ME_MASK 0x40 ///< Mask of the Message End flag in the flags byte of an NDEF record.
+#define NDEF_RECORD_CF_MASK 0x20 ///< Mask of the Chunk Flag in the flags byte of an NDEF record.
+
+/**
+ * @brief Parser states. The header states follow the order of the fields in an NDEF record.
+ */
+typedef enum
+{
+    STATE_FLAGS,
+    STATE_TYPE_LENGTH,
+    STATE_PAYLOAD_LENGTH,
+    STATE_ID_LENGTH,
+    STATE_TYPE,
+    STATE_ID,
+    STATE_PAYLOAD,
+    STATE_DONE,
+    STATE_ERROR
+} parser_state_t;
+
+
+static nfc_ndef_stream_action_t evt_send(nfc_ndef_stream_parser_t * p_parser,
+                                         nfc_ndef_stream_evt_type_t type,
+                                         uint8_t const            * p_data,
+                                         uint32_t                   data_len)
+{
+    nfc_ndef_stream_evt_t evt =
+    {
+        .type     = type,
+        .p_header = &p_parser->header,
+        .p_data   = p_data,
+        .data_len = data_len,
+        .offset   = p_parser->payload_offset
+    };
+
+    return p_parser->evt_handler(&evt, p_parser->p_context);
+}
+
+
+/**
+ * @brief Function for finishing the current record and preparing for the next one.
+ */
+static void record_end(nfc_ndef_stream_parser_t * p_parser)
+{
+    if (p_parser->flags & NDEF_RECORD_ME_MASK)
+    {
+        p_parser->state = STATE_DONE;
+        (void) evt_send(p_parser, NFC_NDEF_STREAM_EVT_MSG_END, NULL, 0);
+        return;
+    }
+
+    p_parser->header.index++;
+    p_parser->state = STATE_FLAGS;
+}
+
+
+/**
+ * @brief Function for reporting a complete record header.
+ */
+static void header_end(nfc_ndef_stream_parser_t * p_parser)
+{
+    nfc_ndef_stream_record_header_t * p_header = &p_parser->header;
+    bool fields_fit = (p_header->type_length + p_header->id_length) <= sizeof(p_parser->fields);
+
+    p_header->p_type = (fields_fit && p_header->type_length > 0) ? p_parser->fields : NULL;
+    p_header->p_id   = (fields_fit && p_header->id_length > 0) ?
+                       &p_parser->fields[p_header->type_length] : NULL;
+
+    p_parser->payload_offset = 0;
+    p_parser->remaining      = p_header->payload_length;
+
+    switch (evt_send(p_parser, NFC_NDEF_STREAM_EVT_RECORD_HEADER, NULL, 0))
+    {
+        case NFC_NDEF_STREAM_STOP:
+            p_parser->state = STATE_DONE;
+            return;
+
+        case NFC_NDEF_STREAM_SKIP_PAYLOAD:
+            p_parser->skip_payload = true;
+            break;
+
+        default:
+            p_parser->skip_payload = false;
+            break;
+    }
+
+    if (p_parser->remaining == 0)
+    {
+        record_end(p_parser);
+    }
+    else
+    {
+        p_parser->state = STATE_PAYLOAD;
+    }
+}
+
+
+/**
+ * @brief Function for entering the state of the next variable-length header field.
+ */
+static void fields_next(nfc_ndef_stream_parser_t * p_parser)
+{
+    if (p_parser->state < STATE_TYPE && p_parser->header.type_length > 0)
+    {
+        p_parser->state     = STATE_TYPE;
+        p_parser->remaining = p_parser->header.type_length;
+    }
+    else if (p_parser->state < STATE_ID && p_parser->header.id_length > 0)
+    {
+        p_parser->state     = STATE_ID;
+        p_parser->remaining = p_parser->header.id_length;
+    }
+    else
+    {
+        header_end(p_parser);
+    }
+}
+
+
+/**
+ * @brief Function for processing one byte of a record header.
+ */
+static ret_code_t header_byte_process(nfc_ndef_stream_parser_t * p_parser, uint8_t byte)
+{
+    nfc_ndef_stream_record_header_t * p_header = &p_parser->header;
+
+    switch (p_parser->state)
+    {
+        case STATE_FLAGS:
+            // Only the first record of the message has the Message Begin flag set.
+            if (((byte & NDEF_RECORD_MB_MASK) != 0) != (p_header->index == 0))
+            {
+                return NRF_ERROR_INVALID_DATA;
+            }
+
+            p_parser->flags          = byte;
+            p_parser->field_pos      = 0;
+            p_header->location       = (nfc_ndef_record_location_t) (byte & NDEF_RECORD_LOCATION_MASK);
+            p_header->chunked        = (byte & NDEF_RECORD_CF_MASK) != 0;
+            p_header->tnf            = (nfc_ndef_record_tnf_t) (byte & NDEF_RECORD_TNF_MASK);
+            p_header->id_length      = 0;
+            p_header->payload_length = 0;
+
+            /* An NDEF parser that receives an NDEF record with an unknown or unsupported TNF field value
+               SHOULD treat it as Unknown. See NFCForum-TS-NDEF_1.0 */
+            if (p_header->tnf == TNF_RESERVED)
+            {
+                p_header->tnf = TNF_UNKNOWN_TYPE;
+            }
+
+            p_parser->state = STATE_TYPE_LENGTH;
+            break;
+
+        case STATE_TYPE_LENGTH:
+            p_header->type_length = byte;
+            p_parser->remaining   = (p_parser->flags & NDEF_RECORD_SR_MASK) ?
+                                    NDEF_RECORD_PAYLOAD_LEN_SHORT_SIZE :
+                                    NDEF_RECORD_PAYLOAD_LEN_LONG_SIZE;
+            p_parser->state       = STATE_PAYLOAD_LENGTH;
+            break;
+
+        case STATE_PAYLOAD_LENGTH:
+            p_header->payload_length = (p_header->payload_length << 8) | byte;
+
+            if (--p_parser->remaining == 0)
+            {
+                if (p_parser->flags & NDEF_RECORD_IL_MASK)
+                {
+                    p_parser->state = STATE_ID_LENGTH;
+                }
+                else
+                {
+                    fields_next(p_parser);
+                }
+            }
+            break;
+
+        case STATE_ID_LENGTH:
+            p_header->id_length = byte;
+            fields_next(p_parser);
+            break;
+
+        case STATE_TYPE:
+        case STATE_ID:
+            if (p_parser->field_pos < sizeof(p_parser->fields))
+            {
+                p_parser->fields[p_parser->field_pos] = byte;
+            }
+            p_parser->field_pos++;
+
+            if (--p_parser->remaining == 0)
+            {
+                fields_next(p_parser);
+            }
+            break;
+
+        default:
+            return NRF_ERROR_INVALID_STATE;
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+/**
+ * @brief Function for processing a part of the payload of the current record.
+ */
+static void payload_process(nfc_ndef_stream_parser_t * p_parser,
+                            uint8_t const            * p_data,
+                            uint32_t                   data_len)
+{
+    if (!p_parser->skip_payload)
+    {
+        switch (evt_send(p_parser, NFC_NDEF_STREAM_EVT_PAYLOAD, p_data, data_len))
+        {
+            case NFC_NDEF_STREAM_STOP:
+                p_parser->state = STATE_DONE;
+                return;
+
+            case NFC_NDEF_STREAM_SKIP_PAYLOAD:
+                p_parser->skip_payload = true;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    p_parser->payload_offset += data_len;
+    p_parser->remaining      -= data_len;
+
+    if (p_parser->remaining == 0)
+    {
+        record_end(p_parser);
+    }
+}
+
+
+ret_code_t nfc_ndef_stream_parser_init(nfc_ndef_stream_parser_t    * p_parser,
+                                       nfc_ndef_stream_evt_handler_t evt_handler,
+                                       void                        * p_context)
+{
+    VERIFY_PARAM_NOT_NULL(p_parser);
+    VERIFY_PARAM_NOT_NULL(evt_handler);
+
+    memset(p_parser, 0, sizeof(*p_parser));
+
+    p_parser->evt_handler = evt_handler;
+    p_parser->p_context   = p_context;
+    p_parser->state       = STATE_FLAGS;
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t nfc_ndef_stream_parser_push(nfc_ndef_stream_parser_t * p_parser,
+                                       uint8_t const            * p_data,
+                                       uint32_t                   data_len,
+                                       uint32_t                 * p_consumed)
+{
+    ret_code_t err_code = NRF_SUCCESS;
+    uint32_t   pos      = 0;
+
+    VERIFY_PARAM_NOT_NULL(p_parser);
+    VERIFY_FALSE((p_data == NULL) && (data_len > 0), NRF_ERROR_NULL);
+    VERIFY_FALSE(p_parser->state >= STATE_DONE, NRF_ERROR_INVALID_STATE);
+
+    while ((pos < data_len) && (p_parser->state < STATE_DONE))
+    {
+        if (p_parser->state == STATE_PAYLOAD)
+        {
+            uint32_t len = MIN(p_parser->remaining, data_len - pos);
+
+            payload_process(p_parser, &p_data[pos], len);
+            pos += len;
+        }
+        else
+        {
+            err_code = header_byte_process(p_parser, p_data[pos++]);
+            if (err_code != NRF_SUCCESS)
+            {
+                p_parser->state = STATE_ERROR;
+                break;
+            }
+        }
+    }
+
+    if (p_consumed != NULL)
+    {
+        *p_consumed = pos;
+    }
+
+    return err_code;
+}
+
+
+bool nfc_ndef_stream_parser_done(nfc_ndef_stream_parser_t const * p_parser)
+{
+    return p_parser->state == STATE_DONE;
+}
+
+#endif // NRF_MODULE_ENABLED(NFC_NDEF_STREAM_PARSER)
@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef NFC_NDEF_STREAM_PARSER_H__
+#define NFC_NDEF_STREAM_PARSER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdk_errors.h"
+#include "sdk_config.h"
+#include "nfc_ndef_record.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@file
+ *
+ * @defgroup nfc_ndef_stream_parser Streaming parser for NDEF messages
+ * @{
+ * @ingroup  nfc_ndef_parser
+ *
+ * @brief    Incremental parser for NFC NDEF messages.
+ *
+ * @details  The parser consumes an NDEF message in chunks of any size, for example as they
+ *           arrive from Type 4 Tag READ BINARY commands or Type 2 Tag block reads. It reports
+ *           every record header and passes the payload to the application piece by piece,
+ *           directly from the input chunks. The message never needs to be stored in RAM as a
+ *           whole, and the application can stop parsing as soon as it has found the record
+ *           it is looking for.
+ */
+
+#ifndef NFC_NDEF_STREAM_PARSER_FIELD_BUF_SIZE
+#define NFC_NDEF_STREAM_PARSER_FIELD_BUF_SIZE 64 ///< Size of the buffer for the type and ID fields of a record.
+#endif
+
+/**
+ * @brief Types of streaming parser events.
+ */
+typedef enum
+{
+    NFC_NDEF_STREAM_EVT_RECORD_HEADER, ///< Header of a record was parsed. Type and ID are available.
+    NFC_NDEF_STREAM_EVT_PAYLOAD,       ///< Part of the payload of the current record was received.
+    NFC_NDEF_STREAM_EVT_MSG_END        ///< Last record of the message was parsed.
+} nfc_ndef_stream_evt_type_t;
+
+/**
+ * @brief Actions that the event handler requests from the parser.
+ */
+typedef enum
+{
+    NFC_NDEF_STREAM_CONTINUE,          ///< Continue parsing.
+    NFC_NDEF_STREAM_SKIP_PAYLOAD,      ///< Skip the rest of the payload of the current record without further events.
+    NFC_NDEF_STREAM_STOP               ///< Stop parsing. No further data is consumed.
+} nfc_ndef_stream_action_t;
+
+/**
+ * @brief Header of an NDEF record reported by the streaming parser.
+ */
+typedef struct
+{
+    nfc_ndef_record_tnf_t      tnf;            ///< Type Name Format.
+    nfc_ndef_record_location_t location;       ///< Location of the record in the message.
+    bool                       chunked;        ///< The record is a chunk of a chunked payload (CF flag).
+    uint8_t                    type_length;    ///< Length of the type field.
+    uint8_t                    id_length;      ///< Length of the ID field.
+    uint8_t const            * p_type;         ///< Record type, or NULL if it is empty or does not fit in @ref NFC_NDEF_STREAM_PARSER_FIELD_BUF_SIZE together with the ID.
+    uint8_t const            * p_id;           ///< Record ID, or NULL if it is empty or does not fit in @ref NFC_NDEF_STREAM_PARSER_FIELD_BUF_SIZE together with the type.
+    uint32_t                   payload_length; ///< Length of the payload.
+    uint32_t                   index;          ///< Index of the record in the message.
+} nfc_ndef_stream_record_header_t;
+
+/**
+ * @brief Streaming parser event.
+ */
+typedef struct
+{
+    nfc_ndef_stream_evt_type_t              type;     ///< Type of the event.
+    nfc_ndef_stream_record_header_t const * p_header; ///< Header of the current record.
+    uint8_t const                         * p_data;   ///< Payload data (@ref NFC_NDEF_STREAM_EVT_PAYLOAD only). Points into the chunk passed to @ref nfc_ndef_stream_parser_push.
+    uint32_t                                data_len; ///< Length of the payload data.
+    uint32_t                                offset;   ///< Offset of the payload data within the record payload.
+} nfc_ndef_stream_evt_t;
+
+/**
+ * @brief Streaming parser event handler.
+ *
+ * @param[in] p_evt     Pointer to the event.
+ * @param[in] p_context Context passed to @ref nfc_ndef_stream_parser_init.
+ *
+ * @return Action to be taken by the parser. @ref NFC_NDEF_STREAM_SKIP_PAYLOAD is treated as
+ *         @ref NFC_NDEF_STREAM_CONTINUE for @ref NFC_NDEF_STREAM_EVT_MSG_END.
+ */
+typedef nfc_ndef_stream_action_t (* nfc_ndef_stream_evt_handler_t)(nfc_ndef_stream_evt_t const * p_evt,
+                                                                   void                        * p_context);
+
+/**
+ * @brief Streaming parser instance.
+ *
+ * @note The fields of this structure are used internally and must not be accessed directly.
+ */
+typedef struct
+{
+    nfc_ndef_stream_evt_handler_t   evt_handler;     ///< Event handler.
+    void                          * p_context;       ///< Context for the event handler.
+    nfc_ndef_stream_record_header_t header;          ///< Header of the current record.
+    uint32_t                        remaining;       ///< Number of bytes left in the current field.
+    uint32_t                        payload_offset;  ///< Offset of the next payload byte.
+    uint16_t                        field_pos;       ///< Number of type and ID bytes received.
+    uint8_t                         state;           ///< Current parser state.
+    uint8_t                         flags;           ///< Flags byte of the current record.
+    bool                            skip_payload;    ///< The payload of the current record is skipped.
+    uint8_t                         fields[NFC_NDEF_STREAM_PARSER_FIELD_BUF_SIZE]; ///< Storage for the type and ID fields.
+} nfc_ndef_stream_parser_t;
+
+/**
+ * @brief Function for initializing a streaming parser for a new NDEF message.
+ *
+ * @param[out] p_parser    Pointer to the parser instance.
+ * @param[in]  evt_handler Event handler.
+ * @param[in]  p_context   Context passed to the event handler.
+ *
+ * @retval NRF_SUCCESS    If the parser was initialized.
+ * @retval NRF_ERROR_NULL If a required parameter was NULL.
+ */
+ret_code_t nfc_ndef_stream_parser_init(nfc_ndef_stream_parser_t    * p_parser,
+                                       nfc_ndef_stream_evt_handler_t evt_handler,
+                                       void                        * p_context);
+
+/**
+ * @brief Function for passing the next chunk of an NDEF message to the parser.
+ *
+ * Events are reported from within this function. Parsing ends when the last record of the
+ * message has been parsed or when the event handler returns @ref NFC_NDEF_STREAM_STOP. Any
+ * data following that point is not consumed.
+ *
+ * @param[in,out] p_parser   Pointer to the parser instance.
+ * @param[in]     p_data     Pointer to the chunk.
+ * @param[in]     data_len   Length of the chunk.
+ * @param[out]    p_consumed Number of bytes of the chunk that were consumed. Can be NULL.
+ *
+ * @retval NRF_SUCCESS             If the chunk was processed.
+ * @retval NRF_ERROR_NULL          If a required parameter was NULL.
+ * @retval NRF_ERROR_INVALID_STATE If parsing has already ended or failed.
+ * @retval NRF_ERROR_INVALID_DATA  If the data is not a valid NDEF message.
+ */
+ret_code_t nfc_ndef_stream_parser_push(nfc_ndef_stream_parser_t * p_parser,
+                                       uint8_t const            * p_data,
+                                       uint32_t                   data_len,
+                                       uint32_t                 * p_consumed);
+
+/**
+ * @brief Function for checking if parsing has ended.
+ *
+ * @param[in] p_parser Pointer to the parser instance.
+ *
+ * @retval true  If the whole message was parsed or parsing was stopped by the event handler.
+ * @retval false If the parser expects more data.
+ */
+bool nfc_ndef_stream_parser_done(nfc_ndef_stream_parser_t const * p_parser);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NFC_NDEF_STREAM_PARSER_H__
@@ -324,6 +324,70 @@ ret_code_t nfc_t4t_ndef_read(nfc_t4t_capability_container_t * const p_cc_file,
 }
 
 
+#if NFC_NDEF_STREAM_PARSER_ENABLED
+ret_code_t nfc_t4t_ndef_stream_read(nfc_t4t_capability_container_t * const p_cc_file,
+                                    nfc_ndef_stream_parser_t       * const p_parser)
+{
+    ret_code_t          err_code;
+    nfc_t4t_comm_apdu_t capdu;
+    nfc_t4t_resp_apdu_t rapdu;
+    uint16_t            len;
+    uint16_t            file_offset = 0;
+    uint8_t             nlen[NDEF_FILE_NLEN_FIELD_SIZE];
+    uint8_t             apdu_buff[APDU_BUFF_SIZE];
+
+    NRF_LOG_INFO("NDEF Stream Read Procedure ");
+
+    // Read the NLEN (NDEF length) field of NDEF file.
+    nfc_t4t_comm_apdu_clear(&capdu);
+    capdu.instruction = NFC_T4T_CAPDU_READ_INS;
+    capdu.parameter   = file_offset;
+    capdu.resp_len    = NDEF_FILE_NLEN_FIELD_SIZE;
+
+    err_code = nfc_t4t_apdu_default_exchange(&capdu, &rapdu, apdu_buff);
+    VERIFY_SUCCESS(err_code);
+
+    err_code = nfc_t4t_file_chunk_save(&rapdu, nlen, sizeof(nlen), &file_offset);
+    VERIFY_SUCCESS(err_code);
+
+    len      = uint16_big_decode(nlen) + NDEF_FILE_NLEN_FIELD_SIZE;
+    err_code = nfc_t4t_file_len_update(&rapdu, &len);
+    VERIFY_SUCCESS(err_code);
+
+    if (len == 0)
+    {
+        return NRF_ERROR_NOT_FOUND;
+    }
+
+    // Pass the NDEF message to the parser chunk by chunk, straight from the APDU buffer.
+    while ((len > 0) && !nfc_ndef_stream_parser_done(p_parser))
+    {
+        capdu.parameter = file_offset;
+        capdu.resp_len  = MIN(len, MIN(p_cc_file->max_rapdu_size, MAX_ADAFRUIT_RAPDU_SIZE));
+
+        err_code = nfc_t4t_apdu_default_exchange(&capdu, &rapdu, apdu_buff);
+        VERIFY_SUCCESS(err_code);
+
+        if (rapdu.data.p_buff == NULL)
+        {
+            return NRF_ERROR_NULL;
+        }
+
+        err_code = nfc_t4t_file_len_update(&rapdu, &len);
+        VERIFY_SUCCESS(err_code);
+
+        err_code = nfc_ndef_stream_parser_push(p_parser, rapdu.data.p_buff, rapdu.data.len, NULL);
+        VERIFY_SUCCESS(err_code);
+
+        file_offset += rapdu.data.len;
+    }
+
+    NRF_LOG_RAW_INFO("\r\n");
+    return nfc_ndef_stream_parser_done(p_parser) ? NRF_SUCCESS : NRF_ERROR_INVALID_LENGTH;
+}
+#endif // NFC_NDEF_STREAM_PARSER_ENABLED
+
+
 ret_code_t nfc_t4t_ndef_update(nfc_t4t_capability_container_t * const p_cc_file,
                                uint8_t                        *       p_ndef_file_buff,
                                uint8_t                                ndef_file_buff_len)
@@ -57,6 +57,10 @@
 #include <stdint.h>
 #include "sdk_errors.h"
 #include "nfc_t4t_cc_file.h"
+#include "sdk_config.h"
+#if NFC_NDEF_STREAM_PARSER_ENABLED
+#include "nfc_ndef_stream_parser.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -151,6 +155,33 @@ ret_code_t nfc_t4t_ndef_read(nfc_t4t_capability_container_t * const p_cc_file,
                              uint8_t                        *       p_ndef_file_buff,
                              uint8_t                                ndef_file_buff_len);
 
+#if NFC_NDEF_STREAM_PARSER_ENABLED
+/**
+ * @brief Function for performing NDEF Read Procedure with streaming parsing.
+ *
+ * This function works like @ref nfc_t4t_ndef_read, but instead of storing the NDEF file
+ * it passes the data field of every R-APDU to the streaming NDEF parser as soon as it
+ * is received. Reading ends as soon as the parser is done, so the rest of the file is not
+ * read if the event handler stops parsing early.
+ *
+ * @param[in]     p_cc_file Pointer to the Capability Container descriptor.
+ * @param[in,out] p_parser  Pointer to the initialized streaming parser instance.
+ *
+ * @retval NRF_SUCCESS              If NDEF message was parsed or parsing was stopped by
+ *                                  the event handler.
+ * @retval NRF_ERROR_NOT_FOUND      If NDEF file is empty.
+ * @retval NRF_ERROR_NULL           If R-APDU did not return any data bytes.
+ * @retval NRF_ERROR_INVALID_DATA   If NLEN field is not coherent with R-APDU data length
+ *                                  or if NDEF message is not valid.
+ * @retval NRF_ERROR_INVALID_LENGTH If NDEF message ended before its last record.
+ * @retval Other                    Other error codes may be returned depending on function
+ *                                  @ref adafruit_pn532_in_data_exchange and on
+ *                                  @ref nfc_t4t_apdu module functions.
+ */
+ret_code_t nfc_t4t_ndef_stream_read(nfc_t4t_capability_container_t * const p_cc_file,
+                                    nfc_ndef_stream_parser_t       * const p_parser);
+#endif // NFC_NDEF_STREAM_PARSER_ENABLED
+
 /**
  * @brief Function for performing NDEF Update Procedure.
  *
@@ -135,6 +135,14 @@ typedef struct
 } nrf_esb_payload_rx_fifo_t;
 
 
+/* @brief First-in, first-out queue of zero-copy buffers, linked through their p_next field. */
+typedef struct
+{
+    nrf_esb_buf_t     * p_head;                           /**< Oldest buffer in the queue. */
+    nrf_esb_buf_t     * p_tail;                           /**< Newest buffer in the queue. */
+} nrf_esb_buf_queue_t;
+
+
 /**@brief Enhanced ShockBurst address.
  *
  * Enhanced ShockBurst addresses consist of a base address and a prefix
@@ -178,6 +186,22 @@ static nrf_esb_payload_rx_fifo_t    m_rx_fifo;
 static  uint8_t                     m_tx_payload_buffer[NRF_ESB_MAX_PAYLOAD_LENGTH + 2];
 static  uint8_t                     m_rx_payload_buffer[NRF_ESB_MAX_PAYLOAD_LENGTH + 2];
 
+// Packets handed to the radio: the payload buffers above, or pool buffers in zero-copy mode
+static  uint8_t                   * mp_tx_packet = m_tx_payload_buffer;
+static  uint8_t                   * mp_rx_packet = m_rx_payload_buffer;
+static  uint8_t                     m_max_payload_length = NRF_ESB_MAX_PAYLOAD_LENGTH;
+
+// Zero-copy mode
+static bool                         m_zero_copy = false;
+static nrf_esb_pool_t               m_pool;
+static nrf_esb_buf_t              * mp_current_buf;                     /**< Buffer being transmitted by the PTX. */
+static nrf_esb_buf_t              * mp_rx_buf;                          /**< Buffer the radio receives into. */
+static nrf_esb_buf_queue_t          m_tx_free;
+static nrf_esb_buf_queue_t          m_rx_free;
+static nrf_esb_buf_queue_t          m_tx_queue;
+static nrf_esb_buf_queue_t          m_rx_queue;
+static nrf_esb_buf_queue_t          m_ack_queue[NRF_ESB_PIPE_COUNT];    /**< ACK payloads of the PRX, per pipe. */
+
 // Random access buffer variables for better ACK payload handling
 nrf_esb_payload_random_access_buf_wrapper_t m_ack_pl_container[NRF_ESB_TX_FIFO_SIZE];
 nrf_esb_payload_random_access_buf_wrapper_t * m_ack_pl_container_entry_point_pr_pipe[NRF_ESB_PIPE_COUNT];
@@ -284,22 +308,25 @@ static ret_code_t apply_address_workarounds()
 
 static void update_rf_payload_format_esb_dpl(uint32_t payload_length)
 {
-#if (NRF_ESB_MAX_PAYLOAD_LENGTH <= 32)
-    // Using 6 bits for length
-    NRF_RADIO->PCNF0 = (0 << RADIO_PCNF0_S0LEN_Pos) |
-                       (6 << RADIO_PCNF0_LFLEN_Pos) |
-                       (3 << RADIO_PCNF0_S1LEN_Pos) ;
-#else
-    // Using 8 bits for length
-    NRF_RADIO->PCNF0 = (0 << RADIO_PCNF0_S0LEN_Pos) |
-                       (8 << RADIO_PCNF0_LFLEN_Pos) |
-                       (3 << RADIO_PCNF0_S1LEN_Pos) ;
-#endif
+    if (m_max_payload_length <= 32)
+    {
+        // Using 6 bits for length
+        NRF_RADIO->PCNF0 = (0 << RADIO_PCNF0_S0LEN_Pos) |
+                           (6 << RADIO_PCNF0_LFLEN_Pos) |
+                           (3 << RADIO_PCNF0_S1LEN_Pos) ;
+    }
+    else
+    {
+        // Using 8 bits for length
+        NRF_RADIO->PCNF0 = (0 << RADIO_PCNF0_S0LEN_Pos) |
+                           (8 << RADIO_PCNF0_LFLEN_Pos) |
+                           (3 << RADIO_PCNF0_S1LEN_Pos) ;
+    }
     NRF_RADIO->PCNF1 = (RADIO_PCNF1_WHITEEN_Disabled    << RADIO_PCNF1_WHITEEN_Pos) |
                        (RADIO_PCNF1_ENDIAN_Big          << RADIO_PCNF1_ENDIAN_Pos)  |
                        ((m_esb_addr.addr_length - 1)    << RADIO_PCNF1_BALEN_Pos)   |
                        (0                               << RADIO_PCNF1_STATLEN_Pos) |
-                       (NRF_ESB_MAX_PAYLOAD_LENGTH      << RADIO_PCNF1_MAXLEN_Pos);
+                       (m_max_payload_length            << RADIO_PCNF1_MAXLEN_Pos);
 }
 
 
@@ -444,6 +471,157 @@ static bool update_radio_parameters()
 }
 
 
+static void buf_queue_push(nrf_esb_buf_queue_t * p_queue, nrf_esb_buf_t * p_buf)
+{
+    p_buf->p_next = NULL;
+    if (p_queue->p_tail == NULL)
+    {
+        p_queue->p_head = p_buf;
+    }
+    else
+    {
+        p_queue->p_tail->p_next = p_buf;
+    }
+    p_queue->p_tail = p_buf;
+}
+
+
+static nrf_esb_buf_t * buf_queue_pop(nrf_esb_buf_queue_t * p_queue)
+{
+    nrf_esb_buf_t * p_buf = p_queue->p_head;
+
+    if (p_buf != NULL)
+    {
+        p_queue->p_head = p_buf->p_next;
+        if (p_queue->p_head == NULL)
+        {
+            p_queue->p_tail = NULL;
+        }
+    }
+
+    return p_buf;
+}
+
+
+static void buf_queue_move(nrf_esb_buf_queue_t * p_dst, nrf_esb_buf_queue_t * p_src)
+{
+    nrf_esb_buf_t * p_buf;
+
+    while ((p_buf = buf_queue_pop(p_src)) != NULL)
+    {
+        buf_queue_push(p_dst, p_buf);
+    }
+}
+
+
+static bool buf_queue_contains(nrf_esb_buf_queue_t const * p_queue, nrf_esb_buf_t const * p_buf)
+{
+    for (nrf_esb_buf_t const * p_iter = p_queue->p_head; p_iter != NULL; p_iter = p_iter->p_next)
+    {
+        if (p_iter == p_buf)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+/**@brief Function for checking if a buffer is held by the module (free, queued, or used by the radio).
+ *
+ * The pool is small, so all queues are walked instead of keeping a state in every buffer.
+ */
+static bool buf_is_held(nrf_esb_buf_t const * p_buf)
+{
+    if (p_buf == mp_rx_buf                        ||
+        buf_queue_contains(&m_tx_free, p_buf)     ||
+        buf_queue_contains(&m_rx_free, p_buf)     ||
+        buf_queue_contains(&m_tx_queue, p_buf)    ||
+        buf_queue_contains(&m_rx_queue, p_buf))
+    {
+        return true;
+    }
+
+    for (uint32_t i = 0; i < NRF_ESB_PIPE_COUNT; i++)
+    {
+        if (buf_queue_contains(&m_ack_queue[i], p_buf))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+/**@brief Function for returning the buffers of a TX queue to the pool.
+ *
+ * @param[in]   p_queue     Queue to flush.
+ * @param[in]   keep_head   Keep the head of the queue, because the radio may be transmitting from it.
+ *
+ * @return  Number of buffers left in the queue.
+ */
+static uint32_t tx_queue_flush(nrf_esb_buf_queue_t * p_queue, bool keep_head)
+{
+    nrf_esb_buf_t * p_head = keep_head ? buf_queue_pop(p_queue) : NULL;
+
+    buf_queue_move(&m_tx_free, p_queue);
+
+    if (p_head == NULL)
+    {
+        return 0;
+    }
+
+    buf_queue_push(p_queue, p_head);
+    return 1;
+}
+
+
+/**@brief Function for splitting a pool into free TX and RX buffers.
+ *
+ * The first buffer of the RX part is handed to the radio right away. If @p p_pool is NULL,
+ * the module returns to the default mode, in which the radio uses the internal payload buffers.
+ */
+static void pool_init(nrf_esb_pool_t const * p_pool)
+{
+    memset(&m_tx_free, 0, sizeof(m_tx_free));
+    memset(&m_rx_free, 0, sizeof(m_rx_free));
+    memset(&m_tx_queue, 0, sizeof(m_tx_queue));
+    memset(&m_rx_queue, 0, sizeof(m_rx_queue));
+    memset(m_ack_queue, 0, sizeof(m_ack_queue));
+
+    m_zero_copy          = (p_pool != NULL);
+    m_max_payload_length = NRF_ESB_MAX_PAYLOAD_LENGTH;
+    mp_tx_packet         = m_tx_payload_buffer;
+    mp_rx_packet         = m_rx_payload_buffer;
+
+    if (!m_zero_copy)
+    {
+        return;
+    }
+
+    uint8_t * p_mem    = (uint8_t *)p_pool->p_mem;
+    uint32_t  buf_size = NRF_ESB_BUF_SIZE(p_pool->max_length);
+    uint32_t  i;
+
+    m_pool = *p_pool;
+    m_max_payload_length = p_pool->max_length;
+
+    for (i = 0; i < p_pool->tx_count; i++)
+    {
+        buf_queue_push(&m_tx_free, (nrf_esb_buf_t *)&p_mem[i * buf_size]);
+    }
+    for (; i < p_pool->tx_count + p_pool->rx_count + 1; i++)
+    {
+        buf_queue_push(&m_rx_free, (nrf_esb_buf_t *)&p_mem[i * buf_size]);
+    }
+
+    mp_rx_buf    = buf_queue_pop(&m_rx_free);
+    mp_rx_packet = &mp_rx_buf->length;
+}
+
+
 static void reset_fifos()
 {
     m_tx_fifo.entry_point = 0;
@@ -480,6 +658,8 @@ static void initialize_fifos()
     {
         m_ack_pl_container_entry_point_pr_pipe[i] = 0;
     }
+
+    pool_init(NULL);
 }
 
 
@@ -487,11 +667,16 @@ uint32_t nrf_esb_skip_tx()
 {
     VERIFY_TRUE(m_esb_initialized, NRF_ERROR_INVALID_STATE);
     VERIFY_TRUE(m_tx_fifo.count > 0, NRF_ERROR_BUFFER_EMPTY);
+    VERIFY_TRUE(!m_zero_copy || m_tx_queue.p_head != NULL, NRF_ERROR_BUFFER_EMPTY);
 
     DISABLE_RF_IRQ();
 
     m_tx_fifo.count--;
-    if (++m_tx_fifo.exit_point >= NRF_ESB_TX_FIFO_SIZE)
+    if (m_zero_copy)
+    {
+        buf_queue_push(&m_tx_free, buf_queue_pop(&m_tx_queue));
+    }
+    else if (++m_tx_fifo.exit_point >= NRF_ESB_TX_FIFO_SIZE)
     {
         m_tx_fifo.exit_point = 0;
     }
@@ -501,6 +686,49 @@ uint32_t nrf_esb_skip_tx()
     return NRF_SUCCESS;
 }
 
+static bool rx_fifo_full(void)
+{
+    if (m_zero_copy)
+    {
+        return m_rx_free.p_head == NULL;
+    }
+
+    return m_rx_fifo.count >= NRF_ESB_RX_FIFO_SIZE;
+}
+
+
+/** @brief  Function to push the buffer the radio received into to the RX FIFO in zero-copy mode.
+ *
+ *  The buffer is queued by pointer and the next free RX buffer is handed to the radio.
+ *
+ *  @param  pipe Pipe number to set for the packet.
+ *  @param  pid  Packet ID.
+ *
+ *  @retval true   Operation successful.
+ *  @retval false  Operation failed.
+ */
+static bool rx_buf_push(uint8_t pipe, uint8_t pid)
+{
+    nrf_esb_buf_t * p_buf = mp_rx_buf;
+
+    if (m_rx_free.p_head == NULL || p_buf->length > m_max_payload_length)
+    {
+        return false;
+    }
+
+    p_buf->pipe  = pipe;
+    p_buf->rssi  = NRF_RADIO->RSSISAMPLE;
+    p_buf->pid   = pid;
+    p_buf->noack = !(p_buf->s1 & 0x01);
+    buf_queue_push(&m_rx_queue, p_buf);
+
+    mp_rx_buf    = buf_queue_pop(&m_rx_free);
+    mp_rx_packet = &mp_rx_buf->length;
+
+    return true;
+}
+
+
 /** @brief  Function to push the content of the rx_buffer to the RX FIFO.
  *
  *  The module will point the register NRF_RADIO->PACKETPTR to a buffer for receiving packets.
@@ -515,6 +743,11 @@ uint32_t nrf_esb_skip_tx()
  */
 static bool rx_fifo_push_rfbuf(uint8_t pipe, uint8_t pid)
 {
+    if (m_zero_copy)
+    {
+        return rx_buf_push(pipe, pid);
+    }
+
     if (m_rx_fifo.count < NRF_ESB_RX_FIFO_SIZE)
     {
         if (m_config_local.protocol == NRF_ESB_PROTOCOL_ESB_DPL)
@@ -583,67 +816,76 @@ static void ppi_init()
 
 static void start_tx_transaction()
 {
-    bool ack;
+    bool    ack;
+    uint8_t pipe;
 
     m_last_tx_attempts = 1;
-    // Prepare the payload
-    mp_current_payload = m_tx_fifo.p_payload[m_tx_fifo.exit_point];
-
 
-    switch (m_config_local.protocol)
+    if (m_zero_copy)
     {
-        case NRF_ESB_PROTOCOL_ESB:
-            update_rf_payload_format(mp_current_payload->length);
-            m_tx_payload_buffer[0] = mp_current_payload->pid;
-            m_tx_payload_buffer[1] = 0;
-            memcpy(&m_tx_payload_buffer[2], mp_current_payload->data, mp_current_payload->length);
+        // Transmit straight from the buffer at the head of the TX FIFO
+        mp_current_buf     = m_tx_queue.p_head;
+        mp_current_buf->s1 = mp_current_buf->pid << 1;
+        mp_current_buf->s1 |= mp_current_buf->noack ? 0x00 : 0x01;
+        mp_tx_packet       = &mp_current_buf->length;
+        pipe               = mp_current_buf->pipe;
+        ack                = !mp_current_buf->noack || !m_config_local.selective_auto_ack;
+    }
+    else
+    {
+        // Prepare the payload
+        mp_current_payload = m_tx_fifo.p_payload[m_tx_fifo.exit_point];
+        mp_tx_packet       = m_tx_payload_buffer;
+        pipe               = mp_current_payload->pipe;
 
-            NRF_RADIO->SHORTS   = m_radio_shorts_common | RADIO_SHORTS_DISABLED_RXEN_Msk;
-            NRF_RADIO->INTENSET = RADIO_INTENSET_DISABLED_Msk | RADIO_INTENSET_READY_Msk;
+        switch (m_config_local.protocol)
+        {
+            case NRF_ESB_PROTOCOL_ESB:
+                update_rf_payload_format(mp_current_payload->length);
+                m_tx_payload_buffer[0] = mp_current_payload->pid;
+                m_tx_payload_buffer[1] = 0;
+                memcpy(&m_tx_payload_buffer[2], mp_current_payload->data, mp_current_payload->length);
+                ack = true;
+                break;
 
-            // Configure the retransmit counter
-            m_retransmits_remaining = m_config_local.retransmit_count;
-            on_radio_disabled = on_radio_disabled_tx;
-            m_nrf_esb_mainstate = NRF_ESB_STATE_PTX_TX_ACK;
-            break;
+            case NRF_ESB_PROTOCOL_ESB_DPL:
+                ack = !mp_current_payload->noack || !m_config_local.selective_auto_ack;
+                m_tx_payload_buffer[0] = mp_current_payload->length;
+                m_tx_payload_buffer[1] = mp_current_payload->pid << 1;
+                m_tx_payload_buffer[1] |= mp_current_payload->noack ? 0x00 : 0x01;
+                memcpy(&m_tx_payload_buffer[2], mp_current_payload->data, mp_current_payload->length);
+                break;
 
-        case NRF_ESB_PROTOCOL_ESB_DPL:
-            ack = !mp_current_payload->noack || !m_config_local.selective_auto_ack;
-            m_tx_payload_buffer[0] = mp_current_payload->length;
-            m_tx_payload_buffer[1] = mp_current_payload->pid << 1;
-            m_tx_payload_buffer[1] |= mp_current_payload->noack ? 0x00 : 0x01;
-            memcpy(&m_tx_payload_buffer[2], mp_current_payload->data, mp_current_payload->length);
-
-            // Handling ack if noack is set to false or if selective auto ack is turned off
-            if (ack)
-            {
-                NRF_RADIO->SHORTS   = m_radio_shorts_common | RADIO_SHORTS_DISABLED_RXEN_Msk;
-                NRF_RADIO->INTENSET = RADIO_INTENSET_DISABLED_Msk | RADIO_INTENSET_READY_Msk;
+            default:
+                // Should not be reached
+                return;
+        }
+    }
 
-                // Configure the retransmit counter
-                m_retransmits_remaining = m_config_local.retransmit_count;
-                on_radio_disabled = on_radio_disabled_tx;
-                m_nrf_esb_mainstate = NRF_ESB_STATE_PTX_TX_ACK;
-            }
-            else
-            {
-                NRF_RADIO->SHORTS   = m_radio_shorts_common;
-                NRF_RADIO->INTENSET = RADIO_INTENSET_DISABLED_Msk;
-                on_radio_disabled   = on_radio_disabled_tx_noack;
-                m_nrf_esb_mainstate = NRF_ESB_STATE_PTX_TX;
-            }
-            break;
+    // Handling ack if noack is set to false or if selective auto ack is turned off
+    if (ack)
+    {
+        NRF_RADIO->SHORTS   = m_radio_shorts_common | RADIO_SHORTS_DISABLED_RXEN_Msk;
+        NRF_RADIO->INTENSET = RADIO_INTENSET_DISABLED_Msk | RADIO_INTENSET_READY_Msk;
 
-        default:
-            // Should not be reached
-            break;
+        // Configure the retransmit counter
+        m_retransmits_remaining = m_config_local.retransmit_count;
+        on_radio_disabled = on_radio_disabled_tx;
+        m_nrf_esb_mainstate = NRF_ESB_STATE_PTX_TX_ACK;
+    }
+    else
+    {
+        NRF_RADIO->SHORTS   = m_radio_shorts_common;
+        NRF_RADIO->INTENSET = RADIO_INTENSET_DISABLED_Msk;
+        on_radio_disabled   = on_radio_disabled_tx_noack;
+        m_nrf_esb_mainstate = NRF_ESB_STATE_PTX_TX;
     }
 
-    NRF_RADIO->TXADDRESS    = mp_current_payload->pipe;
-    NRF_RADIO->RXADDRESSES  = 1 << mp_current_payload->pipe;
+    NRF_RADIO->TXADDRESS    = pipe;
+    NRF_RADIO->RXADDRESSES  = 1 << pipe;
 
     NRF_RADIO->FREQUENCY    = m_esb_addr.rf_channel;
-    NRF_RADIO->PACKETPTR    = (uint32_t)m_tx_payload_buffer;
+    NRF_RADIO->PACKETPTR    = (uint32_t)mp_tx_packet;
 
     NVIC_ClearPendingIRQ(RADIO_IRQn);
     NVIC_EnableIRQ(RADIO_IRQn);
@@ -701,7 +943,7 @@ static void on_radio_disabled_tx()
         update_rf_payload_format(0);
     }
 
-    NRF_RADIO->PACKETPTR        = (uint32_t)m_rx_payload_buffer;
+    NRF_RADIO->PACKETPTR        = (uint32_t)mp_rx_packet;
     on_radio_disabled           = on_radio_disabled_tx_wait_for_ack;
     m_nrf_esb_mainstate         = NRF_ESB_STATE_PTX_RX_ACK;
 }
@@ -726,9 +968,9 @@ static void on_radio_disabled_tx_wait_for_ack()
 
         (void) nrf_esb_skip_tx();
 
-        if (m_config_local.protocol != NRF_ESB_PROTOCOL_ESB && m_rx_payload_buffer[0] > 0)
+        if (m_config_local.protocol != NRF_ESB_PROTOCOL_ESB && mp_rx_packet[0] > 0)
         {
-            if (rx_fifo_push_rfbuf((uint8_t)NRF_RADIO->TXADDRESS, m_rx_payload_buffer[1] >> 1))
+            if (rx_fifo_push_rfbuf((uint8_t)NRF_RADIO->TXADDRESS, mp_rx_packet[1] >> 1))
             {
                 m_interrupt_flags |= NRF_ESB_INT_RX_DATA_RECEIVED_MSK;
             }
@@ -763,8 +1005,8 @@ static void on_radio_disabled_tx_wait_for_ack()
             // There are still more retransmits left, TX mode should be
             // entered again as soon as the system timer reaches CC[1].
             NRF_RADIO->SHORTS = m_radio_shorts_common | RADIO_SHORTS_DISABLED_RXEN_Msk;
-            update_rf_payload_format(mp_current_payload->length);
-            NRF_RADIO->PACKETPTR = (uint32_t)m_tx_payload_buffer;
+            update_rf_payload_format(m_zero_copy ? mp_current_buf->length : mp_current_payload->length);
+            NRF_RADIO->PACKETPTR = (uint32_t)mp_tx_packet;
             on_radio_disabled = on_radio_disabled_tx;
             m_nrf_esb_mainstate = NRF_ESB_STATE_PTX_TX_ACK;
             NRF_ESB_SYS_TIMER->TASKS_START = 1;
@@ -781,7 +1023,7 @@ static void clear_events_restart_rx(void)
 {
     NRF_RADIO->SHORTS = m_radio_shorts_common;
     update_rf_payload_format(m_config_local.payload_length);
-    NRF_RADIO->PACKETPTR = (uint32_t)m_rx_payload_buffer;
+    NRF_RADIO->PACKETPTR = (uint32_t)mp_rx_packet;
     NRF_RADIO->EVENTS_DISABLED = 0;
     NRF_RADIO->TASKS_DISABLE = 1;
 
@@ -793,6 +1035,41 @@ static void clear_events_restart_rx(void)
     NRF_RADIO->TASKS_RXEN = 1;
 }
 
+/**@brief Function for selecting the ACK payload of the receiving pipe in zero-copy mode.
+ *
+ * The buffer at the head of the pipe queue is sent with every ACK until a new packet on the pipe
+ * shows that the PTX has received it. The buffer then goes back to the pool and the next one is
+ * sent, so the ACK payloads are streamed without being copied.
+ */
+static void ack_buf_select(pipe_info_t * p_pipe_info, bool retransmit_payload)
+{
+    nrf_esb_buf_queue_t * p_queue = &m_ack_queue[NRF_RADIO->RXMATCH];
+
+    // Do not report TX success on first ack payload or retransmit
+    if (p_queue->p_head != NULL && p_pipe_info->ack_payload && !retransmit_payload)
+    {
+        buf_queue_push(&m_tx_free, buf_queue_pop(p_queue));
+        m_tx_fifo.count--;
+
+        // ACK payloads also require TX_DS
+        m_interrupt_flags |= NRF_ESB_INT_TX_SUCCESS_MSK;
+    }
+
+    if (p_queue->p_head != NULL)
+    {
+        p_pipe_info->ack_payload = true;
+        update_rf_payload_format(p_queue->p_head->length);
+        mp_tx_packet = &p_queue->p_head->length;
+    }
+    else
+    {
+        p_pipe_info->ack_payload = false;
+        update_rf_payload_format(0);
+        m_tx_payload_buffer[0] = 0;
+    }
+}
+
+
 static void on_radio_disabled_rx(void)
 {
     bool            ack                = false;
@@ -806,25 +1083,25 @@ static void on_radio_disabled_rx(void)
         return;
     }
 
-    if (m_rx_fifo.count >= NRF_ESB_RX_FIFO_SIZE)
+    if (rx_fifo_full())
     {
         clear_events_restart_rx();
         return;
     }
 
     p_pipe_info = &m_rx_pipe_info[NRF_RADIO->RXMATCH];
-    if (NRF_RADIO->RXCRC             == p_pipe_info->crc &&
-        (m_rx_payload_buffer[1] >> 1) == p_pipe_info->pid
+    if (NRF_RADIO->RXCRC       == p_pipe_info->crc &&
+        (mp_rx_packet[1] >> 1) == p_pipe_info->pid
        )
     {
         retransmit_payload = true;
         send_rx_event = false;
     }
 
-    p_pipe_info->pid = m_rx_payload_buffer[1] >> 1;
+    p_pipe_info->pid = mp_rx_packet[1] >> 1;
     p_pipe_info->crc = NRF_RADIO->RXCRC;
 
-    if ((m_config_local.selective_auto_ack == false) || ((m_rx_payload_buffer[1] & 0x01) == 1))
+    if ((m_config_local.selective_auto_ack == false) || ((mp_rx_packet[1] & 0x01) == 1))
     {
         ack = true;
     }
@@ -832,12 +1109,17 @@ static void on_radio_disabled_rx(void)
     if (ack)
     {
         NRF_RADIO->SHORTS = m_radio_shorts_common | RADIO_SHORTS_DISABLED_RXEN_Msk;
+        mp_tx_packet = m_tx_payload_buffer;
 
         switch (m_config_local.protocol)
         {
             case NRF_ESB_PROTOCOL_ESB_DPL:
                 {
-                    if (m_tx_fifo.count > 0 && m_ack_pl_container_entry_point_pr_pipe[NRF_RADIO->RXMATCH] != 0)
+                    if (m_zero_copy)
+                    {
+                        ack_buf_select(p_pipe_info, retransmit_payload);
+                    }
+                    else if (m_tx_fifo.count > 0 && m_ack_pl_container_entry_point_pr_pipe[NRF_RADIO->RXMATCH] != 0)
                     {
                         mp_current_payload = m_ack_pl_container_entry_point_pr_pipe[NRF_RADIO->RXMATCH]->p_payload;
 
@@ -878,14 +1160,14 @@ static void on_radio_disabled_rx(void)
                         m_tx_payload_buffer[0] = 0;
                     }
 
-                    m_tx_payload_buffer[1] = m_rx_payload_buffer[1];
+                    mp_tx_packet[1] = mp_rx_packet[1];
                 }
                 break;
 
             case NRF_ESB_PROTOCOL_ESB:
                 {
                     update_rf_payload_format(0);
-                    m_tx_payload_buffer[0] = m_rx_payload_buffer[0];
+                    m_tx_payload_buffer[0] = mp_rx_packet[0];
                     m_tx_payload_buffer[1] = 0;
                 }
                 break;
@@ -893,13 +1175,9 @@ static void on_radio_disabled_rx(void)
 
         m_nrf_esb_mainstate = NRF_ESB_STATE_PRX_SEND_ACK;
         NRF_RADIO->TXADDRESS = NRF_RADIO->RXMATCH;
-        NRF_RADIO->PACKETPTR = (uint32_t)m_tx_payload_buffer;
+        NRF_RADIO->PACKETPTR = (uint32_t)mp_tx_packet;
         on_radio_disabled = on_radio_disabled_rx_ack;
     }
-    else
-    {
-        clear_events_restart_rx();
-    }
 
     if (send_rx_event)
     {
@@ -911,6 +1189,12 @@ static void on_radio_disabled_rx(void)
             NVIC_SetPendingIRQ(ESB_EVT_IRQ);
         }
     }
+
+    if (!ack)
+    {
+        // Restart only after the push, which may hand a new RX buffer to the radio
+        clear_events_restart_rx();
+    }
 }
 
 
@@ -919,7 +1203,7 @@ static void on_radio_disabled_rx_ack(void)
     NRF_RADIO->SHORTS = m_radio_shorts_common | RADIO_SHORTS_DISABLED_TXEN_Msk;
     update_rf_payload_format(m_config_local.payload_length);
 
-    NRF_RADIO->PACKETPTR = (uint32_t)m_rx_payload_buffer;
+    NRF_RADIO->PACKETPTR = (uint32_t)mp_rx_packet;
     on_radio_disabled = on_radio_disabled_rx;
 
     m_nrf_esb_mainstate = NRF_ESB_STATE_PRX;
@@ -1073,6 +1357,7 @@ uint32_t nrf_esb_disable(void)
     m_esb_initialized = false;
 
     reset_fifos();
+    pool_init(NULL);
 
     memset(m_rx_pipe_info, 0, sizeof(m_rx_pipe_info));
     memset(m_pids, 0, sizeof(m_pids));
@@ -1134,7 +1419,7 @@ static nrf_esb_payload_random_access_buf_wrapper_t *find_free_payload_cont(void)
 
 uint32_t nrf_esb_write_payload(nrf_esb_payload_t const * p_payload)
 {
-    VERIFY_TRUE(m_esb_initialized, NRF_ERROR_INVALID_STATE);
+    VERIFY_TRUE(m_esb_initialized && !m_zero_copy, NRF_ERROR_INVALID_STATE);
     VERIFY_PARAM_NOT_NULL(p_payload);
     VERIFY_PAYLOAD_LENGTH(p_payload);
     VERIFY_FALSE(m_tx_fifo.count >= NRF_ESB_TX_FIFO_SIZE, NRF_ERROR_NO_MEM);
@@ -1201,7 +1486,7 @@ uint32_t nrf_esb_write_payload(nrf_esb_payload_t const * p_payload)
 
 uint32_t nrf_esb_read_rx_payload(nrf_esb_payload_t * p_payload)
 {
-    VERIFY_TRUE(m_esb_initialized, NRF_ERROR_INVALID_STATE);
+    VERIFY_TRUE(m_esb_initialized && !m_zero_copy, NRF_ERROR_INVALID_STATE);
     VERIFY_PARAM_NOT_NULL(p_payload);
 
     if (m_rx_fifo.count == 0)
@@ -1231,6 +1516,128 @@ uint32_t nrf_esb_read_rx_payload(nrf_esb_payload_t * p_payload)
 }
 
 
+uint32_t nrf_esb_set_pool(nrf_esb_pool_t const * p_pool)
+{
+    VERIFY_TRUE(m_esb_initialized, NRF_ERROR_INVALID_STATE);
+    VERIFY_TRUE(m_nrf_esb_mainstate == NRF_ESB_STATE_IDLE, NRF_ERROR_BUSY);
+
+    if (p_pool != NULL)
+    {
+        VERIFY_TRUE(m_config_local.protocol == NRF_ESB_PROTOCOL_ESB_DPL, NRF_ERROR_NOT_SUPPORTED);
+        VERIFY_TRUE(p_pool->p_mem != NULL && p_pool->tx_count > 0 && p_pool->rx_count > 0,
+                    NRF_ERROR_INVALID_PARAM);
+        VERIFY_TRUE(p_pool->max_length > 0 && p_pool->max_length <= 252, NRF_ERROR_INVALID_PARAM);
+    }
+
+    DISABLE_RF_IRQ();
+
+    reset_fifos();
+    pool_init(p_pool);
+    memset(m_rx_pipe_info, 0, sizeof(m_rx_pipe_info));
+
+    ENABLE_RF_IRQ();
+
+    update_rf_payload_format(m_config_local.payload_length);
+
+    return NRF_SUCCESS;
+}
+
+
+uint32_t nrf_esb_alloc_buf(nrf_esb_buf_t ** pp_buf)
+{
+    VERIFY_TRUE(m_esb_initialized && m_zero_copy, NRF_ERROR_INVALID_STATE);
+    VERIFY_PARAM_NOT_NULL(pp_buf);
+
+    DISABLE_RF_IRQ();
+    *pp_buf = buf_queue_pop(&m_tx_free);
+    ENABLE_RF_IRQ();
+
+    return (*pp_buf != NULL) ? NRF_SUCCESS : NRF_ERROR_NO_MEM;
+}
+
+
+uint32_t nrf_esb_write_buf(nrf_esb_buf_t * p_buf)
+{
+    VERIFY_TRUE(m_esb_initialized && m_zero_copy, NRF_ERROR_INVALID_STATE);
+    VERIFY_PARAM_NOT_NULL(p_buf);
+    VERIFY_TRUE(p_buf->length > 0 && p_buf->length <= m_max_payload_length, NRF_ERROR_INVALID_LENGTH);
+    VERIFY_TRUE(p_buf->pipe < NRF_ESB_PIPE_COUNT, NRF_ERROR_INVALID_PARAM);
+
+    DISABLE_RF_IRQ();
+
+    m_pids[p_buf->pipe] = (m_pids[p_buf->pipe] + 1) % (NRF_ESB_PID_MAX + 1);
+    p_buf->pid = m_pids[p_buf->pipe];
+
+    if (m_config_local.mode == NRF_ESB_MODE_PTX)
+    {
+        buf_queue_push(&m_tx_queue, p_buf);
+    }
+    else
+    {
+        buf_queue_push(&m_ack_queue[p_buf->pipe], p_buf);
+    }
+    m_tx_fifo.count++;
+
+    ENABLE_RF_IRQ();
+
+    if (m_config_local.mode == NRF_ESB_MODE_PTX &&
+        m_config_local.tx_mode == NRF_ESB_TXMODE_AUTO &&
+        m_nrf_esb_mainstate == NRF_ESB_STATE_IDLE)
+    {
+        start_tx_transaction();
+    }
+
+    return NRF_SUCCESS;
+}
+
+
+uint32_t nrf_esb_read_rx_buf(nrf_esb_buf_t ** pp_buf)
+{
+    VERIFY_TRUE(m_esb_initialized && m_zero_copy, NRF_ERROR_INVALID_STATE);
+    VERIFY_PARAM_NOT_NULL(pp_buf);
+
+    DISABLE_RF_IRQ();
+    *pp_buf = buf_queue_pop(&m_rx_queue);
+    ENABLE_RF_IRQ();
+
+    return (*pp_buf != NULL) ? NRF_SUCCESS : NRF_ERROR_NOT_FOUND;
+}
+
+
+uint32_t nrf_esb_free_buf(nrf_esb_buf_t * p_buf)
+{
+    VERIFY_TRUE(m_esb_initialized && m_zero_copy, NRF_ERROR_INVALID_STATE);
+    VERIFY_PARAM_NOT_NULL(p_buf);
+
+    uint8_t const * p_mem    = (uint8_t const *)m_pool.p_mem;
+    uint32_t        buf_size = NRF_ESB_BUF_SIZE(m_pool.max_length);
+    uint32_t        offset   = (uint32_t)((uint8_t const *)p_buf - p_mem);
+
+    VERIFY_TRUE((uint8_t const *)p_buf >= p_mem && (offset % buf_size) == 0 &&
+                (offset / buf_size) < m_pool.tx_count + m_pool.rx_count + 1u,
+                NRF_ERROR_INVALID_ADDR);
+
+    DISABLE_RF_IRQ();
+    if (buf_is_held(p_buf))
+    {
+        ENABLE_RF_IRQ();
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    if ((offset / buf_size) < m_pool.tx_count)
+    {
+        buf_queue_push(&m_tx_free, p_buf);
+    }
+    else
+    {
+        buf_queue_push(&m_rx_free, p_buf);
+    }
+    ENABLE_RF_IRQ();
+
+    return NRF_SUCCESS;
+}
+
+
 uint32_t nrf_esb_start_tx(void)
 {
     VERIFY_TRUE(m_nrf_esb_mainstate == NRF_ESB_STATE_IDLE, NRF_ERROR_BUSY);
@@ -1260,7 +1667,7 @@ uint32_t nrf_esb_start_rx(void)
 
     NRF_RADIO->RXADDRESSES  = m_esb_addr.rx_pipes_enabled;
     NRF_RADIO->FREQUENCY    = m_esb_addr.rf_channel;
-    NRF_RADIO->PACKETPTR    = (uint32_t)m_rx_payload_buffer;
+    NRF_RADIO->PACKETPTR    = (uint32_t)mp_rx_packet;
 
     NVIC_ClearPendingIRQ(RADIO_IRQn);
     NVIC_EnableIRQ(RADIO_IRQn);
@@ -1305,6 +1712,24 @@ uint32_t nrf_esb_flush_tx(void)
     m_tx_fifo.entry_point = 0;
     m_tx_fifo.exit_point = 0;
 
+    if (m_zero_copy)
+    {
+        // While the radio is active, the PTX transmits from the head of the TX queue and the PRX
+        // sends the head of an ACK queue until the PTX confirms it. These buffers stay queued.
+        bool radio_active = (m_nrf_esb_mainstate != NRF_ESB_STATE_IDLE);
+
+        m_tx_fifo.count += tx_queue_flush(&m_tx_queue, radio_active);
+        for (uint32_t i = 0; i < NRF_ESB_PIPE_COUNT; i++)
+        {
+            m_tx_fifo.count += tx_queue_flush(&m_ack_queue[i],
+                                              radio_active && m_rx_pipe_info[i].ack_payload);
+            if (m_ack_queue[i].p_head == NULL)
+            {
+                m_rx_pipe_info[i].ack_payload = false;
+            }
+        }
+    }
+
     ENABLE_RF_IRQ();
 
     return NRF_SUCCESS;
@@ -1315,10 +1740,40 @@ uint32_t nrf_esb_pop_tx(void)
 {
     VERIFY_TRUE(m_esb_initialized, NRF_ERROR_INVALID_STATE);
     VERIFY_TRUE(m_tx_fifo.count > 0, NRF_ERROR_BUFFER_EMPTY);
+    VERIFY_TRUE(!m_zero_copy || m_config_local.mode == NRF_ESB_MODE_PTX, NRF_ERROR_NOT_SUPPORTED);
 
     DISABLE_RF_IRQ();
 
-    if (m_tx_fifo.entry_point == 0)
+    if (m_zero_copy)
+    {
+        nrf_esb_buf_t * p_buf = m_tx_queue.p_tail;
+
+        if (m_tx_queue.p_head == p_buf && m_nrf_esb_mainstate != NRF_ESB_STATE_IDLE)
+        {
+            // The radio is transmitting from the only queued buffer
+            ENABLE_RF_IRQ();
+            return NRF_ERROR_BUSY;
+        }
+
+        if (m_tx_queue.p_head == p_buf)
+        {
+            m_tx_queue.p_head = NULL;
+            m_tx_queue.p_tail = NULL;
+        }
+        else
+        {
+            nrf_esb_buf_t * p_prev = m_tx_queue.p_head;
+
+            while (p_prev->p_next != p_buf)
+            {
+                p_prev = p_prev->p_next;
+            }
+            p_prev->p_next    = NULL;
+            m_tx_queue.p_tail = p_prev;
+        }
+        buf_queue_push(&m_tx_free, p_buf);
+    }
+    else if (m_tx_fifo.entry_point == 0)
     {
         m_tx_fifo.entry_point = (NRF_ESB_TX_FIFO_SIZE-1);
     }
@@ -1344,6 +1799,11 @@ uint32_t nrf_esb_flush_rx(void)
     m_rx_fifo.entry_point = 0;
     m_rx_fifo.exit_point = 0;
 
+    if (m_zero_copy)
+    {
+        buf_queue_move(&m_rx_free, &m_rx_queue);
+    }
+
     memset(m_rx_pipe_info, 0, sizeof(m_rx_pipe_info));
 
     ENABLE_RF_IRQ();
@@ -90,8 +90,13 @@ extern "C" {
 #define     NRF_ESB_MAX_PAYLOAD_LENGTH          32                  //!< The maximum size of the payload. Valid values are 1 to 252.
 #endif
 
+#ifndef NRF_ESB_TX_FIFO_SIZE
 #define     NRF_ESB_TX_FIFO_SIZE                8                   //!< The size of the transmission first-in, first-out buffer.
+#endif
+
+#ifndef NRF_ESB_RX_FIFO_SIZE
 #define     NRF_ESB_RX_FIFO_SIZE                8                   //!< The size of the reception first-in, first-out buffer.
+#endif
 
 // 252 is the largest possible payload size according to the nRF5 architecture.
 STATIC_ASSERT(NRF_ESB_MAX_PAYLOAD_LENGTH <= 252);
@@ -307,6 +312,69 @@ typedef struct
 } nrf_esb_payload_t;
 
 
+/**@brief Enhanced ShockBurst packet buffer used in zero-copy mode.
+ *
+ * @details The radio transmits from and receives into @p length, @p s1, and @p data directly,
+ *          so a buffer is never copied between the application and the radio. Buffers are taken
+ *          from the pool set with @ref nrf_esb_set_pool, and the ownership of a buffer is handed
+ *          over by pointer.
+ */
+typedef struct nrf_esb_buf_s
+{
+    struct nrf_esb_buf_s * p_next;                  //!< Used internally to link queued buffers.
+    uint8_t pipe;                                   //!< Pipe used for this payload.
+    int8_t  rssi;                                   //!< RSSI for the received packet.
+    uint8_t noack;                                  //!< Flag indicating that this packet will not be acknowledged. Flag is ignored when selective auto ack is enabled.
+    uint8_t pid;                                    //!< PID assigned during communication.
+    uint8_t length;                                 //!< Length of the packet (maximum value is the max_length of the pool). First byte of the radio packet.
+    uint8_t s1;                                     //!< PID and acknowledgment flag as sent on air. Set by the module.
+    uint8_t data[];                                 //!< The payload data.
+} nrf_esb_buf_t;
+
+
+/**@brief Size of one pool buffer for a given maximum payload length. */
+#define NRF_ESB_BUF_SIZE(_max_length)   ALIGN_NUM(sizeof(uint32_t), sizeof(nrf_esb_buf_t) + (_max_length))
+
+
+/**@brief Size of the pool memory, in bytes.
+ *
+ * @details One buffer more than @p _rx_count is needed, because the radio always owns the buffer
+ *          that it is currently receiving into.
+ */
+#define NRF_ESB_POOL_MEM_SIZE(_tx_count, _rx_count, _max_length) \
+        (((_tx_count) + (_rx_count) + 1) * NRF_ESB_BUF_SIZE(_max_length))
+
+
+/**@brief Enhanced ShockBurst buffer pool for the zero-copy mode. */
+typedef struct
+{
+    uint32_t  * p_mem;                              //!< Pool memory of @ref NRF_ESB_POOL_MEM_SIZE bytes. Must be placed in Data RAM.
+    uint16_t    tx_count;                           //!< Number of TX buffers. This is the depth of the TX FIFO.
+    uint16_t    rx_count;                           //!< Number of RX buffers that can wait to be read. This is the depth of the RX FIFO.
+    uint8_t     max_length;                         //!< Maximum payload length (1 to 252).
+} nrf_esb_pool_t;
+
+
+/**@brief Macro for defining a buffer pool for the zero-copy mode.
+ *
+ * @param[in]   _name           Name of the pool.
+ * @param[in]   _tx_count       Depth of the TX FIFO.
+ * @param[in]   _rx_count       Depth of the RX FIFO.
+ * @param[in]   _max_length     Maximum payload length (1 to 252).
+ */
+#define NRF_ESB_POOL_DEF(_name, _tx_count, _rx_count, _max_length)                              \
+    STATIC_ASSERT((_max_length) > 0 && (_max_length) <= 252);                                   \
+    static uint32_t CONCAT_2(_name, _mem)                                                       \
+        [NRF_ESB_POOL_MEM_SIZE(_tx_count, _rx_count, _max_length) / sizeof(uint32_t)];          \
+    static const nrf_esb_pool_t _name =                                                         \
+    {                                                                                           \
+        .p_mem      = CONCAT_2(_name, _mem),                                                    \
+        .tx_count   = (_tx_count),                                                              \
+        .rx_count   = (_rx_count),                                                              \
+        .max_length = (_max_length)                                                             \
+    }
+
+
 /**@brief Enhanced ShockBurst event. */
 typedef struct
 {
@@ -397,7 +465,7 @@ bool nrf_esb_is_idle(void);
  *
  * @retval  NRF_SUCCESS                     If the payload was successfully queued for writing.
  * @retval  NRF_ERROR_NULL                  If the required parameter was NULL.
- * @retval  NRF_INVALID_STATE               If the module is not initialized.
+ * @retval  NRF_INVALID_STATE               If the module is not initialized or is in zero-copy mode.
  * @retval  NRF_ERROR_NO_MEM                If the TX FIFO is full.
  * @retval  NRF_ERROR_INVALID_LENGTH        If the payload length was invalid (zero or larger than the allowed maximum).
  */
@@ -410,11 +478,96 @@ uint32_t nrf_esb_write_payload(nrf_esb_payload_t const * p_payload);
  *
  * @retval  NRF_SUCCESS                     If the data was read successfully.
  * @retval  NRF_ERROR_NULL                  If the required parameter was NULL.
- * @retval  NRF_INVALID_STATE               If the module is not initialized.
+ * @retval  NRF_INVALID_STATE               If the module is not initialized or is in zero-copy mode.
  */
 uint32_t nrf_esb_read_rx_payload(nrf_esb_payload_t * p_payload);
 
 
+/**@brief Function for switching the module to or from the zero-copy mode.
+ *
+ * In zero-copy mode, the TX and RX FIFOs hold pointers to buffers from @p p_pool, and the radio
+ * transmits from and receives into these buffers directly. The maximum payload length and the
+ * depth of both FIFOs are taken from @p p_pool instead of @ref NRF_ESB_MAX_PAYLOAD_LENGTH,
+ * @ref NRF_ESB_TX_FIFO_SIZE, and @ref NRF_ESB_RX_FIFO_SIZE. A maximum payload length larger than
+ * 32 uses an 8-bit length field on air, so both sides must use the same setting.
+ *
+ * Use @ref nrf_esb_alloc_buf and @ref nrf_esb_write_buf to transmit, and @ref nrf_esb_read_rx_buf
+ * and @ref nrf_esb_free_buf to receive. The zero-copy mode is left when @ref nrf_esb_init or
+ * @ref nrf_esb_disable is called; buffers held by the application must not be used after that.
+ *
+ * @param[in]   p_pool          Pointer to the buffer pool, or NULL to return to the default mode.
+ *                              The pool memory must stay valid until the mode is left.
+ *
+ * @retval  NRF_SUCCESS                     If the mode was changed successfully.
+ * @retval  NRF_INVALID_STATE               If the module is not initialized.
+ * @retval  NRF_ERROR_BUSY                  If the function failed because the radio is busy.
+ * @retval  NRF_ERROR_NOT_SUPPORTED         If the protocol is not @ref NRF_ESB_PROTOCOL_ESB_DPL.
+ * @retval  NRF_ERROR_INVALID_PARAM         If the pool configuration is invalid.
+ */
+uint32_t nrf_esb_set_pool(nrf_esb_pool_t const * p_pool);
+
+
+/**@brief Function for taking a free TX buffer from the pool.
+ *
+ * The application fills in @c length, @c pipe, @c noack, and @c data, and then passes the
+ * buffer to @ref nrf_esb_write_buf or returns it with @ref nrf_esb_free_buf.
+ *
+ * @param[out]  pp_buf          Pointer to the buffer.
+ *
+ * @retval  NRF_SUCCESS                     If a buffer was allocated.
+ * @retval  NRF_ERROR_NULL                  If the required parameter was NULL.
+ * @retval  NRF_INVALID_STATE               If the module is not in zero-copy mode.
+ * @retval  NRF_ERROR_NO_MEM                If all TX buffers are in use.
+ */
+uint32_t nrf_esb_alloc_buf(nrf_esb_buf_t ** pp_buf);
+
+
+/**@brief Function for queuing a buffer for transmission or acknowledgement.
+ *
+ * This function is the zero-copy counterpart of @ref nrf_esb_write_payload. The ownership of
+ * the buffer passes to the module, which returns it to the pool when the payload has been sent
+ * and acknowledged, or when it is removed from the TX FIFO.
+ *
+ * @param[in]   p_buf           Buffer taken with @ref nrf_esb_alloc_buf.
+ *
+ * @retval  NRF_SUCCESS                     If the buffer was successfully queued.
+ * @retval  NRF_ERROR_NULL                  If the required parameter was NULL.
+ * @retval  NRF_INVALID_STATE               If the module is not in zero-copy mode.
+ * @retval  NRF_ERROR_INVALID_PARAM         If the pipe number was invalid.
+ * @retval  NRF_ERROR_INVALID_LENGTH        If the payload length was invalid (zero or larger than the maximum of the pool).
+ */
+uint32_t nrf_esb_write_buf(nrf_esb_buf_t * p_buf);
+
+
+/**@brief Function for taking the oldest received buffer from the RX FIFO.
+ *
+ * The ownership of the buffer passes to the application, which must return it with
+ * @ref nrf_esb_free_buf. While all RX buffers are held by the application, received packets
+ * are dropped without acknowledgement.
+ *
+ * @param[out]  pp_buf          Pointer to the received buffer.
+ *
+ * @retval  NRF_SUCCESS                     If a buffer was read.
+ * @retval  NRF_ERROR_NULL                  If the required parameter was NULL.
+ * @retval  NRF_INVALID_STATE               If the module is not in zero-copy mode.
+ * @retval  NRF_ERROR_NOT_FOUND             If the RX FIFO is empty.
+ */
+uint32_t nrf_esb_read_rx_buf(nrf_esb_buf_t ** pp_buf);
+
+
+/**@brief Function for returning a buffer to the pool.
+ *
+ * @param[in]   p_buf           Buffer taken with @ref nrf_esb_alloc_buf or @ref nrf_esb_read_rx_buf.
+ *
+ * @retval  NRF_SUCCESS                     If the buffer was returned.
+ * @retval  NRF_ERROR_NULL                  If the required parameter was NULL.
+ * @retval  NRF_INVALID_STATE               If the module is not in zero-copy mode, or if the buffer is
+ *                                          already free or still queued.
+ * @retval  NRF_ERROR_INVALID_ADDR          If the buffer does not belong to the pool.
+ */
+uint32_t nrf_esb_free_buf(nrf_esb_buf_t * p_buf);
+
+
 /**@brief Function for starting transmission.
  *
  * @retval  NRF_SUCCESS                     If the TX started successfully.
@@ -442,7 +595,8 @@ uint32_t nrf_esb_stop_rx(void);
 
 /**@brief Function for removing remaining items from the TX buffer.
  *
- * This function clears the TX FIFO buffer.
+ * This function clears the TX FIFO buffer. In zero-copy mode, a buffer that the radio may still
+ * be transmitting from stays in the FIFO until its transmission ends.
  *
  * @retval  NRF_SUCCESS                     If pending items in the TX buffer were successfully cleared.
  * @retval  NRF_INVALID_STATE               If the module is not initialized.
@@ -457,6 +611,8 @@ uint32_t nrf_esb_flush_tx(void);
  * @retval  NRF_SUCCESS                     If the operation completed successfully.
  * @retval  NRF_INVALID_STATE               If the module is not initialized.
  * @retval  NRF_ERROR_BUFFER_EMPTY          If there are no items in the queue to remove.
+ * @retval  NRF_ERROR_BUSY                  If the radio is transmitting from the only entry in zero-copy mode.
+ * @retval  NRF_ERROR_NOT_SUPPORTED         If the module is a PRX in zero-copy mode.
  */
 uint32_t nrf_esb_pop_tx(void);
 
@@ -122,6 +122,32 @@ static uint8_t m_rx_buf[1];
 static bool m_rx_escape;
 
 
+// The function starts sending of the currently filled TX buffer. It returns
+// false to signal that no more bytes can be passed to be sent (put into the TX
+// buffer) until UART transmission is done.
+static bool tx_buf_flush(ser_phy_hci_slip_evt_type_t slip_evt_type)
+{
+    // If some TX transfer is being done at the moment, a new one cannot be
+    // started, it must be scheduled to be performed later.
+    if (m_tx_in_progress)
+    {
+        m_tx_pending_evt_type = slip_evt_type;
+        m_tx_pending = true;
+        // No more buffers available, can't continue filling.
+        return false;
+    }
+
+    m_tx_in_progress = true;
+    m_tx_evt_type = slip_evt_type;
+    APP_ERROR_CHECK(nrf_drv_uart_tx(&m_uart, mp_tx_buf, m_tx_bytes));
+
+    // Switch to the second buffer.
+    mp_tx_buf = (mp_tx_buf == m_tx_buf0) ? m_tx_buf1 : m_tx_buf0;
+    m_tx_bytes = 0;
+
+    return true;
+}
+
 // The function returns false to signal that no more bytes can be passed to be
 // sent (put into the TX buffer) until UART transmission is done.
 static bool tx_buf_put(uint8_t data_byte)
@@ -131,46 +157,59 @@ static bool tx_buf_put(uint8_t data_byte)
     mp_tx_buf[m_tx_bytes] = data_byte;
     ++m_tx_bytes;
 
-    bool flush = false;
-    ser_phy_hci_slip_evt_type_t slip_evt_type = NO_EVENT;
     if (m_tx_phase == PHASE_ACK_END)
     {
         // Send buffer, then signal that an acknowledge packet has been sent.
-        flush = true;
-        slip_evt_type = SER_PHY_HCI_SLIP_EVT_ACK_SENT;
+        return tx_buf_flush(SER_PHY_HCI_SLIP_EVT_ACK_SENT);
     }
     else if (m_tx_phase == PHASE_PACKET_END)
     {
         // Send buffer, then signal that a packet with payload has been sent.
-        flush = true;
-        slip_evt_type = SER_PHY_HCI_SLIP_EVT_PKT_SENT;
+        return tx_buf_flush(SER_PHY_HCI_SLIP_EVT_PKT_SENT);
     }
     else if (m_tx_bytes >= SER_PHY_HCI_SLIP_TX_BUF_SIZE)
     {
         // Send buffer (because it is filled up), but don't signal anything,
         // since the packet sending is not complete yet.
-        flush = true;
+        return tx_buf_flush(NO_EVENT);
     }
 
-    if (flush)
+    return true;
+}
+
+// The function copies a run of bytes that do not need SLIP escaping directly
+// from the packet into the TX buffer, so that the escaping pass does not have
+// to handle the packet byte by byte. Copying stops at the first byte that must
+// be escaped or when the TX buffer is full. The number of copied bytes is
+// returned through p_copied. The return value has the same meaning as for
+// 'tx_buf_put()'.
+static bool tx_buf_run_put(uint8_t const * p_data, uint32_t length, uint32_t * p_copied)
+{
+    uint32_t space = SER_PHY_HCI_SLIP_TX_BUF_SIZE - m_tx_bytes;
+    uint32_t run   = 0;
+
+    ASSERT(m_tx_bytes < SER_PHY_HCI_SLIP_TX_BUF_SIZE);
+
+    if (length > space)
     {
-        // If some TX transfer is being done at the moment, a new one cannot be
-        // started, it must be scheduled to be performed later.
-        if (m_tx_in_progress)
-        {
-            m_tx_pending_evt_type = slip_evt_type;
-            m_tx_pending = true;
-            // No more buffers available, can't continue filling.
-            return false;
-        }
+        length = space;
+    }
+    while ((run < length) &&
+           (p_data[run] != APP_SLIP_END) &&
+           (p_data[run] != APP_SLIP_ESC))
+    {
+        ++run;
+    }
 
-        m_tx_in_progress = true;
-        m_tx_evt_type = slip_evt_type;
-        APP_ERROR_CHECK(nrf_drv_uart_tx(&m_uart, mp_tx_buf, m_tx_bytes));
+    memcpy(&mp_tx_buf[m_tx_bytes], p_data, run);
+    m_tx_bytes += run;
+    *p_copied   = run;
 
-        // Switch to the second buffer.
-        mp_tx_buf = (mp_tx_buf == m_tx_buf0) ? m_tx_buf1 : m_tx_buf0;
-        m_tx_bytes = 0;
+    if (m_tx_bytes >= SER_PHY_HCI_SLIP_TX_BUF_SIZE)
+    {
+        // Send buffer (because it is filled up), but don't signal anything,
+        // since the packet sending is not complete yet.
+        return tx_buf_flush(NO_EVENT);
     }
 
     return true;
@@ -238,18 +277,25 @@ static void tx_buf_fill(void)
                 ASSERT(mp_tx_data->p_buffer != NULL);
                 uint8_t data = mp_tx_data->p_buffer[m_tx_index];
 
+                if ((data != APP_SLIP_END) && (data != APP_SLIP_ESC))
+                {
+                    // Plain data, copy as much of it as possible at once.
+                    uint32_t copied;
+                    can_continue = tx_buf_run_put(&mp_tx_data->p_buffer[m_tx_index],
+                                                  mp_tx_data->num_of_bytes - m_tx_index,
+                                                  &copied);
+                    m_tx_index += copied;
+                    break;
+                }
+
                 if (data == APP_SLIP_END)
                 {
                     data = APP_SLIP_ESC;
                     tx_escaped_data = APP_SLIP_ESC_END;
                 }
-                else if (data == APP_SLIP_ESC)
-                {
-                    tx_escaped_data = APP_SLIP_ESC_ESC;
-                }
                 else
                 {
-                    ++m_tx_index;
+                    tx_escaped_data = APP_SLIP_ESC_ESC;
                 }
                 can_continue = tx_buf_put(data);
             }
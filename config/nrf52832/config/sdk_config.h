@@ -1156,6 +1156,24 @@
 #define BLE_ADVERTISING_ENABLED 0
 #endif
 
+// <e> BLE_DB_DISCOVERY_CACHE_ENABLED - ble_db_discovery - Store discovered services of bonded peers
+
+// <i> The services are stored as Peer Manager application data (PM_PEER_DATA_ID_APPLICATION).
+// <i> The application must not use that data ID when this option is enabled.
+// <i> Peer Manager events must be passed to ble_db_discovery_on_pm_evt().
+//==========================================================
+#ifndef BLE_DB_DISCOVERY_CACHE_ENABLED
+#define BLE_DB_DISCOVERY_CACHE_ENABLED 0
+#endif
+// <q> BLE_DB_DISCOVERY_CACHE_VERIFY  - Verify stored services using the Database Hash of the peer
+ 
+
+#ifndef BLE_DB_DISCOVERY_CACHE_VERIFY
+#define BLE_DB_DISCOVERY_CACHE_VERIFY 1
+#endif
+
+// </e>
+
 // <q> BLE_DTM_ENABLED  - ble_dtm - Module for testing RF/PHY using DTM commands
  
 
@@ -1587,6 +1605,29 @@
 #define BLE_TPS_ENABLED 0
 #endif
 
+// <h> NRF_BLE_CGMS_DB - Continuous Glucose Monitoring Service record database
+
+//==========================================================
+// <o> NRF_BLE_CGMS_DB_FLASH_PAGES - Number of flash pages used to store records.  <2-192> 
+
+
+// <i> Each 4 kB page holds 340 records. The pages are placed directly below the bootloader,
+// <i> reserve them with FDS_VIRTUAL_PAGES_RESERVED. 61 pages hold 14 days of 1-minute readings.
+
+#ifndef NRF_BLE_CGMS_DB_FLASH_PAGES
+#define NRF_BLE_CGMS_DB_FLASH_PAGES 4
+#endif
+
+// <o> NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE - Number of records waiting to be written to flash.  <1-32> 
+
+
+#ifndef NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE
+#define NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE 4
+#endif
+
+// </h> 
+//==========================================================
+
 // </h> 
 //==========================================================
 
@@ -2201,6 +2242,60 @@
 
 // </e>
 
+// <e> NRF_CRYPTO_BACKEND_NRF_HW_AES_ENABLED - Enable the nRF HW AES backend.
+
+// <i> The nRF HW backend provides AES-128 using the ECB and CCM peripherals in nRF5x devices. The SoftDevice ECB API is used while the SoftDevice is enabled.
+//==========================================================
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_ENABLED 0
+#endif
+// <q> NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR_ENABLED  - nRF HW AES CTR mode support.
+ 
+
+// <i> Enable nRF HW AES CTR mode support. Only 128-bit keys are supported.
+
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB_ENABLED  - nRF HW AES ECB mode support.
+ 
+
+// <i> Enable nRF HW AES ECB mode support. Only 128-bit keys are supported. Decryption is done in software.
+
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC_ENABLED  - nRF HW AES CBC MAC mode support.
+ 
+
+// <i> Enable nRF HW AES CBC MAC mode support. Only 128-bit keys are supported.
+
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_ENABLED  - nRF HW AES CCM mode support.
+ 
+
+// <i> Enable nRF HW AES CCM mode support. Only 128-bit keys are supported.
+
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_PERIPHERAL_ENABLED  - Use the CCM peripheral for AES CCM.
+ 
+
+// <i> Messages with a 13-byte nonce, a 4-byte MAC, one byte of additional data and up to 251 bytes of payload are processed by the CCM peripheral when the SoftDevice is not enabled. Uses about 800 bytes of RAM.
+
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_PERIPHERAL_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_PERIPHERAL_ENABLED 1
+#endif
+
+// </e>
+
 // <e> NRF_CRYPTO_BACKEND_NRF_SW_ENABLED - Enable the legacy nRFx sw for crypto.
 
 // <i> The nRF SW cryptography backend (only used in bootloader context).
@@ -7009,6 +7104,28 @@
 #define APP_SCHEDULER_WITH_PROFILER 0
 #endif
 
+// <e> APP_SCHEDULER_WITH_LANES - Enabling priority lanes
+// <i> Events are put into one of several lanes which are served strictly by priority
+// <i> (lane 0 first). Putting events is lock-free. Requires nrf_atfifo.
+//==========================================================
+#ifndef APP_SCHEDULER_WITH_LANES
+#define APP_SCHEDULER_WITH_LANES 0
+#endif
+// <o> APP_SCHEDULER_LANES_COUNT - Number of priority lanes  <1-8> 
+
+#ifndef APP_SCHEDULER_LANES_COUNT
+#define APP_SCHEDULER_LANES_COUNT 3
+#endif
+
+// <o> APP_SCHEDULER_DEFAULT_LANE - Lane used by app_sched_event_put  <0-7> 
+// <i> Must be lower than APP_SCHEDULER_LANES_COUNT.
+
+#ifndef APP_SCHEDULER_DEFAULT_LANE
+#define APP_SCHEDULER_DEFAULT_LANE 2
+#endif
+
+// </e>
+
 // </e>
 
 // <e> APP_SDCARD_ENABLED - app_sdcard - SD/MMC card support using SPI
@@ -7129,6 +7246,30 @@
 #define APP_TIMER_SAFE_WINDOW_MS 300000
 #endif
 
+// <e> APP_TIMER_CONFIG_USE_TIMING_WHEEL - Keep active timers on hierarchical timing wheel 
+// <i> Timers are kept on timing wheel instead of sorted list. Starting and stopping
+// <i> timer takes constant time regardless of number of active timers.
+//==========================================================
+#ifndef APP_TIMER_CONFIG_USE_TIMING_WHEEL
+#define APP_TIMER_CONFIG_USE_TIMING_WHEEL 0
+#endif
+// <o> APP_TIMER_CONFIG_WHEEL_SLOT_BITS - Number of timestamp bits resolved by one wheel level  <1-5> 
+// <i> Each level has 2^APP_TIMER_CONFIG_WHEEL_SLOT_BITS slots.
+
+#ifndef APP_TIMER_CONFIG_WHEEL_SLOT_BITS
+#define APP_TIMER_CONFIG_WHEEL_SLOT_BITS 4
+#endif
+
+// <o> APP_TIMER_CONFIG_WHEEL_LEVELS - Number of wheel levels 
+// <i> Timers longer than 2^(APP_TIMER_CONFIG_WHEEL_SLOT_BITS * APP_TIMER_CONFIG_WHEEL_LEVELS)
+// <i> ticks are kept on separate list and put on the wheel when they get closer.
+
+#ifndef APP_TIMER_CONFIG_WHEEL_LEVELS
+#define APP_TIMER_CONFIG_WHEEL_LEVELS 6
+#endif
+
+// </e>
+
 // <h> App Timer Legacy configuration - Legacy configuration.
 
 //==========================================================
@@ -7478,12 +7619,25 @@
 #define APP_USBD_HID_MOUSE_ENABLED 0
 #endif
 
-// <q> APP_USBD_MSC_ENABLED  - app_usbd_msc - USB MSC class
- 
-
+// <e> APP_USBD_MSC_ENABLED - app_usbd_msc - USB MSC class
+//==========================================================
 #ifndef APP_USBD_MSC_ENABLED
 #define APP_USBD_MSC_ENABLED 0
 #endif
+// <o> APP_USBD_MSC_CONFIG_BUFFER_CNT - Number of work buffers.  <2-16> 
+
+
+// <i> Each buffer has the size given to APP_USBD_MSC_GLOBAL_DEF.
+// <i> Block device requests never use more than half of the buffers,
+// <i> so the rest can be transferred over USB at the same time.
+// <i> With the default of 2, each request uses a single buffer.
+// <i> Set 4 or more to pipeline multi-buffer requests.
+
+#ifndef APP_USBD_MSC_CONFIG_BUFFER_CNT
+#define APP_USBD_MSC_CONFIG_BUFFER_CNT 2
+#endif
+
+// </e>
 
 // <q> CRC16_ENABLED  - crc16 - CRC16 calculation routines
  
@@ -7954,6 +8108,17 @@
 
 // </e>
 
+// <q> NRF_BALLOC_CONFIG_LOCK_FREE  - Use a lock-free free list instead of critical sections.
+ 
+
+// <i> Allocation and freeing do not disable interrupts. Used only when
+// <i> NRF_BALLOC_CONFIG_DEBUG_ENABLED is disabled, because the debug checks need a
+// <i> consistent view of the free list.
+
+#ifndef NRF_BALLOC_CONFIG_LOCK_FREE
+#define NRF_BALLOC_CONFIG_LOCK_FREE 1
+#endif
+
 // </e>
 
 // <e> NRF_CSENSE_ENABLED - nrf_csense - Capacitive sensor module
@@ -8087,12 +8252,63 @@
 
 // </e>
 
-// <q> NRF_GFX_ENABLED  - nrf_gfx - GFX module
- 
-
+// <e> NRF_GFX_ENABLED - nrf_gfx - GFX module
+//==========================================================
 #ifndef NRF_GFX_ENABLED
 #define NRF_GFX_ENABLED 0
 #endif
+// <o> NRF_GFX_LINE_BUFFER_SIZE - Size of the text line buffer (in pixels). 
+// <i> Used by nrf_gfx_print_bg() to render text into RGB565 bands
+// <i> that are sent to the LCD with a single bitmap transfer.
+
+#ifndef NRF_GFX_LINE_BUFFER_SIZE
+#define NRF_GFX_LINE_BUFFER_SIZE 320
+#endif
+
+// </e>
+
+// <e> NRF_LCD_FB_ENABLED - nrf_lcd_fb - Frame buffer with partial refresh for nrf_gfx
+//==========================================================
+#ifndef NRF_LCD_FB_ENABLED
+#define NRF_LCD_FB_ENABLED 0
+#endif
+// <o> NRF_LCD_FB_WIDTH - Width of the frame buffer (in pixels). 
+// <i> Must match the width of the panel in its default rotation.
+
+#ifndef NRF_LCD_FB_WIDTH
+#define NRF_LCD_FB_WIDTH 128
+#endif
+
+// <o> NRF_LCD_FB_HEIGHT - Height of the frame buffer (in pixels). 
+// <i> Must match the height of the panel in its default rotation.
+
+#ifndef NRF_LCD_FB_HEIGHT
+#define NRF_LCD_FB_HEIGHT 160
+#endif
+
+// <o> NRF_LCD_FB_BPP  - Pixel format
+ 
+// <4=> 4-bit palette 
+// <8=> 8-bit palette 
+// <16=> RGB565 
+
+#ifndef NRF_LCD_FB_BPP
+#define NRF_LCD_FB_BPP 16
+#endif
+
+// <o> NRF_LCD_FB_TILE_SIZE - Size of the square tile in which changes are tracked (in pixels). 
+#ifndef NRF_LCD_FB_TILE_SIZE
+#define NRF_LCD_FB_TILE_SIZE 16
+#endif
+
+// <o> NRF_LCD_FB_FLUSH_BUFFER_SIZE - Size of the buffer used to send changed areas to the panel (in pixels). 
+// <i> Must be at least the larger of the frame buffer width and height.
+
+#ifndef NRF_LCD_FB_FLUSH_BUFFER_SIZE
+#define NRF_LCD_FB_FLUSH_BUFFER_SIZE 320
+#endif
+
+// </e>
 
 // <q> NRF_MEMOBJ_ENABLED  - nrf_memobj - Linked memory allocator module
  
@@ -8572,6 +8788,17 @@
 #define NRF_LOG_DEFERRED 1
 #endif
 
+// <q> NRF_LOG_DICTIONARY_MODE  - Enable dictionary (binary) logging.
+ 
+
+// <i> Backends send raw entries (module ID, format string address, arguments,
+// <i> timestamp) instead of formatted text. Format strings are kept in the
+// <i> non-loaded log_strings section of the ELF file and are decoded on the host.
+
+#ifndef NRF_LOG_DICTIONARY_MODE
+#define NRF_LOG_DICTIONARY_MODE 0
+#endif
+
 // <q> NRF_LOG_FILTERS_ENABLED  - Enable dynamic filtering of logs.
  
 
@@ -10455,6 +10682,69 @@
 
 // </e>
 
+// <e> NRF_BLOCK_DEV_CACHE_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRF_BLOCK_DEV_CACHE_CONFIG_LOG_ENABLED
+#define NRF_BLOCK_DEV_CACHE_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRF_BLOCK_DEV_CACHE_CONFIG_LOG_LEVEL  - Default Severity level
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRF_BLOCK_DEV_CACHE_CONFIG_LOG_LEVEL
+#define NRF_BLOCK_DEV_CACHE_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRF_BLOCK_DEV_CACHE_CONFIG_LOG_INIT_FILTER_LEVEL  - Initial severity level if dynamic filtering is enabled
+ 
+// <0=> Off 
+// <1=> Error 
+// <2=> Warning 
+// <3=> Info 
+// <4=> Debug 
+
+#ifndef NRF_BLOCK_DEV_CACHE_CONFIG_LOG_INIT_FILTER_LEVEL
+#define NRF_BLOCK_DEV_CACHE_CONFIG_LOG_INIT_FILTER_LEVEL 3
+#endif
+
+// <o> NRF_BLOCK_DEV_CACHE_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRF_BLOCK_DEV_CACHE_CONFIG_INFO_COLOR
+#define NRF_BLOCK_DEV_CACHE_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRF_BLOCK_DEV_CACHE_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+ 
+// <0=> Default 
+// <1=> Black 
+// <2=> Red 
+// <3=> Green 
+// <4=> Yellow 
+// <5=> Blue 
+// <6=> Magenta 
+// <7=> Cyan 
+// <8=> White 
+
+#ifndef NRF_BLOCK_DEV_CACHE_CONFIG_DEBUG_COLOR
+#define NRF_BLOCK_DEV_CACHE_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
 // <e> NRF_BLOCK_DEV_EMPTY_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
 #ifndef NRF_BLOCK_DEV_EMPTY_CONFIG_LOG_ENABLED
@@ -11783,6 +12073,20 @@
 
 // </e>
 
+// <e> NFC_NDEF_STREAM_PARSER_ENABLED - nfc_ndef_stream_parser - Streaming NFC NDEF message parser
+//==========================================================
+#ifndef NFC_NDEF_STREAM_PARSER_ENABLED
+#define NFC_NDEF_STREAM_PARSER_ENABLED 0
+#endif
+// <o> NFC_NDEF_STREAM_PARSER_FIELD_BUF_SIZE - Size of the buffer for record Type and ID fields. 
+// <i> Type and ID fields longer than this are rejected as invalid data.
+
+#ifndef NFC_NDEF_STREAM_PARSER_FIELD_BUF_SIZE
+#define NFC_NDEF_STREAM_PARSER_FIELD_BUF_SIZE 64
+#endif
+
+// </e>
+
 // <q> NFC_NDEF_TEXT_RECORD_ENABLED  - nfc_text_rec - Encoding data for a text record for NFC Tag
  
 
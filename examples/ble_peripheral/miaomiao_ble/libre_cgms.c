@@ -0,0 +1,232 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "sdk_common.h"
+#include "nrf_ble_cgms.h"
+#include "cgms_db.h"
+#include "libre_cgms.h"
+
+#define NRF_LOG_MODULE_NAME libre_cgms
+#include "nrf_log.h"
+NRF_LOG_MODULE_REGISTER();
+
+#define LIBRE_RAW_GLUCOSE_MASK  0x1FFF  /**< Raw glucose value bits of a FRAM entry. */
+
+static nrf_ble_cgms_t * mp_cgms;                             /**< CGM Service instance. */
+static ble_cgms_rec_t   m_stage[LIBRE_CGMS_STAGE_SIZE];      /**< Staged records, in time order. */
+static uint8_t          m_stage_cnt;                         /**< Number of staged records. */
+static uint16_t         m_last_time_offset;                  /**< Time offset of the newest stored record. */
+static bool             m_last_valid;                        /**< Whether the database holds any record. */
+static uint8_t          m_sensor_uid[LIBRE_CGMS_UID_LEN];    /**< UID of the sensor that feeds the database. */
+static bool             m_sensor_valid;                      /**< Whether m_sensor_uid is set. */
+
+
+/**@brief Function for reading the newest stored time offset back from the database. */
+static void last_time_offset_update(void)
+{
+    ble_cgms_rec_t rec;
+    uint16_t       num_records = cgms_db_num_records_get();
+
+    m_last_valid = false;
+    if ((num_records > 0) && (cgms_db_record_get(num_records - 1, &rec) == NRF_SUCCESS))
+    {
+        m_last_time_offset = rec.meas.time_offset;
+        m_last_valid       = true;
+    }
+}
+
+
+/**@brief Function for dropping the staged records that are already stored. */
+static void stage_prune(void)
+{
+    uint8_t stored = 0;
+
+    if (!m_last_valid)
+    {
+        return;
+    }
+
+    while ((stored < m_stage_cnt) && (m_stage[stored].meas.time_offset <= m_last_time_offset))
+    {
+        stored++;
+    }
+
+    m_stage_cnt -= stored;
+    memmove(&m_stage[0], &m_stage[stored], m_stage_cnt * sizeof(m_stage[0]));
+}
+
+
+/**@brief Function for converting a raw sensor reading to mg/dL.
+ *
+ * @details Uses the uncalibrated factor of 1/8.5 commonly applied to FreeStyle Libre raw values.
+ *          The result is below 2048, so it is also a valid SFLOAT with exponent 0.
+ */
+static uint16_t raw_to_mg_dl(uint16_t raw)
+{
+    return (uint16_t)(((uint32_t)raw * 2 + 8) / 17);
+}
+
+
+ret_code_t libre_cgms_init(nrf_ble_cgms_t * p_cgms)
+{
+    VERIFY_PARAM_NOT_NULL(p_cgms);
+
+    mp_cgms        = p_cgms;
+    m_stage_cnt    = 0;
+    m_sensor_valid = false;
+    last_time_offset_update();
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t libre_cgms_sensor_set(uint8_t const * p_uid, uint16_t minutes_since_start)
+{
+    ret_code_t err_code;
+    bool       new_sensor;
+
+    VERIFY_PARAM_NOT_NULL(p_uid);
+
+    new_sensor = (m_sensor_valid && (memcmp(m_sensor_uid, p_uid, LIBRE_CGMS_UID_LEN) != 0))
+                 || (m_last_valid && (minutes_since_start < m_last_time_offset));
+
+    if (new_sensor)
+    {
+        // The time offsets of the new sensor start again at 0, the database only takes them
+        // once the readings of the previous sensor are gone.
+        err_code = cgms_db_clear();
+        VERIFY_SUCCESS(err_code);
+
+        m_stage_cnt  = 0;
+        m_last_valid = false;
+        NRF_LOG_INFO("New sensor, stored readings deleted.");
+    }
+
+    memcpy(m_sensor_uid, p_uid, LIBRE_CGMS_UID_LEN);
+    m_sensor_valid = true;
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t libre_cgms_sample_add(uint16_t time_offset, uint8_t const * p_entry)
+{
+    uint16_t raw = uint16_decode(p_entry) & LIBRE_RAW_GLUCOSE_MASK;
+    uint8_t  pos;
+
+    if (raw == 0)
+    {
+        return NRF_ERROR_INVALID_DATA;
+    }
+
+    if (m_last_valid && (time_offset <= m_last_time_offset))
+    {
+        // Already stored.
+        return NRF_SUCCESS;
+    }
+
+    // Keep the stage sorted. The first reading for a time offset wins, so trend readings should
+    // be added before history readings.
+    pos = m_stage_cnt;
+    while ((pos > 0) && (m_stage[pos - 1].meas.time_offset > time_offset))
+    {
+        pos--;
+    }
+    if ((pos > 0) && (m_stage[pos - 1].meas.time_offset == time_offset))
+    {
+        return NRF_SUCCESS;
+    }
+
+    if (m_stage_cnt == LIBRE_CGMS_STAGE_SIZE)
+    {
+        return NRF_ERROR_NO_MEM;
+    }
+
+    memmove(&m_stage[pos + 1], &m_stage[pos], (m_stage_cnt - pos) * sizeof(m_stage[0]));
+    memset(&m_stage[pos], 0, sizeof(m_stage[pos]));
+    m_stage[pos].meas.time_offset           = time_offset;
+    m_stage[pos].meas.glucose_concentration = raw_to_mg_dl(raw);
+    m_stage_cnt++;
+
+    return NRF_SUCCESS;
+}
+
+
+ret_code_t libre_cgms_flush(void)
+{
+    ret_code_t err_code;
+
+    if (mp_cgms == NULL)
+    {
+        return NRF_ERROR_INVALID_STATE;
+    }
+
+    while (m_stage_cnt > 0)
+    {
+        uint8_t  staged = m_stage_cnt;
+        uint16_t count  = MIN(m_stage_cnt, NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE);
+
+        err_code = nrf_ble_cgms_meas_batch_create(mp_cgms, m_stage, count);
+
+        // The records can be stored even if the notification failed, or only partly stored if
+        // the flash queue filled up. The database tells what was stored.
+        last_time_offset_update();
+        stage_prune();
+
+        if (m_stage_cnt == staged)
+        {
+            if ((err_code == NRF_ERROR_BUSY) || (err_code == NRF_ERROR_NO_MEM))
+            {
+                // Retry when the pending flash writes are done.
+                return NRF_SUCCESS;
+            }
+
+            NRF_LOG_WARNING("Dropping %d readings, error 0x%x.", m_stage_cnt, err_code);
+            m_stage_cnt = 0;
+            return err_code;
+        }
+
+        NRF_LOG_DEBUG("Stored readings up to time offset %d.", m_last_time_offset);
+    }
+
+    return NRF_SUCCESS;
+}
@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** @file
+ *
+ * @defgroup libre_cgms FreeStyle Libre to CGM Service feeder
+ * @{
+ * @ingroup ble_sdk_app_template
+ * @brief Feeds the glucose readings decoded from the sensor FRAM into the CGM Service.
+ *
+ * @details Trend (1-minute) and history (15-minute) readings are staged in time order, with
+ *          one reading per time offset. Readings that are already stored in the CGM Service
+ *          database are skipped, so the same FRAM content can be fed again without creating
+ *          duplicates. The staged readings are then added to the database in batches of up to
+ *          @ref NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE records, see @ref nrf_ble_cgms_meas_batch_create.
+ *
+ *          The time offset of a reading is the number of minutes since the sensor was started.
+ *          Readings are staged for one sensor at a time, set with @ref libre_cgms_sensor_set.
+ *          When the sensor changes, the records of the previous sensor are deleted from the
+ *          database, as the time offsets of the new sensor start again at 0.
+ */
+
+#ifndef LIBRE_CGMS_H__
+#define LIBRE_CGMS_H__
+
+#include <stdint.h>
+#include "sdk_errors.h"
+#include "nrf_ble_cgms.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LIBRE_CGMS_TREND_CNT    16  /**< Number of 1-minute trend readings in the sensor FRAM. */
+#define LIBRE_CGMS_HISTORY_CNT  32  /**< Number of 15-minute history readings in the sensor FRAM. */
+#define LIBRE_CGMS_UID_LEN      8   /**< Length of the sensor UID (in bytes). */
+
+/**@brief Maximum number of staged readings. One full FRAM read fits. */
+#define LIBRE_CGMS_STAGE_SIZE   (LIBRE_CGMS_TREND_CNT + LIBRE_CGMS_HISTORY_CNT)
+
+
+/**@brief Function for initializing the feeder.
+ *
+ * @details Must be called after @ref nrf_ble_cgms_init, as the newest stored record is read from
+ *          the database.
+ *
+ * @param[in] p_cgms Instance of the CGM Service to feed.
+ *
+ * @retval NRF_SUCCESS If the feeder was initialized.
+ */
+ret_code_t libre_cgms_init(nrf_ble_cgms_t * p_cgms);
+
+
+/**@brief Function for setting the sensor whose readings are staged next.
+ *
+ * @details A new sensor is detected by a change of UID, or by a sensor age that is lower than
+ *          the time offset of the newest stored record. The database is then cleared and the
+ *          staged readings are dropped. The UID is not kept across a reset, so right after a
+ *          reset a new sensor is only detected by its age.
+ *
+ * @param[in] p_uid               UID of the sensor (@ref LIBRE_CGMS_UID_LEN bytes).
+ * @param[in] minutes_since_start Age of the sensor, in minutes.
+ *
+ * @retval NRF_SUCCESS If the sensor was set.
+ * @return             Errors from @ref cgms_db_clear. The sensor is not changed.
+ */
+ret_code_t libre_cgms_sensor_set(uint8_t const * p_uid, uint16_t minutes_since_start);
+
+
+/**@brief Function for staging a reading decoded from the sensor FRAM.
+ *
+ * @param[in] time_offset Minutes since the sensor was started.
+ * @param[in] p_entry     Trend or history entry of the FRAM (6 bytes).
+ *
+ * @retval NRF_SUCCESS             If the reading was staged, or skipped as a duplicate.
+ * @retval NRF_ERROR_INVALID_DATA  If the entry holds no reading.
+ * @retval NRF_ERROR_NO_MEM        If the staging buffer is full.
+ */
+ret_code_t libre_cgms_sample_add(uint16_t time_offset, uint8_t const * p_entry);
+
+
+/**@brief Function for adding the staged readings to the CGM Service.
+ *
+ * @details Readings that cannot be added because the database write queue is full stay staged.
+ *          Call this function again later, for example from the main loop.
+ *
+ * @retval NRF_SUCCESS If the readings were added, or are waiting for the database.
+ * @return             Other errors from @ref nrf_ble_cgms_meas_batch_create. The staged
+ *                     readings are dropped in that case.
+ */
+ret_code_t libre_cgms_flush(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LIBRE_CGMS_H__
+
+/** @} */
@@ -77,6 +77,8 @@
 #include "ble_conn_state.h"
 #include "nrf_ble_gatt.h"
 #include "nrf_ble_qwr.h"
+#include "nrf_ble_gq.h"
+#include "nrf_ble_cgms.h"
 #include "nrf_pwr_mgmt.h"
 #include "nrf_dfu_ble_svci_bond_sharing.h"
 #include "nrf_svci_async_function.h"
@@ -100,6 +102,7 @@
 #include "rfal_rf.h"
 #include "rfal_analogConfig.h"
 #include "nfcv_worker.h"
+#include "libre_cgms.h"
 
 #include "st25R3911_interrupt.h"
 #include "st25r3911_com.h"
@@ -134,9 +137,15 @@
 
 #define SPI_INSTANCE 0
 
+#define CGMS_RUN_TIME_HOURS 336 /**< Sensor run time (14 days). */
+
 NRF_BLE_GATT_DEF(m_gatt);           /**< GATT module instance. */
 NRF_BLE_QWR_DEF(m_qwr);             /**< Context for the Queued Write module.*/
 BLE_ADVERTISING_DEF(m_advertising); /**< Advertising module instance. */
+NRF_BLE_GQ_DEF(m_ble_gatt_queue,    /**< BLE GATT Queue instance. */
+               NRF_SDH_BLE_PERIPHERAL_LINK_COUNT,
+               NRF_BLE_GQ_QUEUE_SIZE);
+NRF_BLE_CGMS_DEF(m_cgms);           /**< Continuous Glucose Monitoring Service instance. */
 
 static uint16_t m_conn_handle = BLE_CONN_HANDLE_INVALID; /**< Handle of the current connection. */
 
@@ -633,9 +642,10 @@ static void timer_timeout_handler(void *p_context)
     time_update();
 }
 
-// APP_TIMER_DEF(m_systick_id);
-// #define TIME_SYSTICK_INTERVAL APP_TIMER_TICKS(1)
-uint32_t my_systick = 0;
+#define TIMEBASE_RTC_FREQ     32768                               /**< RTC2 counter frequency (prescaler 0). */
+#define TIMEBASE_RTC_HALF_CNT (RTC_COUNTER_COUNTER_Msk >> 1)
+
+static volatile uint32_t m_rtc_overflows = 0;                     /**< Number of RTC2 counter overflows (one every 512 s). */
 
 static void timers_init(void)
 {
@@ -658,15 +668,61 @@ static void timers_init(void)
 
 static void rtc_handler(nrf_drv_rtc_int_type_t int_type)
 {
-    if (int_type == NRF_DRV_RTC_INT_TICK)
+    if (int_type == NRF_DRV_RTC_INT_OVERFLOW)
     {
-        my_systick++;
+        m_rtc_overflows++;
     }
 }
 
+/**@brief Function for reading the 64-bit monotonic RTC2 counter.
+ *
+ * @details The 24-bit counter is extended with the overflow count. An overflow which is pending
+ *          but not yet counted by the interrupt handler is taken into account.
+ */
+static uint64_t rtc_ticks_get(void)
+{
+    uint32_t overflows;
+    uint32_t counter;
+    uint32_t pending;
+
+    do
+    {
+        overflows = m_rtc_overflows;
+        counter   = nrf_drv_rtc_counter_get(&m_rtc);
+        pending   = nrf_rtc_event_pending(m_rtc.p_reg, NRF_RTC_EVENT_OVERFLOW);
+    } while (overflows != m_rtc_overflows);
+
+    if (pending && (counter < TIMEBASE_RTC_HALF_CNT))
+    {
+        overflows++;
+    }
+
+    return ((uint64_t)overflows << 24) | counter;
+}
+
+/**@brief Function for getting time since start in milliseconds. */
+uint64_t get_sysTick64(void)
+{
+    return (rtc_ticks_get() * 1000) / TIMEBASE_RTC_FREQ;
+}
+
+/**@brief Function for getting time since start in microseconds.
+ *
+ * @details Whole seconds and the remaining ticks are converted separately, so the result does not
+ *          overflow for as long as the 64-bit microsecond count itself.
+ */
+uint64_t get_sysTick_us(void)
+{
+    uint64_t ticks = rtc_ticks_get();
+
+    // 1000000 / 32768 = 15625 / 512
+    return (ticks / TIMEBASE_RTC_FREQ) * 1000000 +
+           (((ticks % TIMEBASE_RTC_FREQ) * 15625) >> 9);
+}
+
 uint32_t get_sysTick(void)
 {
-    return my_systick;
+    return (uint32_t)get_sysTick64();
 }
 
 static void lfclk_config(void)
@@ -681,12 +737,13 @@ static void rtc_config(void)
     uint32_t err_code;
 
     nrf_drv_rtc_config_t config = NRF_DRV_RTC_DEFAULT_CONFIG;
-    config.prescaler = 31;
+    config.prescaler = RTC_FREQ_TO_PRESCALER(TIMEBASE_RTC_FREQ);
 
     err_code = nrf_drv_rtc_init(&m_rtc, &config, rtc_handler);
     APP_ERROR_CHECK(err_code);
 
-    nrf_drv_rtc_tick_enable(&m_rtc, true);
+    // Tickless timebase: the counter is read on demand, only overflows wake the CPU.
+    nrf_drv_rtc_overflow_enable(&m_rtc, true);
     nrf_drv_rtc_enable(&m_rtc);
 }
 
@@ -731,11 +788,19 @@ static void gap_params_init(void)
     APP_ERROR_CHECK(err_code);
 }
 
+/**@brief Function for handling events from the GATT module.
+ */
+static void gatt_evt_handler(nrf_ble_gatt_t *p_gatt, nrf_ble_gatt_evt_t const *p_evt)
+{
+    // The CGM Service packs as many records as the ATT MTU allows into each notification.
+    nrf_ble_cgms_on_gatt_evt(&m_cgms, p_evt);
+}
+
 /**@brief Function for initializing the GATT module.
  */
 static void gatt_init(void)
 {
-    ret_code_t err_code = nrf_ble_gatt_init(&m_gatt, NULL);
+    ret_code_t err_code = nrf_ble_gatt_init(&m_gatt, gatt_evt_handler);
     APP_ERROR_CHECK(err_code);
 }
 
@@ -807,6 +872,16 @@ static void bat_profile_evt_handler()
 {
 }
 
+static void cgms_evt_handler(nrf_ble_cgms_t *p_cgms, nrf_ble_cgms_evt_t *p_evt)
+{
+    NRF_LOG_DEBUG("CGMS event: %d", p_evt->evt_type);
+}
+
+static void cgms_error_handler(uint32_t nrf_error)
+{
+    APP_ERROR_HANDLER(nrf_error);
+}
+
 /**@brief Function for initializing services that will be used by the application.
  */
 static void services_init(void)
@@ -819,6 +894,7 @@ static void services_init(void)
     ErrsProfileCallback_t errs_init = {0};
     TssProfileCallback_t tss_init = {0};
     BatProfileCallback_t bat_init = {0};
+    nrf_ble_cgms_init_t cgms_init = {0};
 
     // Initialize Queued Write Module.
     qwr_init.error_handler = nrf_qwr_error_handler;
@@ -846,6 +922,20 @@ static void services_init(void)
     err_code = bat_profile_init(&bat_init);
     APP_ERROR_CHECK(err_code);
 
+    // create cgms, fed with the readings decoded from the sensor FRAM
+    cgms_init.evt_handler = cgms_evt_handler;
+    cgms_init.error_handler = cgms_error_handler;
+    cgms_init.p_gatt_queue = &m_ble_gatt_queue;
+    cgms_init.feature.feature = 0;
+    cgms_init.feature.type = NRF_BLE_CGMS_MEAS_TYPE_FLUID;
+    cgms_init.feature.sample_location = NRF_BLE_CGMS_MEAS_LOC_SUB_TISSUE;
+    cgms_init.initial_run_time = CGMS_RUN_TIME_HOURS;
+    err_code = nrf_ble_cgms_init(&m_cgms, &cgms_init);
+    APP_ERROR_CHECK(err_code);
+
+    err_code = libre_cgms_init(&m_cgms);
+    APP_ERROR_CHECK(err_code);
+
 #if (BLE_DFU_ENABLED == 1)
     err_code = ble_dfu_buttonless_async_svci_init();
     APP_ERROR_CHECK(err_code);
@@ -1172,6 +1262,8 @@ static void ble_evt_handler(ble_evt_t const *p_ble_evt, void *p_context)
         m_conn_handle = p_ble_evt->evt.gap_evt.conn_handle;
         err_code = nrf_ble_qwr_conn_handle_assign(&m_qwr, m_conn_handle);
         APP_ERROR_CHECK(err_code);
+        err_code = nrf_ble_cgms_conn_handle_assign(&m_cgms, m_conn_handle);
+        APP_ERROR_CHECK(err_code);
         break;
 
     case BLE_GAP_EVT_PHY_UPDATE_REQUEST:
@@ -1492,6 +1584,8 @@ int main(void)
         idle_state_handle();
         rfalWorker();
         workCycle(scan_flag);
+        // Readings waiting for the CGMS database write queue.
+        (void)libre_cgms_flush();
     }
 }
 
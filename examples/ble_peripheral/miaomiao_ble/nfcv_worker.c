@@ -5,6 +5,7 @@
 #include "rfal_isoDep.h"
 #include "nfcv_worker.h"
 #include "cus_drs.h"
+#include "libre_cgms.h"
 
 #define FIELD_OFF 0
 #define DELAY_FIELD 1
@@ -37,43 +38,11 @@ static union
     rfalNfcDepDevice nfcDepDev; /* NFC-DEP Device details                          */
 } gDevProto;
 
-char hexStr[4][128];
-uint8_t hexStrIdx = 0;
-
 static uint8_t state = FIELD_OFF; /*!< Actual state, starting with RF field turned off */
 
 bool PollNFCV(void);
 bool demoPollAP2P(void);
 
-static char *hex2Str(unsigned char *data, size_t dataLen)
-{
-    unsigned char *pin = data;
-    const char *hex = "0123456789ABCDEF";
-    char *pout = hexStr[hexStrIdx];
-    uint8_t i = 0;
-    uint8_t idx = hexStrIdx;
-    if (dataLen == 0)
-    {
-        pout[0] = 0;
-    }
-    else
-    {
-        for (; i < dataLen - 1; ++i)
-        {
-            *pout++ = hex[(*pin >> 4) & 0xF];
-            *pout++ = hex[(*pin++) & 0xF];
-        }
-        *pout++ = hex[(*pin >> 4) & 0xF];
-        *pout++ = hex[(*pin) & 0xF];
-        *pout = 0;
-    }
-
-    hexStrIdx++;
-    hexStrIdx %= 4;
-
-    return hexStr[idx];
-}
-
 void workCycle(uint8_t scan_flag)
 {
     bool found = false;
@@ -228,7 +197,8 @@ bool demoPollAP2P(void)
             /****************************************************************************/
             /* Active P2P device activated                                              */
             /* NFCID / UID is contained in : nfcDepDev.activation.Target.ATR_RES.NFCID3 */
-            platformLog("NFC Active P2P device found. NFCID3: %s\r\n", hex2Str(gDevProto.nfcDepDev.activation.Target.ATR_RES.NFCID3, RFAL_NFCDEP_NFCID3_LEN));
+            platformLog("NFC Active P2P device found. NFCID3:\r\n");
+            platformLogHex(gDevProto.nfcDepDev.activation.Target.ATR_RES.NFCID3, RFAL_NFCDEP_NFCID3_LEN);
             return true;
         }
 
@@ -240,32 +210,37 @@ bool demoPollAP2P(void)
     return false;
 }
 
-S_sensor_t sensor_d;
+#define NFCV_FRAM_BLOCKS 43                        // FreeStyle Libre FRAM size in 8-byte blocks
+#define NFCV_READ_INTERVAL_MS (5 * 60 * 1000)      // time between two reads of a sensor staying in the field
+#define NFCV_READ_RETRIES 3                        // failed block reads before a sensor is skipped for this window
+#define NFCV_CGMS_FEEDER_TIMEOUT_MS (60 * 60 * 1000) // time away after which the CGMS sensor can be replaced
+
+S_sensor_t sensor_d; // copy of the sensor read last, for the BLE side
 
 // extern uint32_t libreLife;
 // extern DrsRTPayload_s rt_payload;
 // extern DrsHisPayload_s his_payload;
 // extern uint32_t cur_TZ;
 #define PLATFORM_LOG 0
-void libre_data_parsing(void)
+static void libre_data_parsing(S_sensor_t *p_sensor, bool feed_cgms)
 {
-    sensor_d.oldNextTrend = sensor_d.nextTrend;
-    sensor_d.nextTrend = sensor_d.fram[26];
-    sensor_d.oldNextHistory = sensor_d.nextHistory;
-    sensor_d.nextHistory = sensor_d.fram[27];
+    p_sensor->oldNextTrend = p_sensor->nextTrend;
+    p_sensor->nextTrend = p_sensor->fram[26];
+    p_sensor->oldNextHistory = p_sensor->nextHistory;
+    p_sensor->nextHistory = p_sensor->fram[27];
 
-    // rt_payload.curSensorSta = sensor_d.fram[4];
+    // rt_payload.curSensorSta = p_sensor->fram[4];
 #if PLATFORM_LOG
-    platformLog("oldNTrend:0x%x\nnTrend:0x%x\noldNHistory:0x%x\nnHistory:0x%x\n", sensor_d.oldNextTrend, sensor_d.nextTrend, sensor_d.oldNextHistory, sensor_d.nextHistory);
+    platformLog("oldNTrend:0x%x\nnTrend:0x%x\noldNHistory:0x%x\nnHistory:0x%x\n", p_sensor->oldNextTrend, p_sensor->nextTrend, p_sensor->oldNextHistory, p_sensor->nextHistory);
 #endif
-    sensor_d.oldMinutesSinceStart = sensor_d.minutesSinceStart;
-    sensor_d.minutesSinceStart = ((uint16_t)sensor_d.fram[317] << 8) + (uint16_t)sensor_d.fram[316]; // bytes swapped
-    uint16_t minutesSinceLastReading = sensor_d.minutesSinceStart - sensor_d.oldMinutesSinceStart;
-    // libreLife = (MAX_LIBRE_LIFE - sensor_d.minutesSinceStart * 60) > MAX_LIBRE_LIFE ? 0 : (MAX_LIBRE_LIFE - sensor_d.minutesSinceStart * 60); // min to sec
+    p_sensor->oldMinutesSinceStart = p_sensor->minutesSinceStart;
+    p_sensor->minutesSinceStart = ((uint16_t)p_sensor->fram[317] << 8) + (uint16_t)p_sensor->fram[316]; // bytes swapped
+    uint16_t minutesSinceLastReading = p_sensor->minutesSinceStart - p_sensor->oldMinutesSinceStart;
+    // libreLife = (MAX_LIBRE_LIFE - p_sensor->minutesSinceStart * 60) > MAX_LIBRE_LIFE ? 0 : (MAX_LIBRE_LIFE - p_sensor->minutesSinceStart * 60); // min to sec
 #if PLATFORM_LOG
-    platformLog("oldmSinceStart:0x%x\nmSinceStart:0x%x\nmSinceLastRead:0x%x\n", sensor_d.oldMinutesSinceStart, sensor_d.minutesSinceStart, minutesSinceLastReading);
+    platformLog("oldmSinceStart:0x%x\nmSinceStart:0x%x\nmSinceLastRead:0x%x\n", p_sensor->oldMinutesSinceStart, p_sensor->minutesSinceStart, minutesSinceLastReading);
 #endif
-    int8_t trendDelta = sensor_d.nextTrend - sensor_d.oldNextTrend;
+    int8_t trendDelta = p_sensor->nextTrend - p_sensor->oldNextTrend;
     int8_t trendsSinceLastReading = (trendDelta >= 0) ? trendDelta : trendDelta + 16; // compensate ring buffer
     if (minutesSinceLastReading > 15)
         trendsSinceLastReading = 16; // Read all 16 trend data if more than 15 minute have passed
@@ -274,7 +249,7 @@ void libre_data_parsing(void)
 #endif
     if (trendsSinceLastReading > 0)
     {
-        int firstTrend = sensor_d.oldNextTrend;
+        int firstTrend = p_sensor->oldNextTrend;
         int firstTrendByte = 28 + (6 * firstTrend);
         // Does not consider the ring buffer (this is considered later in the reading loop)
         int lastTrendByte = firstTrendByte + (6 * trendsSinceLastReading) - 1;
@@ -292,7 +267,7 @@ void libre_data_parsing(void)
             if (trendBlock != 3)
             {
                 // block 3 was read already and can be skipped
-                // sensor_d.resultCodes[trendBlock] = readSingleBlock(trendBlock, maxTrials, RXBuffer, sensor_d.fram, SS_PIN);
+                // p_sensor->resultCodes[trendBlock] = readSingleBlock(trendBlock, maxTrials, RXBuffer, p_sensor->fram, SS_PIN);
             }
             if (trendBlock == lastTrendBlock)
                 break;
@@ -303,7 +278,7 @@ void libre_data_parsing(void)
         }
     }
 
-    int8_t historyDelta = sensor_d.nextHistory - sensor_d.oldNextHistory;
+    int8_t historyDelta = p_sensor->nextHistory - p_sensor->oldNextHistory;
     int8_t historiesSinceLastReading = (historyDelta >= 0) ? historyDelta : historyDelta + 32; // compensate ring buffer
 #if PLATFORM_LOG
     platformLog("hisDelta:0x%x\nhisSinceLstRead:0x%x\n", historyDelta, historiesSinceLastReading);
@@ -312,7 +287,7 @@ void libre_data_parsing(void)
     // if there is new trend data, read the new trend data
     if (historiesSinceLastReading > 0)
     {
-        int firstHistory = sensor_d.oldNextHistory;
+        int firstHistory = p_sensor->oldNextHistory;
         int firstHistoryByte = 124 + (6 * firstHistory);
         // Does not consider the ring buffer (this is considered later in the reading loop)
         int lastHistoryByte = firstHistoryByte + (6 * historiesSinceLastReading) - 1;
@@ -330,7 +305,7 @@ void libre_data_parsing(void)
             if (historyBlock != 39)
             {
                 // block 39 was read already and can be skipped
-                //                sensor_d.resultCodes[historyBlock] = readSingleBlock(historyBlock, maxTrials, RXBuffer, sensor_d.fram, SS_PIN);
+                //                p_sensor->resultCodes[historyBlock] = readSingleBlock(historyBlock, maxTrials, RXBuffer, p_sensor->fram, SS_PIN);
             }
             if (historyBlock == lastHistoryBlock)
                 break;
@@ -341,63 +316,183 @@ void libre_data_parsing(void)
         }
     }
 
-    for (int i = 0; i < 15; i++)
-    {
-        uint8_t index = 4 + (14 - i) * 6;
-        // var index = 4 + (nextTrendBlock - 1 - blockIndex) * 6 // runs backwards
-        if (index < 4)
-        {
-            index += 96;
-        }
-        // uint16_t glucose = (((uint16_t)sensor_d.fram[index + 25]) << 8) | sensor_d.fram[index + 24];
+    // Only one sensor feeds the CGM Service, its session cannot mix readings from several sensors.
+    if (!feed_cgms)
+        return;
 
-        // if (i == 0)
-        // {
-        //     rt_payload.data.bloodGluose = glucose;
-        //     rt_payload.data.timeStamp = cur_TZ - 60 * i;
-        //     rt_payload.data.libreLife = libreLife + 60 * i;
-        // }
+    // A new sensor restarts the time offsets, the readings of the previous one are deleted.
+    if (libre_cgms_sensor_set(p_sensor->uid, p_sensor->minutesSinceStart) != NRF_SUCCESS)
+        return;
 
-        // let measurementDate = date.addingTimeInterval(Double(-60 * blockIndex))
+    // Trend entries are a ring of 16 one-minute readings, nextTrend points past the newest one.
+    // Trend readings are staged first, so they win over history readings with the same time.
+    for (int i = 0; i < LIBRE_CGMS_TREND_CNT; i++)
+    {
+        uint8_t block = (p_sensor->nextTrend + LIBRE_CGMS_TREND_CNT - 1 - i) % LIBRE_CGMS_TREND_CNT;
+        uint16_t index = 28 + block * 6;
+
+        if (p_sensor->minutesSinceStart < i)
+            break;
+        (void)libre_cgms_sample_add(p_sensor->minutesSinceStart - i, &p_sensor->fram[index]);
 #if PLATFORM_LOG
-        platformLog("trdrange:%d~%d,time:%d,glucose:%d\n", index + 24, index + 30, -60 * i, glucose);
+        platformLog("trdrange:%d~%d,time:%d\n", index, index + 6, -60 * i);
 #endif
     }
-    for (int i = 0; i < 32; i++)
+
+    // History entries are a ring of 32 readings taken every 15 minutes, the newest one 3 minutes
+    // after a multiple of 15 minutes since start.
+    uint16_t lastHistory = p_sensor->minutesSinceStart - ((p_sensor->minutesSinceStart - 3) % 15);
+    for (int i = 0; i < LIBRE_CGMS_HISTORY_CNT; i++)
     {
-        uint16_t index = 100 + (31 - i) * 6;
-        // var index = 100 + (nextHistoryBlock - 1 - blockIndex) * 6 // runs backwards
-        if (index < 100)
-        {
-            index += 192;
-        }
-        // uint16_t glucose = (((uint16_t)sensor_d.fram[index + 25]) << 8) | sensor_d.fram[index + 24];
-        //        his_payload.data[i].bloodGluose = glucose;
-        //        his_payload.data[i].timeStamp = cur_TZ - 900 * i;
-        //        his_payload.data[i].libreLife = libreLife + 900 * i;
-        //
-        // let measurementDate = mostRecentHistoryDate.addingTimeInterval(Double(-900 * blockIndex)) // 900 = 60 * 15
+        uint8_t block = (p_sensor->nextHistory + LIBRE_CGMS_HISTORY_CNT - 1 - i) % LIBRE_CGMS_HISTORY_CNT;
+        uint16_t index = 124 + block * 6;
+
+        if ((p_sensor->minutesSinceStart < 3) || (lastHistory < 15 * i))
+            break;
+        (void)libre_cgms_sample_add(lastHistory - 15 * i, &p_sensor->fram[index]);
 #if PLATFORM_LOG
-        platformLog("hisrange:%d~%d,time:%d,glucose:%d\n", index + 24, index + 30, -900 * i, glucose);
+        platformLog("hisrange:%d~%d,time:%d\n", index, index + 6, -900 * i);
 #endif
     }
-    //    his_payload.totalDataNumber = 32;
+
+    (void)libre_cgms_flush();
 }
 
-static uint8_t read_flag = 0;
-uint32_t last_count = 0;
-extern uint32_t my_systick;
+typedef struct
+{
+    S_sensor_t sensor;                  // sensor state, uid in display (MSB first) order
+    uint8_t rfUid[RFAL_NFCV_UID_LEN];   // uid as sent over the air, used for addressed commands
+    bool inUse;                         // slot holds a sensor
+    bool inField;                       // sensor answered the last inventory
+    bool readPending;                   // a FRAM read is in progress or due
+    uint8_t nextBlock;                  // next FRAM block to read
+    uint8_t failures;                   // consecutive failed block reads
+    uint32_t lastSeen;                  // tick of the last inventory answer
+    uint32_t lastRead;                  // tick of the last completed FRAM read
+} S_nfcv_slot_t;
+
+static S_nfcv_slot_t m_slots[NFCV_MAX_SENSORS];
+static S_nfcv_slot_t *mp_cgms_slot; // sensor that feeds the CGM Service, never evicted
 uint8_t sensor_state = 0;
-bool PollNFCV(void)
+
+static S_nfcv_slot_t *nfcv_slot_find(uint8_t const *rfUid)
 {
-    ReturnCode err;
-    rfalNfcvListenDevice nfcvDev;
-    bool found = false;
+    for (int i = 0; i < NFCV_MAX_SENSORS; i++)
+    {
+        if (m_slots[i].inUse && (memcmp(m_slots[i].rfUid, rfUid, RFAL_NFCV_UID_LEN) == 0))
+            return &m_slots[i];
+    }
+    return NULL;
+}
+
+/* Take a free slot, or the one of the sensor that has been away the longest. The CGMS sensor keeps its slot. */
+static S_nfcv_slot_t *nfcv_slot_alloc(uint8_t const *rfUid)
+{
+    S_nfcv_slot_t *p_slot = NULL;
+    uint32_t now = platformGetSysTick();
+
+    for (int i = 0; i < NFCV_MAX_SENSORS; i++)
+    {
+        if (!m_slots[i].inUse)
+        {
+            p_slot = &m_slots[i];
+            break;
+        }
+        if (!m_slots[i].inField && (&m_slots[i] != mp_cgms_slot) &&
+            ((p_slot == NULL) || ((uint32_t)(now - m_slots[i].lastSeen) > (uint32_t)(now - p_slot->lastSeen))))
+        {
+            p_slot = &m_slots[i];
+        }
+    }
+    if (p_slot == NULL)
+        return NULL;
+
+    memset(p_slot, 0, sizeof(*p_slot));
+    p_slot->inUse = true;
+    memcpy(p_slot->rfUid, rfUid, RFAL_NFCV_UID_LEN);
+    memcpy(p_slot->sensor.uid, rfUid, RFAL_NFCV_UID_LEN);
+    REVERSE_BYTES(p_slot->sensor.uid, RFAL_NFCV_UID_LEN);
+    p_slot->readPending = true;
+
+    platformLog("ISO15693/NFC-V card found. UID:\r\n");
+    platformLogHex(p_slot->sensor.uid, RFAL_NFCV_UID_LEN);
+    return p_slot;
+}
+
+/* Run a full inventory (16-slot anticollision when tags collide) and update the sensor table. */
+static uint8_t nfcv_inventory(void)
+{
+    rfalNfcvListenDevice nfcvDevs[NFCV_MAX_SENSORS];
+    bool wasInField[NFCV_MAX_SENSORS];
     uint8_t devCnt = 0;
-    uint8_t rxBuf[128];
+    uint32_t now = platformGetSysTick();
+
+    for (int i = 0; i < NFCV_MAX_SENSORS; i++)
+    {
+        wasInField[i] = m_slots[i].inField;
+        m_slots[i].inField = false;
+    }
+
+    if ((rfalNfcvPollerCollisionResolution(NFCV_MAX_SENSORS, nfcvDevs, &devCnt) != ERR_NONE) || (devCnt == 0))
+        return 0;
+
+    for (int i = 0; i < devCnt; i++)
+    {
+        S_nfcv_slot_t *p_slot = nfcv_slot_find(nfcvDevs[i].InvRes.UID);
+
+        if (p_slot == NULL)
+            p_slot = nfcv_slot_alloc(nfcvDevs[i].InvRes.UID);
+        if (p_slot == NULL)
+            continue;
+
+        // A sensor is read again when it comes back into the field or when its interval has passed.
+        // A partial read only resumes within the same field window: the sensor keeps writing its
+        // FRAM, so blocks read earlier would not match the ones read now.
+        if (!wasInField[p_slot - m_slots] ||
+            (!p_slot->readPending && ((uint32_t)(now - p_slot->lastRead) > NFCV_READ_INTERVAL_MS)))
+        {
+            p_slot->readPending = true;
+            p_slot->nextBlock = 0;
+        }
+        p_slot->inField = true;
+        p_slot->failures = 0;
+        p_slot->lastSeen = now;
+    }
+    return devCnt;
+}
+
+/* Read one FRAM block of a sensor in addressed mode, no select needed. */
+static bool nfcv_block_read(S_nfcv_slot_t *p_slot)
+{
+    uint8_t rxBuf[1 + RFAL_NFCV_MAX_BLOCK_LEN + RFAL_CRC_LEN];
     uint16_t rcvLen;
-    uint8_t blockAddress = 0;
-    uint8_t flagDefault = 2;
+    ReturnCode err;
+
+    err = rfalNfvReadSingleBlock(RFAL_NFCV_REQ_FLAG_DEFAULT, p_slot->rfUid, p_slot->nextBlock, rxBuf, sizeof(rxBuf), &rcvLen);
+    if ((err != ERR_NONE) || (rcvLen < 1 + 8))
+    {
+        // Give up on this sensor for the current field window, the read starts over on the next one.
+        if (++p_slot->failures >= NFCV_READ_RETRIES)
+            p_slot->inField = false;
+        return false;
+    }
+
+    memcpy(&p_slot->sensor.fram[p_slot->nextBlock * 8], &rxBuf[1], 8);
+    p_slot->failures = 0;
+    p_slot->nextBlock++;
+    return true;
+}
+
+S_sensor_t const *nfcvSensorGet(uint8_t idx)
+{
+    if ((idx >= NFCV_MAX_SENSORS) || !m_slots[idx].inUse)
+        return NULL;
+    return &m_slots[idx].sensor;
+}
+
+bool PollNFCV(void)
+{
+    bool pending;
 
     /*******************************************************************************/
     /* ISO15693/NFC_V_PASSIVE_POLL_MODE                                            */
@@ -406,57 +501,47 @@ bool PollNFCV(void)
     rfalNfcvPollerInitialize(); /* Initialize for NFC-V */
     rfalFieldOnAndStartGT();    /* Turns the Field On if not already and start GT timer */
 
-    err = rfalNfcvPollerCollisionResolution(1, &nfcvDev, &devCnt);
-    if ((err == ERR_NONE) && (devCnt > 0))
+    if (nfcv_inventory() == 0)
     {
-        sensor_state = 1;
-        if (read_flag == 0)
-        {
-            read_flag = 1;
-            last_count = my_systick;
-            /******************************************************/
-            /* NFC-V card found                                   */
-            /* NFCID/UID is contained in: invRes.UID */
-            err = rfalNfvSelect(2, nfcvDev.InvRes.UID); /* select card */
-
-            REVERSE_BYTES(nfcvDev.InvRes.UID, RFAL_NFCV_UID_LEN);
-
-            found = true;
+        sensor_state = 0;
+        return false;
+    }
+    sensor_state = 1;
 
-            platformLog("ISO15693/NFC-V card found. UID: %s\r\n", hex2Str(nfcvDev.InvRes.UID, RFAL_NFCV_UID_LEN));
+    // Round-robin one block per sensor so every due sensor makes progress within this field-on window.
+    do
+    {
+        pending = false;
+        for (int i = 0; i < NFCV_MAX_SENSORS; i++)
+        {
+            S_nfcv_slot_t *p_slot = &m_slots[i];
 
-            memcpy(sensor_d.oldUid, sensor_d.uid, sizeof(sensor_d.uid));
-            memcpy(sensor_d.uid, nfcvDev.InvRes.UID, sizeof(nfcvDev.InvRes.UID));
+            if (!p_slot->inField || !p_slot->readPending)
+                continue;
 
-            if (err == ERR_NONE)
+            if (nfcv_block_read(p_slot) && (p_slot->nextBlock == NFCV_FRAM_BLOCKS))
             {
-                for (int i = 0; i < 43; i++)
+                p_slot->readPending = false;
+                p_slot->lastRead = platformGetSysTick();
+
+                // The CGMS session follows one sensor. It is only handed over once that sensor has
+                // been away for a long time, e.g. after a sensor swap; the CGMS database is then
+                // cleared by libre_cgms_sensor_set().
+                if ((mp_cgms_slot != NULL) && (mp_cgms_slot != p_slot) &&
+                    ((uint32_t)(p_slot->lastRead - mp_cgms_slot->lastSeen) > NFCV_CGMS_FEEDER_TIMEOUT_MS))
                 {
-                    err = rfalNfvReadSingleBlock(flagDefault, NULL, blockAddress + i, rxBuf, sizeof(rxBuf), &rcvLen); /* read card block */
-                    if (err == ERR_NONE)
-                    {
-                        //                    platformLog("ISO15693/NFC-V card block[%d]: %s\r\n", i,hex2Str(&rxBuf[1], rcvLen-1));
-                        for (int j = 0; j < 8; j++)
-                        {
-                            sensor_d.fram[i * 8 + j] = rxBuf[j + 1];
-                        }
-                    }
+                    mp_cgms_slot = NULL;
                 }
+                if (mp_cgms_slot == NULL)
+                    mp_cgms_slot = p_slot;
 
-                libre_data_parsing();
+                memcpy(p_slot->sensor.oldUid, sensor_d.uid, sizeof(sensor_d.uid));
+                libre_data_parsing(&p_slot->sensor, (p_slot == mp_cgms_slot));
+                memcpy(&sensor_d, &p_slot->sensor, sizeof(sensor_d));
             }
+            pending |= (p_slot->inField && p_slot->readPending);
         }
-    }
-    else
-    {
-        read_flag = 0;
-        sensor_state = 0;
-    }
-
-    if (my_systick - last_count > 5 * 60 * 1000)
-    {
-        read_flag = 0;
-    }
+    } while (pending);
 
-    return found;
+    return true;
 }
@@ -9,7 +9,7 @@ typedef struct Sensor
     unsigned char oldNextTrend;
     unsigned char nextHistory; // number of next history block to read
     unsigned char oldNextHistory;
-    unsigned char minutesSinceStart; // minutes since start of sensor
+    unsigned short minutesSinceStart; // minutes since start of sensor
     unsigned short oldMinutesSinceStart;
     unsigned char fram[344]; // buffer for Freestyle Libre FRAM data
 } S_sensor_t;
@@ -24,5 +24,10 @@ typedef enum
     E_FAILURE,
 } E_SENSOR_STA;
 
+#ifndef NFCV_MAX_SENSORS
+#define NFCV_MAX_SENSORS 4 // number of sensors tracked at the same time
+#endif
+
 void workCycle(uint8_t);
+S_sensor_t const *nfcvSensorGet(uint8_t idx);
 #endif
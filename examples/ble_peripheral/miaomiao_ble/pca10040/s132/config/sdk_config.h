@@ -74,9 +74,30 @@
 // <q> BLE_RACP_ENABLED  - ble_racp - Record Access Control Point library
 
 #ifndef BLE_RACP_ENABLED
-#define BLE_RACP_ENABLED 0
+#define BLE_RACP_ENABLED 1
 #endif
 
+// <h> NRF_BLE_CGMS_DB - Continuous Glucose Monitoring Service record database
+
+//==========================================================
+// <o> NRF_BLE_CGMS_DB_FLASH_PAGES - Number of flash pages used to store records.  <2-192>
+// <i> Each 4 kB page holds 340 records. The pages are placed directly below the bootloader,
+// <i> reserve them with FDS_VIRTUAL_PAGES_RESERVED.
+
+#ifndef NRF_BLE_CGMS_DB_FLASH_PAGES
+#define NRF_BLE_CGMS_DB_FLASH_PAGES 16
+#endif
+
+// <o> NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE - Number of records waiting to be written to flash.  <1-32>
+// <i> A full trend read of the sensor (16 readings) is written in one batch.
+
+#ifndef NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE
+#define NRF_BLE_CGMS_DB_WRITE_QUEUE_SIZE 16
+#endif
+
+// </h>
+//==========================================================
+
 // <e> NRF_BLE_CONN_PARAMS_ENABLED - ble_conn_params - Initiating and executing a connection parameters negotiation procedure
 //==========================================================
 #ifndef NRF_BLE_CONN_PARAMS_ENABLED
@@ -104,6 +125,38 @@
 #define NRF_BLE_GATT_ENABLED 1
 #endif
 
+// <e> NRF_BLE_GQ_ENABLED - nrf_ble_gq - BLE GATT Queue Module
+//==========================================================
+#ifndef NRF_BLE_GQ_ENABLED
+#define NRF_BLE_GQ_ENABLED 1
+#endif
+// <o> NRF_BLE_GQ_QUEUE_SIZE - Number of requests the queue can hold.
+#ifndef NRF_BLE_GQ_QUEUE_SIZE
+#define NRF_BLE_GQ_QUEUE_SIZE 4
+#endif
+
+// <o> NRF_BLE_GQ_DATAPOOL_ELEMENT_SIZE - Default size of a single element in the pool of memory objects.
+#ifndef NRF_BLE_GQ_DATAPOOL_ELEMENT_SIZE
+#define NRF_BLE_GQ_DATAPOOL_ELEMENT_SIZE 20
+#endif
+
+// <o> NRF_BLE_GQ_DATAPOOL_ELEMENT_COUNT - Default number of elements in the pool of memory objects.
+#ifndef NRF_BLE_GQ_DATAPOOL_ELEMENT_COUNT
+#define NRF_BLE_GQ_DATAPOOL_ELEMENT_COUNT 8
+#endif
+
+// <o> NRF_BLE_GQ_GATTC_WRITE_MAX_DATA_LEN - Maximal size of the data inside GATTC write request (in bytes).
+#ifndef NRF_BLE_GQ_GATTC_WRITE_MAX_DATA_LEN
+#define NRF_BLE_GQ_GATTC_WRITE_MAX_DATA_LEN 16
+#endif
+
+// <o> NRF_BLE_GQ_GATTS_HVX_MAX_DATA_LEN - Maximal size of the data inside GATTC notification or indication request (in bytes).
+#ifndef NRF_BLE_GQ_GATTS_HVX_MAX_DATA_LEN
+#define NRF_BLE_GQ_GATTS_HVX_MAX_DATA_LEN 16
+#endif
+
+// </e>
+
 // <e> NRF_BLE_QWR_ENABLED - nrf_ble_qwr - Queued writes support module (prepare/execute write)
 //==========================================================
 #ifndef NRF_BLE_QWR_ENABLED
@@ -1072,6 +1125,55 @@
 
 // </e>
 
+// <e> NRF_CRYPTO_BACKEND_NRF_HW_AES_ENABLED - Enable the nRF HW AES backend.
+
+// <i> The nRF HW backend provides AES-128 using the ECB and CCM peripherals in nRF5x devices. The SoftDevice ECB API is used while the SoftDevice is enabled.
+//==========================================================
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_ENABLED 0
+#endif
+// <q> NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR_ENABLED  - nRF HW AES CTR mode support.
+
+// <i> Enable nRF HW AES CTR mode support. Only 128-bit keys are supported.
+
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB_ENABLED  - nRF HW AES ECB mode support.
+
+// <i> Enable nRF HW AES ECB mode support. Only 128-bit keys are supported. Decryption is done in software.
+
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC_ENABLED  - nRF HW AES CBC MAC mode support.
+
+// <i> Enable nRF HW AES CBC MAC mode support. Only 128-bit keys are supported.
+
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_ENABLED  - nRF HW AES CCM mode support.
+
+// <i> Enable nRF HW AES CCM mode support. Only 128-bit keys are supported.
+
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_PERIPHERAL_ENABLED  - Use the CCM peripheral for AES CCM.
+
+// <i> Messages with a 13-byte nonce, a 4-byte MAC, one byte of additional data and up to 251 bytes of payload are processed by the CCM peripheral when the SoftDevice is not enabled. Uses about 800 bytes of RAM.
+
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_PERIPHERAL_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_PERIPHERAL_ENABLED 1
+#endif
+
+// </e>
+
 // <e> NRF_CRYPTO_BACKEND_NRF_SW_ENABLED - Enable the legacy nRFx sw for crypto.
 
 // <i> The nRF SW cryptography backend (only used in bootloader context).
@@ -5810,6 +5912,28 @@
 #define APP_SCHEDULER_WITH_PROFILER 0
 #endif
 
+// <e> APP_SCHEDULER_WITH_LANES - Enabling priority lanes
+// <i> Events are put into one of several lanes which are served strictly by priority
+// <i> (lane 0 first). Putting events is lock-free. Requires nrf_atfifo.
+//==========================================================
+#ifndef APP_SCHEDULER_WITH_LANES
+#define APP_SCHEDULER_WITH_LANES 0
+#endif
+// <o> APP_SCHEDULER_LANES_COUNT - Number of priority lanes  <1-8>
+
+#ifndef APP_SCHEDULER_LANES_COUNT
+#define APP_SCHEDULER_LANES_COUNT 3
+#endif
+
+// <o> APP_SCHEDULER_DEFAULT_LANE - Lane used by app_sched_event_put  <0-7>
+// <i> Must be lower than APP_SCHEDULER_LANES_COUNT.
+
+#ifndef APP_SCHEDULER_DEFAULT_LANE
+#define APP_SCHEDULER_DEFAULT_LANE 2
+#endif
+
+// </e>
+
 // </e>
 
 // <e> APP_SDCARD_ENABLED - app_sdcard - SD/MMC card support using SPI
@@ -5927,6 +6051,30 @@
 #define APP_TIMER_SAFE_WINDOW_MS 300000
 #endif
 
+// <e> APP_TIMER_CONFIG_USE_TIMING_WHEEL - Keep active timers on hierarchical timing wheel
+// <i> Timers are kept on timing wheel instead of sorted list. Starting and stopping
+// <i> timer takes constant time regardless of number of active timers.
+//==========================================================
+#ifndef APP_TIMER_CONFIG_USE_TIMING_WHEEL
+#define APP_TIMER_CONFIG_USE_TIMING_WHEEL 0
+#endif
+// <o> APP_TIMER_CONFIG_WHEEL_SLOT_BITS - Number of timestamp bits resolved by one wheel level  <1-5>
+// <i> Each level has 2^APP_TIMER_CONFIG_WHEEL_SLOT_BITS slots.
+
+#ifndef APP_TIMER_CONFIG_WHEEL_SLOT_BITS
+#define APP_TIMER_CONFIG_WHEEL_SLOT_BITS 4
+#endif
+
+// <o> APP_TIMER_CONFIG_WHEEL_LEVELS - Number of wheel levels
+// <i> Timers longer than 2^(APP_TIMER_CONFIG_WHEEL_SLOT_BITS * APP_TIMER_CONFIG_WHEEL_LEVELS)
+// <i> ticks are kept on separate list and put on the wheel when they get closer.
+
+#ifndef APP_TIMER_CONFIG_WHEEL_LEVELS
+#define APP_TIMER_CONFIG_WHEEL_LEVELS 6
+#endif
+
+// </e>
+
 // <h> App Timer Legacy configuration - Legacy configuration.
 
 //==========================================================
@@ -6326,7 +6474,7 @@
 // <i> As a result the reserved space can be used by other modules.
 
 #ifndef FDS_VIRTUAL_PAGES_RESERVED
-#define FDS_VIRTUAL_PAGES_RESERVED 0
+#define FDS_VIRTUAL_PAGES_RESERVED 16
 #endif
 
 // </h>
@@ -6718,6 +6866,16 @@
 
 // </e>
 
+// <q> NRF_BALLOC_CONFIG_LOCK_FREE  - Use a lock-free free list instead of critical sections.
+
+// <i> Allocation and freeing do not disable interrupts. Used only when
+// <i> NRF_BALLOC_CONFIG_DEBUG_ENABLED is disabled, because the debug checks need a
+// <i> consistent view of the free list.
+
+#ifndef NRF_BALLOC_CONFIG_LOCK_FREE
+#define NRF_BALLOC_CONFIG_LOCK_FREE 1
+#endif
+
 // </e>
 
 // <e> NRF_CSENSE_ENABLED - nrf_csense - Capacitive sensor module
@@ -6824,7 +6982,7 @@
 // <i> Increase this value if API calls frequently return the error @ref NRF_ERROR_NO_MEM.
 
 #ifndef NRF_FSTORAGE_SD_QUEUE_SIZE
-#define NRF_FSTORAGE_SD_QUEUE_SIZE 4
+#define NRF_FSTORAGE_SD_QUEUE_SIZE 8
 #endif
 
 // <o> NRF_FSTORAGE_SD_MAX_RETRIES - Maximum number of attempts at executing an operation when the SoftDevice is busy
@@ -6968,7 +7126,7 @@
 // <e> NRF_QUEUE_ENABLED - nrf_queue - Queue module
 //==========================================================
 #ifndef NRF_QUEUE_ENABLED
-#define NRF_QUEUE_ENABLED 0
+#define NRF_QUEUE_ENABLED 1
 #endif
 // <q> NRF_QUEUE_CLI_CMDS  - Enable CLI commands specific to the module
 
@@ -7378,6 +7536,16 @@
 #define NRF_LOG_DEFERRED 1
 #endif
 
+// <q> NRF_LOG_DICTIONARY_MODE  - Enable dictionary (binary) logging.
+
+// <i> Backends send raw entries (module ID, format string address, arguments,
+// <i> timestamp) instead of formatted text. Format strings are kept in the
+// <i> non-loaded log_strings section of the ELF file and are decoded on the host.
+
+#ifndef NRF_LOG_DICTIONARY_MODE
+#define NRF_LOG_DICTIONARY_MODE 0
+#endif
+
 // <q> NRF_LOG_FILTERS_ENABLED  - Enable dynamic filtering of logs.
 
 #ifndef NRF_LOG_FILTERS_ENABLED
@@ -608,6 +608,60 @@
 
 // </e>
 
+// <e> NRF_CRYPTO_BACKEND_NRF_HW_AES_ENABLED - Enable the nRF HW AES backend.
+
+// <i> The nRF HW backend provides AES-128 using the ECB and CCM peripherals in nRF5x devices. The SoftDevice ECB API is used while the SoftDevice is enabled.
+//==========================================================
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_ENABLED 1
+#endif
+// <q> NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR_ENABLED  - nRF HW AES CTR mode support.
+ 
+
+// <i> Enable nRF HW AES CTR mode support. Only 128-bit keys are supported.
+
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_CTR_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB_ENABLED  - nRF HW AES ECB mode support.
+ 
+
+// <i> Enable nRF HW AES ECB mode support. Only 128-bit keys are supported. Decryption is done in software.
+
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_ECB_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC_ENABLED  - nRF HW AES CBC MAC mode support.
+ 
+
+// <i> Enable nRF HW AES CBC MAC mode support. Only 128-bit keys are supported.
+
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_CBC_MAC_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_ENABLED  - nRF HW AES CCM mode support.
+ 
+
+// <i> Enable nRF HW AES CCM mode support. Only 128-bit keys are supported.
+
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_ENABLED 1
+#endif
+
+// <q> NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_PERIPHERAL_ENABLED  - Use the CCM peripheral for AES CCM.
+ 
+
+// <i> Messages with a 13-byte nonce, a 4-byte MAC, one byte of additional data and up to 251 bytes of payload are processed by the CCM peripheral when the SoftDevice is not enabled. Uses about 800 bytes of RAM.
+
+#ifndef NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_PERIPHERAL_ENABLED
+#define NRF_CRYPTO_BACKEND_NRF_HW_AES_CCM_PERIPHERAL_ENABLED 1
+#endif
+
+// </e>
+
 // <e> NRF_CRYPTO_BACKEND_NRF_HW_RNG_ENABLED - Enable the nRF HW RNG backend.
 
 // <i> The nRF HW backend provide access to RNG peripheral in nRF5x devices.
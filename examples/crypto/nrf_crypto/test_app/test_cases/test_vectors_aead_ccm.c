@@ -58,6 +58,14 @@
 
 #if NRF_MODULE_ENABLED(NRF_CRYPTO_AES_CCM)
 
+/* Backends that return NRF_ERROR_CRYPTO_AEAD_INVALID_MAC and clear the generated plaintext when
+   the MAC check fails. */
+#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS) || NRF_MODULE_ENABLED(NRF_CRYPTO_NRF_HW_AES_AEAD)
+#define CCM_INVALID_MAC_REPORTED    1
+#else
+#define CCM_INVALID_MAC_REPORTED    0
+#endif
+
 /*lint -save -e91 */
 
 #if NRF_MODULE_ENABLED(NRF_CRYPTO_AES_CCM_128)
@@ -83,7 +91,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_data, test_vector_aead_t test_vector_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_ccm_128_inv_c19) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -104,7 +112,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_ccm_128_inv_c20) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
     .crypt_expected_result  = EXPECTED_TO_FAIL,  // Generated plaintext will be incorrect.
 #else
@@ -143,7 +151,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_ccm_128_inv_c22) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -181,7 +189,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_ccm_128_inv_c24) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -816,7 +824,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt_1) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -837,7 +845,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt_2) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -876,7 +884,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt16) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -897,7 +905,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt17) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -936,7 +944,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt31) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -957,7 +965,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt32) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -995,7 +1003,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt46) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1016,7 +1024,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt47) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1055,7 +1063,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt61) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1076,7 +1084,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt62) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1114,7 +1122,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt76) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1135,7 +1143,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt77) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1173,7 +1181,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt121) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1194,7 +1202,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt122) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1232,7 +1240,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt136) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1253,7 +1261,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt137) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1291,7 +1299,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt181) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1312,7 +1320,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt182) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1350,7 +1358,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt196) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1371,7 +1379,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt197) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1409,7 +1417,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt211) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1430,7 +1438,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_128_decrypt212) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1447,6 +1455,57 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
     .p_mac                  = "0bf6688e"
 };
 
+// AES CCM - Custom test vector - timing
+NRF_SECTION_ITEM_REGISTER(test_vector_aead_data, test_vector_aead_t test_vector_aes_ccm_128_timing) =
+{
+    .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
+    .expected_err_code      = NRF_SUCCESS,
+    .crypt_expected_result  = EXPECTED_TO_PASS,
+    .mac_expected_result    = EXPECTED_TO_PASS,
+    .direction              = NRF_CRYPTO_ENCRYPT,
+    .p_test_vector_name     = "CCM 128 Encrypt Timing message_len=256 ad_len=16 mac_len=16 nonce_len=13",
+    .p_plaintext            = "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f404142434445464748494a4b4c4d4e4f505152535455565758595a5b5c5d5e5f606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9fa0a1a2a3a4a5a6a7a8a9aaabacadaeafb0b1b2b3b4b5b6b7b8b9babbbcbdbebfc0c1c2c3c4c5c6c7c8c9cacbcccdcecfd0d1d2d3d4d5d6d7d8d9dadbdcdddedfe0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff",
+    .p_ciphertext           = "50849f9269ce6bdae87ec8dad8e1919865576369d2cb8ce87c15861dc27013903e03b709c81a4dac9a873874dbceb6435c85d8b96124e456eddd1330bbbeb0e6cf9a90952e75221813c9b7ab34e097f6d035aca8a82e541acbf72db931455cacf987c51006094e406d245765259dd6e22ec5faa559d8fc57a1a25afaf9134e5542f28fd9182571e854e5e604b6af06053e1ea736f16f779f1951462d5b3f14ffbca00c381266a5bc1995c9434f6f651821dffb62b28f3971bd1490c18f877e50cbc2b4d90bf57cbd40b3854b0448d3220cc8d8cf1f0b482f96093798ad2017aa0adf74d98f53b5348875c7040b619997c49d75b76dd2ff5f078f49a211eb23d7",
+    .p_key                  = "c0c1c2c3c4c5c6c7c8c9cacbcccdcecf",
+    .p_ad                   = "000102030405060708090a0b0c0d0e0f",
+    .p_nonce                = "00000003020100a0a1a2a3a4a5",
+    .p_mac                  = "c1f04a9644b1765fff65c010e1f2e9e5"
+};
+
+// AES CCM - Custom test vector - timing, shaped like a BLE link layer packet
+NRF_SECTION_ITEM_REGISTER(test_vector_aead_data, test_vector_aead_t test_vector_aes_ccm_128_ble_encrypt_timing) =
+{
+    .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
+    .expected_err_code      = NRF_SUCCESS,
+    .crypt_expected_result  = EXPECTED_TO_PASS,
+    .mac_expected_result    = EXPECTED_TO_PASS,
+    .direction              = NRF_CRYPTO_ENCRYPT,
+    .p_test_vector_name     = "CCM 128 Encrypt Timing BLE packet message_len=27 ad_len=1 mac_len=4 nonce_len=13",
+    .p_plaintext            = "000102030405060708090a0b0c0d0e0f101112131415161718191a",
+    .p_ciphertext           = "6ff1388d0d92d4172b4f8c8234eec46e1871354202536ae163b395",
+    .p_key                  = "c0c1c2c3c4c5c6c7c8c9cacbcccdcecf",
+    .p_ad                   = "02",
+    .p_nonce                = "010000008024abdcbabebaafde",
+    .p_mac                  = "d98001f6"
+};
+
+// AES CCM - Custom test vector - timing, shaped like a BLE link layer packet
+NRF_SECTION_ITEM_REGISTER(test_vector_aead_data, test_vector_aead_t test_vector_aes_ccm_128_ble_decrypt_timing) =
+{
+    .p_aead_info            = &g_nrf_crypto_aes_ccm_128_info,
+    .expected_err_code      = NRF_SUCCESS,
+    .crypt_expected_result  = EXPECTED_TO_PASS,
+    .mac_expected_result    = EXPECTED_TO_PASS,
+    .direction              = NRF_CRYPTO_DECRYPT,
+    .p_test_vector_name     = "CCM 128 Decrypt Timing BLE packet message_len=27 ad_len=1 mac_len=4 nonce_len=13",
+    .p_plaintext            = "000102030405060708090a0b0c0d0e0f101112131415161718191a",
+    .p_ciphertext           = "6ff1388d0d92d4172b4f8c8234eec46e1871354202536ae163b395",
+    .p_key                  = "c0c1c2c3c4c5c6c7c8c9cacbcccdcecf",
+    .p_ad                   = "02",
+    .p_nonce                = "010000008024abdcbabebaafde",
+    .p_mac                  = "d98001f6"
+};
+
 #endif // NRF_MODULE_ENABLED(NRF_CRYPTO_AES_CCM_128)
 
 #if NRF_MODULE_ENABLED(NRF_CRYPTO_AES_CCM_STAR_128)
@@ -1881,7 +1940,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_data, test_vector_aead_t test_vector_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_ccm_192_inv_c19) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1902,7 +1961,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_ccm_192_inv_c20) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
     .crypt_expected_result  = EXPECTED_TO_FAIL,  // Generated plaintext will be incorrect.
 #else
@@ -1941,7 +2000,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_ccm_192_inv_c22) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -1979,7 +2038,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_ccm_192_inv_c24) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -2610,7 +2669,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt1) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -2631,7 +2690,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt2) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -2669,7 +2728,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt16) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -2690,7 +2749,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt17) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -2728,7 +2787,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt31) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -2749,7 +2808,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt32) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -2787,7 +2846,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt46) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -2808,7 +2867,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt47) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -2846,7 +2905,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt61) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -2867,7 +2926,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt62) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -2905,7 +2964,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt76) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -2926,7 +2985,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt77) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -2964,7 +3023,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt121) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -2985,7 +3044,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt122) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -3023,7 +3082,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt136) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -3044,7 +3103,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt137) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -3082,7 +3141,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt181) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -3103,7 +3162,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt182) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -3141,7 +3200,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt196) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -3162,7 +3221,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt197) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -3200,7 +3259,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt211) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -3221,7 +3280,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_192_decrypt212) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_192_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -3263,7 +3322,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_data, test_vector_aead_t test_vector_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_ccm_256_inv_c19) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -3284,7 +3343,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_ccm_256_inv_c20) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
     .crypt_expected_result  = EXPECTED_TO_FAIL,  // Generated plaintext will be incorrect.
 #else
@@ -3323,7 +3382,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_ccm_256_inv_c22) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -3361,7 +3420,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_ccm_256_inv_c24) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -3993,7 +4052,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt1) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4014,7 +4073,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt2) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4052,7 +4111,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt16) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4073,7 +4132,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt17) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4111,7 +4170,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt31) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4132,7 +4191,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt32) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4170,7 +4229,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt46) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4191,7 +4250,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt47) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4229,7 +4288,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt61) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4250,7 +4309,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt62) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4288,7 +4347,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt76) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4309,7 +4368,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt77) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4347,7 +4406,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt121) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4368,7 +4427,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt122) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4406,7 +4465,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt136) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4427,7 +4486,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt137) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4465,7 +4524,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt181) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4486,7 +4545,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt182) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4524,7 +4583,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt196) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4545,7 +4604,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt197) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4583,7 +4642,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt211) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
@@ -4604,7 +4663,7 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_
 NRF_SECTION_ITEM_REGISTER(test_vector_aead_simple_data, test_vector_aead_t test_vector_aes_aead_ccm_256_decrypt212) =
 {
     .p_aead_info            = &g_nrf_crypto_aes_ccm_256_info,
-#if NRF_MODULE_ENABLED(NRF_CRYPTO_BACKEND_MBEDTLS)
+#if CCM_INVALID_MAC_REPORTED
     .expected_err_code      = NRF_ERROR_CRYPTO_AEAD_INVALID_MAC,
 #else
     .expected_err_code      = NRF_ERROR_CRYPTO_INTERNAL,
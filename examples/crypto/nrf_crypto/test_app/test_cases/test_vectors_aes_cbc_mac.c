@@ -116,6 +116,20 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aes_mac_data, test_vector_aes_t test_vecto
     .p_iv               = "00000000000000000000000000000000"
 };
 
+// AES CBC MAC - Custom test vector - timing
+NRF_SECTION_ITEM_REGISTER(test_vector_aes_mac_data, test_vector_aes_t test_vector_aes_cbc_mac_128_timing) =
+{
+    .p_aes_info         = &g_nrf_crypto_aes_cbc_mac_128_info,
+    .expected_err_code  = NRF_SUCCESS,
+    .expected_result    = EXPECTED_TO_PASS,
+    .direction          = NRF_CRYPTO_ENCRYPT,
+    .p_test_vector_name = "CBC MAC 128 Timing message_len=256",
+    .p_plaintext        = "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f404142434445464748494a4b4c4d4e4f505152535455565758595a5b5c5d5e5f606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9fa0a1a2a3a4a5a6a7a8a9aaabacadaeafb0b1b2b3b4b5b6b7b8b9babbbcbdbebfc0c1c2c3c4c5c6c7c8c9cacbcccdcecfd0d1d2d3d4d5d6d7d8d9dadbdcdddedfe0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff",
+    .p_ciphertext       = "8f051055035cbd6b7397ca3224e78e65",
+    .p_key              = "2b7e151628aed2a6abf7158809cf4f3c",
+    .p_iv               = "00000000000000000000000000000000"
+};
+
 #endif // NRF_MODULE_ENABLED(NRF_CRYPTO_AES_CBC_MAC_128)
 
 #if NRF_MODULE_ENABLED(NRF_CRYPTO_AES_CBC_MAC_192)
@@ -298,6 +298,20 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aes_data, test_vector_aes_t test_vector_ae
     .p_ad               = "00000000000000000000000000000000"
 };
 
+// AES CTR - Custom test vector - timing
+NRF_SECTION_ITEM_REGISTER(test_vector_aes_data, test_vector_aes_t test_vector_aes_ctr_128_encrypt_timing) =
+{
+    .p_aes_info         = &g_nrf_crypto_aes_ctr_128_info,
+    .expected_err_code  = NRF_SUCCESS,
+    .expected_result    = EXPECTED_TO_PASS,
+    .direction          = NRF_CRYPTO_ENCRYPT,
+    .p_test_vector_name = "CTR 128 Encrypt Timing message_len=256",
+    .p_plaintext        = "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f404142434445464748494a4b4c4d4e4f505152535455565758595a5b5c5d5e5f606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9fa0a1a2a3a4a5a6a7a8a9aaabacadaeafb0b1b2b3b4b5b6b7b8b9babbbcbdbebfc0c1c2c3c4c5c6c7c8c9cacbcccdcecfd0d1d2d3d4d5d6d7d8d9dadbdcdddedfe0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff",
+    .p_ciphertext       = "ec8ddd709c657ab7fadb1c7ee693afeb263a6e2f7366477400b96dcce04d6db14a0de15b5cac1168969de2303b97426bd8ad0bacc4c4aef1ec330be0295195c1f04c05bb50cfd749b8217adcdc06eb4d08c8160919b457a24b938bc321d4b7445bb8ce1a2dbb4d9e0d00c6532f951c2d0debbcf333b6257e6d23c2d38cf8e9ce371d3ba5c46bce101d26bc9ea63e78b4ead3fde5192c737f842c52d5ebd053b20d01ef448c882579f0c77e2ea63e21bafd93035266049e234218451d6831de8cc51b5c3c0d27b820be3e571d7ac3563e4ef01c49bbb0fdc4da127b2df9a4c92904f7b6051fa5c850fa98201c07f4f03cdd6f8cbd702484b0900164c9fd40dd86",
+    .p_key              = ctr_128_key,
+    .p_iv               = ctr_counter_1
+};
+
 #endif // NRF_MODULE_ENABLED(NRF_CRYPTO_AES_CTR_128)
 
 #if NRF_MODULE_ENABLED(NRF_CRYPTO_AES_CTR_192)
@@ -570,6 +570,32 @@ NRF_SECTION_ITEM_REGISTER(test_vector_aes_data, test_vector_aes_t test_vector_ae
     .p_key              = "44f0ee626d0446e0a3924cfb078944bb"
 };
 
+// AES ECB - Custom test vector - timing
+NRF_SECTION_ITEM_REGISTER(test_vector_aes_data, test_vector_aes_t test_vector_aes_ecb_128_encrypt_timing) =
+{
+    .p_aes_info         = &g_nrf_crypto_aes_ecb_128_info,
+    .expected_err_code  = NRF_SUCCESS,
+    .expected_result    = EXPECTED_TO_PASS,
+    .direction          = NRF_CRYPTO_ENCRYPT,
+    .p_test_vector_name = "ECB 128 Encrypt Timing message_len=256",
+    .p_plaintext        = "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f404142434445464748494a4b4c4d4e4f505152535455565758595a5b5c5d5e5f606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9fa0a1a2a3a4a5a6a7a8a9aaabacadaeafb0b1b2b3b4b5b6b7b8b9babbbcbdbebfc0c1c2c3c4c5c6c7c8c9cacbcccdcecfd0d1d2d3d4d5d6d7d8d9dadbdcdddedfe0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff",
+    .p_ciphertext       = "50fe67cc996d32b6da0937e99bafec60c84af0b613435d5d9182801a9bd9320b25f33f023d8e724c675044e80b1934985ce99ca02f4e9733f193bf28000bd44c576076a2e3950d73f8e9bf794a7b5d95c34ab882088b5393daa9a661d69034366f8db13c3b464e73ddf4e248ed2967933459d4ca18c19941b910aea3c3490777637175e242b86544733697827da6de91f96dd3e427dae3a4b2ce3678d0ccb5a4c0234de8db1fbebbd9abbbd5f033c2a09fa549baf7dd513b15762222ecfe316e758d4d380b64237d308d82b0e810c65f4607cd680690e26d9fba228d8369d7f1f6a3569dea3cda208eb3d5792942612bec8cdf7398607cb0f2d21675ea9ea1e4",
+    .p_key              = "2b7e151628aed2a6abf7158809cf4f3c"
+};
+
+// AES ECB - Custom test vector - timing
+NRF_SECTION_ITEM_REGISTER(test_vector_aes_data, test_vector_aes_t test_vector_aes_ecb_128_decrypt_timing) =
+{
+    .p_aes_info         = &g_nrf_crypto_aes_ecb_128_info,
+    .expected_err_code  = NRF_SUCCESS,
+    .expected_result    = EXPECTED_TO_PASS,
+    .direction          = NRF_CRYPTO_DECRYPT,
+    .p_test_vector_name = "ECB 128 Decrypt Timing message_len=256",
+    .p_plaintext        = "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f404142434445464748494a4b4c4d4e4f505152535455565758595a5b5c5d5e5f606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9fa0a1a2a3a4a5a6a7a8a9aaabacadaeafb0b1b2b3b4b5b6b7b8b9babbbcbdbebfc0c1c2c3c4c5c6c7c8c9cacbcccdcecfd0d1d2d3d4d5d6d7d8d9dadbdcdddedfe0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff",
+    .p_ciphertext       = "50fe67cc996d32b6da0937e99bafec60c84af0b613435d5d9182801a9bd9320b25f33f023d8e724c675044e80b1934985ce99ca02f4e9733f193bf28000bd44c576076a2e3950d73f8e9bf794a7b5d95c34ab882088b5393daa9a661d69034366f8db13c3b464e73ddf4e248ed2967933459d4ca18c19941b910aea3c3490777637175e242b86544733697827da6de91f96dd3e427dae3a4b2ce3678d0ccb5a4c0234de8db1fbebbd9abbbd5f033c2a09fa549baf7dd513b15762222ecfe316e758d4d380b64237d308d82b0e810c65f4607cd680690e26d9fba228d8369d7f1f6a3569dea3cda208eb3d5792942612bec8cdf7398607cb0f2d21675ea9ea1e4",
+    .p_key              = "2b7e151628aed2a6abf7158809cf4f3c"
+};
+
 
 
 // AES ECB Multi - NIST CAVS 11.1 Monte Carlo Encrypt 128
@@ -1287,6 +1287,17 @@
 #define NRF_DFU_APP_DATA_AREA_SIZE 12288
 #endif
 
+// <q> NRF_DFU_ECDSA_FIXED_KEY  - Verify signatures with precomputed tables for the built-in public key.
+ 
+
+// <i> Replaces the generic nrf_crypto ECDSA verification of init packets and,
+// <i> if NRF_BL_APP_SIGNATURE_CHECK_REQUIRED is enabled, of the app at boot.
+// <i> Uses 960 bytes of RAM for the public key table, computed once on first use.
+
+#ifndef NRF_DFU_ECDSA_FIXED_KEY
+#define NRF_DFU_ECDSA_FIXED_KEY 1
+#endif
+
 // <q> NRF_DFU_IN_APP  - Specifies that this code is in the app, not the bootloader, so some settings are off-limits.
  
 
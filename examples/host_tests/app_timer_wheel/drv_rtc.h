@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @brief Host stand-in for the RTC driver of app_timer.
+ *
+ * @details The test drives the timing wheel directly, so the RTC is only modeled as a counter
+ *          that the test sets in @ref host_rtc_counter.
+ */
+
+#ifndef DRV_RTC_H__
+#define DRV_RTC_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "nrf.h"
+#include "sdk_errors.h"
+
+#define NRFX_SUCCESS             NRF_SUCCESS
+
+#define DRV_RTC_MAX_CNT          RTC_COUNTER_COUNTER_Msk
+#define DRV_RTC_MIN_TICK_HANDLED 3
+
+typedef struct
+{
+    uint8_t instance_id;
+} drv_rtc_t;
+
+#define DRV_RTC_INSTANCE(id) { .instance_id = (id) }
+
+typedef struct
+{
+    uint16_t prescaler;
+    uint8_t  interrupt_priority;
+} drv_rtc_config_t;
+
+typedef void (*drv_rtc_handler_t)(drv_rtc_t const * const  p_instance);
+
+/**@brief Current value of the modeled RTC counter. */
+extern uint32_t host_rtc_counter;
+
+static inline ret_code_t drv_rtc_init(drv_rtc_t const * const  p_instance,
+                                      drv_rtc_config_t const * p_config,
+                                      drv_rtc_handler_t        handler)
+{
+    (void)p_instance;
+    (void)p_config;
+    (void)handler;
+    return NRF_SUCCESS;
+}
+
+static inline void drv_rtc_start(drv_rtc_t const * const p_instance)
+{
+    (void)p_instance;
+}
+
+static inline void drv_rtc_stop(drv_rtc_t const * const p_instance)
+{
+    (void)p_instance;
+}
+
+static inline void drv_rtc_compare_set(drv_rtc_t const * const p_instance,
+                                       uint32_t                cc,
+                                       uint32_t                abs_value,
+                                       bool                    irq_enable)
+{
+    (void)p_instance;
+    (void)cc;
+    (void)abs_value;
+    (void)irq_enable;
+}
+
+static inline ret_code_t drv_rtc_windowed_compare_set(drv_rtc_t const * const p_instance,
+                                                      uint32_t                cc,
+                                                      uint32_t                abs_value,
+                                                      uint32_t                safe_window)
+{
+    (void)p_instance;
+    (void)cc;
+    (void)abs_value;
+    (void)safe_window;
+    return NRF_SUCCESS;
+}
+
+static inline void drv_rtc_overflow_enable(drv_rtc_t const * const p_instance, bool irq_enable)
+{
+    (void)p_instance;
+    (void)irq_enable;
+}
+
+static inline bool drv_rtc_overflow_pending(drv_rtc_t const * const p_instance)
+{
+    (void)p_instance;
+    return false;
+}
+
+static inline void drv_rtc_compare_disable(drv_rtc_t const * const p_instance, uint32_t cc)
+{
+    (void)p_instance;
+    (void)cc;
+}
+
+static inline bool drv_rtc_compare_pending(drv_rtc_t const * const p_instance, uint32_t cc)
+{
+    (void)p_instance;
+    (void)cc;
+    return false;
+}
+
+static inline uint32_t drv_rtc_compare_get(drv_rtc_t const * const p_instance, uint32_t cc)
+{
+    (void)p_instance;
+    (void)cc;
+    return 0;
+}
+
+static inline uint32_t drv_rtc_counter_get(drv_rtc_t const * const p_instance)
+{
+    (void)p_instance;
+    return host_rtc_counter;
+}
+
+static inline void drv_rtc_irq_trigger(drv_rtc_t const * const p_instance)
+{
+    (void)p_instance;
+}
+
+#endif // DRV_RTC_H__
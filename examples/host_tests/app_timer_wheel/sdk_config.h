@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef SDK_CONFIG_H
+#define SDK_CONFIG_H
+
+#define APP_TIMER_ENABLED                  1
+#define APP_TIMER_CONFIG_RTC_FREQUENCY     0
+#define APP_TIMER_CONFIG_IRQ_PRIORITY      6
+#define APP_TIMER_CONFIG_OP_QUEUE_SIZE     10
+#define APP_TIMER_CONFIG_USE_SCHEDULER     0
+#define APP_TIMER_KEEPS_RTC_ACTIVE         0
+#define APP_TIMER_SAFE_WINDOW_MS           300000
+#define APP_TIMER_WITH_PROFILER            0
+#define APP_TIMER_CONFIG_USE_TIMING_WHEEL  1
+#define APP_TIMER_CONFIG_WHEEL_SLOT_BITS   4
+#define APP_TIMER_CONFIG_WHEEL_LEVELS      6
+#define APP_TIMER_CONFIG_LOG_ENABLED       0
+
+#define NRF_SORTLIST_ENABLED               1
+#define NRF_SORTLIST_CONFIG_LOG_ENABLED    0
+
+#define NRF_LOG_ENABLED                    0
+
+#endif // SDK_CONFIG_H
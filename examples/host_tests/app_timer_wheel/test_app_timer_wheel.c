@@ -0,0 +1,220 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @brief Test and benchmark of the timing wheel backend of app_timer2.
+ *
+ * @details The wheel is checked against the end values of the timers: every timer which is not
+ *          stopped must reach the due list in the step in which the wheel time passes its end
+ *          value. Start and stop are then timed for thousands of timers, next to the sorted list
+ *          which the other backend uses.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "host_test.h"
+#include "nrf_sortlist.h"
+#include "drv_rtc.h"    // Stand-in from the test directory, included before the module does.
+
+/* The wheel functions are static, so the module is built as part of the test. */
+#include "app_timer2.c"
+
+#define TIMER_COUNT     4096
+#define TIMEOUT_MAX     (1UL << 26)     /**< Longer than the wheel span, so the far list is used. */
+#define STEP_MAX        (1UL << 10)     /**< Largest short step of the wheel time. */
+#define LONG_STEP_MAX   (1UL << 22)     /**< Largest long step, which cascades several levels at once. */
+
+uint32_t host_rtc_counter;
+
+static app_timer_t m_timers[TIMER_COUNT];
+static bool        m_stopped[TIMER_COUNT];
+static bool        m_expired[TIMER_COUNT];
+static uint64_t    m_timeouts[TIMER_COUNT];
+
+/* The request FIFO and the RTC interrupt are not used by the test. */
+ret_code_t nrf_atfifo_init(nrf_atfifo_t * const p_fifo, void * p_buf, uint16_t buf_size, uint16_t item_size)
+{
+    return NRF_SUCCESS;
+}
+
+void * nrf_atfifo_item_alloc(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_put_t * p_context)
+{
+    return NULL;
+}
+
+bool nrf_atfifo_item_put(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_put_t * p_context)
+{
+    return false;
+}
+
+void * nrf_atfifo_item_get(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_get_t * p_context)
+{
+    return NULL;
+}
+
+bool nrf_atfifo_item_free(nrf_atfifo_t * const p_fifo, nrf_atfifo_item_get_t * p_context)
+{
+    return false;
+}
+
+
+static void wheel_reset(uint64_t now)
+{
+    memset(&m_wheel, 0, sizeof(m_wheel));
+    m_wheel.now = now;
+}
+
+
+static void timer_start(uint32_t idx, uint64_t end_val)
+{
+    m_timers[idx].end_val       = end_val;
+    m_timers[idx].pp_wheel_prev = NULL;
+    wheel_add(&m_timers[idx]);
+}
+
+
+static void test_wheel_expiry(void)
+{
+    uint64_t prev    = 0x123456;
+    uint32_t running = 0;
+
+    wheel_reset(prev);
+    memset(m_stopped, 0, sizeof(m_stopped));
+    memset(m_expired, 0, sizeof(m_expired));
+
+    for (uint32_t i = 0; i < TIMER_COUNT; i++)
+    {
+        timer_start(i, prev + 1 + (host_test_rand() % TIMEOUT_MAX));
+        running++;
+    }
+
+    while (running > 0 && prev <= 0x123456 + TIMEOUT_MAX)
+    {
+        uint64_t now = prev + 1 + (((host_test_rand() & 0xF) == 0) ?
+                                   (host_test_rand() % LONG_STEP_MAX) :
+                                   (host_test_rand() % STEP_MAX));
+
+        // Stop a random timer, which may have been cascaded already.
+        uint32_t idx = host_test_rand() % TIMER_COUNT;
+        if (!m_stopped[idx] && !m_expired[idx] && (host_test_rand() & 0x7) == 0)
+        {
+            HOST_TEST_CHECK(wheel_unlink(&m_timers[idx]));
+            m_stopped[idx] = true;
+            running--;
+        }
+
+        wheel_advance(now);
+
+        while (m_wheel.p_due)
+        {
+            app_timer_t * p_timer = m_wheel.p_due;
+
+            UNUSED_RETURN_VALUE(wheel_unlink(p_timer));
+            idx = (uint32_t)(p_timer - m_timers);
+            HOST_TEST_CHECK(!m_stopped[idx] && !m_expired[idx]);
+            HOST_TEST_CHECK(p_timer->end_val > prev && p_timer->end_val <= now);
+            m_expired[idx] = true;
+            running--;
+        }
+        prev = now;
+    }
+
+    uint32_t level;
+    uint32_t slot;
+
+    HOST_TEST_CHECK(running == 0);
+    HOST_TEST_CHECK(wheel_next_event_get(&level, &slot) == WHEEL_NO_EVENT);
+}
+
+
+typedef struct
+{
+    nrf_sortlist_item_t item;
+    uint64_t            end_val;
+} sorted_timer_t;
+
+static sorted_timer_t m_sorted_timers[TIMER_COUNT];
+
+/* Same ordering as the sorted list backend of app_timer2. */
+static bool sorted_compare(nrf_sortlist_item_t * p_item0, nrf_sortlist_item_t * p_item1)
+{
+    sorted_timer_t * p0 = CONTAINER_OF(p_item0, sorted_timer_t, item);
+    sorted_timer_t * p1 = CONTAINER_OF(p_item1, sorted_timer_t, item);
+
+    return p0->end_val <= p1->end_val;
+}
+
+NRF_SORTLIST_DEF(m_sortlist, sorted_compare);
+
+
+static void bench_start_stop(uint32_t count)
+{
+    printf("%u active timers:\n", count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        m_timeouts[i] = 1 + (host_test_rand() % TIMEOUT_MAX);
+    }
+
+    wheel_reset(0);
+    HOST_TEST_BENCH("wheel start", i, count, timer_start(i, m_timeouts[i]));
+    HOST_TEST_BENCH("wheel stop", i, count, UNUSED_RETURN_VALUE(wheel_unlink(&m_timers[i])));
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        m_sorted_timers[i].end_val = m_timeouts[i];
+    }
+    HOST_TEST_BENCH("sorted list start", i, count, nrf_sortlist_add(&m_sortlist, &m_sorted_timers[i].item));
+    HOST_TEST_BENCH("sorted list stop", i, count,
+                    UNUSED_RETURN_VALUE(nrf_sortlist_remove(&m_sortlist, &m_sorted_timers[i].item)));
+
+    HOST_TEST_CHECK(nrf_sortlist_peek(&m_sortlist) == NULL);
+}
+
+
+int main(void)
+{
+    host_test_seed(28);
+
+    test_wheel_expiry();
+
+    bench_start_stop(256);
+    bench_start_stop(TIMER_COUNT);
+
+    return host_test_report("app_timer_wheel");
+}
@@ -0,0 +1,233 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @brief Multi-threaded stress test of the lock-free nrf_balloc.
+ *
+ * @details Threads allocate and free blocks of one pool concurrently. Every compare-and-swap of
+ *          the module yields the CPU at random before it swaps, which widens the window between
+ *          reading the free list head and replacing it. A stale head installed in that window
+ *          (ABA) would hand the same block to two threads. Each block therefore records its
+ *          owner, and a thread which gets a block that is already owned reports a failure.
+ */
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "host_test.h"
+
+#define THREAD_COUNT    4
+#define ITERATIONS      100000
+#define HELD_MAX        12          /**< Blocks held by one thread at a time. Together, the threads can empty the pool. */
+#define POOL_SIZE       32
+#define ELEMENT_SIZE    16
+#define BENCH_COUNT     1000000
+
+static __thread uint32_t m_thread_rand;
+
+
+static uint32_t thread_rand(void)
+{
+    // xorshift32, one state per thread
+    m_thread_rand ^= m_thread_rand << 13;
+    m_thread_rand ^= m_thread_rand >> 17;
+    m_thread_rand ^= m_thread_rand << 5;
+    return m_thread_rand;
+}
+
+
+static bool m_yield_in_cas;
+
+/**@brief Compare-and-swap that gives the other threads a chance to run before it swaps. */
+static bool yielding_compare_exchange(volatile uint32_t * p_word, uint32_t * p_expected, uint32_t desired)
+{
+    if (m_yield_in_cas && (thread_rand() & 1))
+    {
+        (void)sched_yield();
+    }
+    return __atomic_compare_exchange_n(p_word, p_expected, desired, false,
+                                       __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+/* The module is built as part of the test, with its host compare-and-swap replaced. */
+#define __atomic_compare_exchange_n(_p_word, _p_expected, _desired, _weak, _success, _failure) \
+    yielding_compare_exchange((_p_word), (_p_expected), (_desired))
+#include "nrf_balloc.c"
+#undef __atomic_compare_exchange_n
+
+NRF_BALLOC_DEF(m_pool, ELEMENT_SIZE, POOL_SIZE);
+
+static uint32_t m_owner[POOL_SIZE];     /**< Thread number + 1 of the block owner, 0 if free. */
+
+
+static void * stress_thread(void * p_context)
+{
+    uint32_t   id = (uint32_t)(uintptr_t)p_context;
+    uint32_t * held[HELD_MAX];
+    uint32_t   held_count = 0;
+
+    m_thread_rand = 0x9E3779B9 * (id + 1);
+
+    for (uint32_t i = 0; i < ITERATIONS; i++)
+    {
+        bool alloc = (held_count == 0) || ((held_count < HELD_MAX) && (thread_rand() & 1));
+
+        if (alloc)
+        {
+            uint32_t * p_block = nrf_balloc_alloc(&m_pool);
+            uint32_t   free_owner = 0;
+
+            if (p_block == NULL)
+            {
+                continue;
+            }
+
+            uint8_t idx = nrf_balloc_block2idx(&m_pool, p_block);
+            HOST_TEST_CHECK(__atomic_compare_exchange_n(&m_owner[idx], &free_owner, id + 1, false,
+                                                        __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+            for (uint32_t w = 0; w < ELEMENT_SIZE / sizeof(uint32_t); w++)
+            {
+                p_block[w] = (id << 24) | i;
+            }
+            held[held_count++] = p_block;
+        }
+        else
+        {
+            uint32_t   pick    = thread_rand() % held_count;
+            uint32_t * p_block = held[pick];
+            uint8_t    idx     = nrf_balloc_block2idx(&m_pool, p_block);
+
+            // Nobody wrote into the block while it was held.
+            for (uint32_t w = 1; w < ELEMENT_SIZE / sizeof(uint32_t); w++)
+            {
+                HOST_TEST_CHECK(p_block[w] == p_block[0] && (p_block[0] >> 24) == id);
+            }
+            HOST_TEST_CHECK(__atomic_exchange_n(&m_owner[idx], 0, __ATOMIC_SEQ_CST) == id + 1);
+
+            held[pick] = held[--held_count];
+            nrf_balloc_free(&m_pool, p_block);
+        }
+    }
+
+    while (held_count > 0)
+    {
+        uint32_t * p_block = held[--held_count];
+
+        __atomic_store_n(&m_owner[nrf_balloc_block2idx(&m_pool, p_block)], 0, __ATOMIC_SEQ_CST);
+        nrf_balloc_free(&m_pool, p_block);
+    }
+
+    return NULL;
+}
+
+
+/**@brief Function for checking that every block of the pool can be allocated exactly once. */
+static void check_pool_complete(void)
+{
+    void * blocks[POOL_SIZE];
+    bool   seen[POOL_SIZE] = {false};
+
+    HOST_TEST_CHECK(nrf_balloc_utilization_get(&m_pool) == 0);
+
+    for (uint32_t i = 0; i < POOL_SIZE; i++)
+    {
+        blocks[i] = nrf_balloc_alloc(&m_pool);
+        HOST_TEST_CHECK(blocks[i] != NULL);
+        if (blocks[i] != NULL)
+        {
+            uint8_t idx = nrf_balloc_block2idx(&m_pool, blocks[i]);
+
+            HOST_TEST_CHECK(idx < POOL_SIZE && !seen[idx]);
+            seen[idx] = true;
+        }
+    }
+    HOST_TEST_CHECK(nrf_balloc_alloc(&m_pool) == NULL);
+    HOST_TEST_CHECK(nrf_balloc_utilization_get(&m_pool) == POOL_SIZE);
+    HOST_TEST_CHECK(nrf_balloc_max_utilization_get(&m_pool) == POOL_SIZE);
+
+    for (uint32_t i = 0; i < POOL_SIZE; i++)
+    {
+        if (blocks[i] != NULL)
+        {
+            nrf_balloc_free(&m_pool, blocks[i]);
+        }
+    }
+    HOST_TEST_CHECK(nrf_balloc_utilization_get(&m_pool) == 0);
+}
+
+
+static void test_stress(bool yield_in_cas)
+{
+    pthread_t threads[THREAD_COUNT];
+    uint64_t  start = host_test_time_ns();
+
+    m_yield_in_cas = yield_in_cas;
+    for (uint32_t i = 0; i < THREAD_COUNT; i++)
+    {
+        HOST_TEST_CHECK(pthread_create(&threads[i], NULL, stress_thread, (void *)(uintptr_t)i) == 0);
+    }
+    for (uint32_t i = 0; i < THREAD_COUNT; i++)
+    {
+        HOST_TEST_CHECK(pthread_join(threads[i], NULL) == 0);
+    }
+    printf("%u threads x %u operations%s: %.1f ms\n", THREAD_COUNT, ITERATIONS,
+           yield_in_cas ? ", yielding in the swap window" : "",
+           (double)(host_test_time_ns() - start) / 1000000);
+
+    check_pool_complete();
+}
+
+
+int main(void)
+{
+    host_test_seed(35);
+
+    HOST_TEST_CHECK(nrf_balloc_init(&m_pool) == NRF_SUCCESS);
+    check_pool_complete();
+
+    test_stress(false);
+    test_stress(true);
+
+    printf("Single thread:\n");
+    m_yield_in_cas = false;
+    HOST_TEST_BENCH("alloc and free", i, BENCH_COUNT, nrf_balloc_free(&m_pool, nrf_balloc_alloc(&m_pool)));
+
+    return host_test_report("balloc");
+}
@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <time.h>
+#include "host_test.h"
+#include "app_util_platform.h"
+
+uint32_t host_test_failures;
+
+static uint32_t m_checks;
+static uint32_t m_rand_state = 1;
+
+/* Critical regions of the SDK modules exclude each other through one recursive mutex, in the same
+ * way as they exclude each other on the target by masking interrupts. */
+static pthread_mutex_t m_critical_region = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+
+void host_test_check(int passed, char const * p_expr, char const * p_file, int line)
+{
+    __atomic_add_fetch(&m_checks, 1, __ATOMIC_RELAXED);
+    if (!passed)
+    {
+        __atomic_add_fetch(&host_test_failures, 1, __ATOMIC_RELAXED);
+        printf("%s:%d: check failed: %s\n", p_file, line, p_expr);
+    }
+}
+
+
+uint64_t host_test_time_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+
+void host_test_bench_print(char const * p_name, uint64_t start, uint32_t count)
+{
+    uint64_t elapsed = host_test_time_ns() - start;
+
+    printf("  %-40s %10.1f ns/op (%u ops)\n", p_name, (double)elapsed / count, count);
+}
+
+
+void host_test_seed(uint32_t seed)
+{
+    m_rand_state = (seed != 0) ? seed : 1;
+}
+
+
+uint32_t host_test_rand(void)
+{
+    // xorshift32
+    m_rand_state ^= m_rand_state << 13;
+    m_rand_state ^= m_rand_state >> 17;
+    m_rand_state ^= m_rand_state << 5;
+    return m_rand_state;
+}
+
+
+int host_test_report(char const * p_name)
+{
+    printf("%s: %u checks, %u failed\n", p_name, m_checks, host_test_failures);
+    return (host_test_failures == 0) ? 0 : 1;
+}
+
+
+void app_util_critical_region_enter(uint8_t * p_nested)
+{
+    (void)p_nested;
+    (void)pthread_mutex_lock(&m_critical_region);
+}
+
+
+void app_util_critical_region_exit(uint8_t nested)
+{
+    (void)nested;
+    (void)pthread_mutex_unlock(&m_critical_region);
+}
+
+
+uint8_t current_int_priority_get(void)
+{
+    return APP_IRQ_PRIORITY_THREAD;
+}
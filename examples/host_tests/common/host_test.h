@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @brief Minimal harness for testing and timing SDK modules built for the host.
+ *
+ * @details Checks report the failing expression and continue, so one run lists every failure.
+ *          @ref host_test_report prints a summary and returns the exit code of the test program.
+ */
+
+#ifndef HOST_TEST_H__
+#define HOST_TEST_H__
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Number of failed checks. */
+extern uint32_t host_test_failures;
+
+/**@brief Function for recording the result of a check.
+ *
+ * @param[in] passed  Result of the check.
+ * @param[in] p_expr  Text of the checked expression.
+ * @param[in] p_file  File of the check.
+ * @param[in] line    Line of the check.
+ */
+void host_test_check(int passed, char const * p_expr, char const * p_file, int line);
+
+/**@brief Macro for checking that a condition holds. */
+#define HOST_TEST_CHECK(_cond) host_test_check(!!(_cond), #_cond, __FILE__, __LINE__)
+
+/**@brief Macro for checking that two buffers are equal. */
+#define HOST_TEST_CHECK_MEM(_a, _b, _len) \
+    host_test_check(memcmp((_a), (_b), (_len)) == 0, "memcmp(" #_a ", " #_b ")", __FILE__, __LINE__)
+
+/**@brief Function for getting a monotonic timestamp in nanoseconds. */
+uint64_t host_test_time_ns(void);
+
+/**@brief Function for printing the average time of one operation.
+ *
+ * @param[in] p_name  Name of the operation.
+ * @param[in] start   Timestamp taken before the operations, from @ref host_test_time_ns.
+ * @param[in] count   Number of operations.
+ */
+void host_test_bench_print(char const * p_name, uint64_t start, uint32_t count);
+
+/**@brief Macro for timing a statement repeated @p _count times.
+ *
+ * @param _name       Name of the operation.
+ * @param _index      Name of the loop index, which the statement can use.
+ * @param _count      Number of repetitions.
+ * @param _statement  Timed statement.
+ */
+#define HOST_TEST_BENCH(_name, _index, _count, _statement)      \
+    do                                                          \
+    {                                                           \
+        uint64_t _start = host_test_time_ns();                  \
+        for (uint32_t _index = 0; _index < (_count); _index++)  \
+        {                                                       \
+            _statement;                                         \
+        }                                                       \
+        host_test_bench_print((_name), _start, (_count));       \
+    } while (0)
+
+/**@brief Function for seeding the pseudo-random generator. Tests are repeatable with a fixed seed. */
+void host_test_seed(uint32_t seed);
+
+/**@brief Function for getting a pseudo-random 32-bit number. */
+uint32_t host_test_rand(void);
+
+/**@brief Function for printing the summary of a test program.
+ *
+ * @param[in] p_name  Name of the test program.
+ *
+ * @return Exit code: 0 if all checks passed, 1 otherwise.
+ */
+int host_test_report(char const * p_name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_TEST_H__
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @brief Host stand-in for the device header.
+ *
+ * @details Provides the CMSIS core intrinsics used by the tested modules, with the results the
+ *          Cortex-M instructions give. @c __CORTEX_M is deliberately not defined, so modules
+ *          take their portable code paths where they have them.
+ */
+
+#ifndef NRF_H
+#define NRF_H
+
+#include <stdint.h>
+
+#define __STATIC_INLINE static inline
+
+#define __REV(_value)   __builtin_bswap32(_value)
+#define __CLZ(_value)   host_clz(_value)
+#define __RBIT(_value)  host_rbit(_value)
+#define __DMB()         __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DSB()         __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __ISB()         __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __NOP()         do {} while (0)
+#define __WFE()         do {} while (0)
+
+#define RTC_COUNTER_COUNTER_Msk (0xFFFFFFUL)
+
+/* CLZ of zero is 32 on Cortex-M, while __builtin_clz(0) is undefined. */
+static inline uint32_t host_clz(uint32_t value)
+{
+    return (value != 0) ? (uint32_t)__builtin_clz(value) : 32;
+}
+
+static inline uint32_t host_rbit(uint32_t value)
+{
+    uint32_t result = 0;
+
+    for (uint32_t i = 0; i < 32; i++)
+    {
+        result = (result << 1) | ((value >> i) & 1);
+    }
+    return result;
+}
+
+#endif // NRF_H
@@ -0,0 +1,408 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @brief Test and benchmark of the fixed-key ECDSA verifier of the DFU.
+ *
+ * @details The comb verifier is compared with the generic ECDSA verifier of OpenSSL on keys and
+ *          signatures made by OpenSSL: valid signatures, tampered signatures and hashes, random
+ *          signatures, and signature values out of range. Both verifiers must agree on every input.
+ *
+ *          The time of one verification is then printed for the comb verifier, for OpenSSL, and
+ *          for a double-scalar multiplication with Shamir's trick on the field arithmetic of the
+ *          module. The last one shows what the combs save on the same arithmetic.
+ */
+#define OPENSSL_API_COMPAT 0x10100000L
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/ecdsa.h>
+#include <openssl/obj_mac.h>
+#include "host_test.h"
+
+/* The field and point functions are static, so the module is built as part of the test. */
+#include "nrf_dfu_ecdsa_fixed_key.c"
+
+#define KEY_COUNT       20
+#define SIG_COUNT       20
+#define BENCH_COUNT     200
+
+#define NUM_SIZE        32
+
+extern const uint8_t pk[NRF_DFU_ECDSA_FIXED_KEY_PK_SIZE];   // Debug key from dfu_public_key.c
+
+/* Order n of the P-256 group, in big-endian format. */
+static const uint8_t m_order_be[NUM_SIZE] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBC, 0xE6, 0xFA, 0xAD, 0xA7, 0x17, 0x9E, 0x84, 0xF3, 0xB9, 0xCA, 0xC2, 0xFC, 0x63, 0x25, 0x51
+};
+
+static EC_GROUP * mp_group;
+
+
+static void reverse_copy(uint8_t * p_dst, uint8_t const * p_src, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        p_dst[i] = p_src[len - 1 - i];
+    }
+}
+
+
+/**@brief Function for converting the public key of OpenSSL to the format of dfu_public_key.c. */
+static void key_to_le(EC_KEY const * p_key, uint8_t * p_pk)
+{
+    uint8_t oct[1 + 2 * NUM_SIZE];
+
+    (void)EC_POINT_point2oct(mp_group, EC_KEY_get0_public_key(p_key), POINT_CONVERSION_UNCOMPRESSED,
+                             oct, sizeof(oct), NULL);
+    reverse_copy(p_pk, &oct[1], NUM_SIZE);
+    reverse_copy(p_pk + NUM_SIZE, &oct[1 + NUM_SIZE], NUM_SIZE);
+}
+
+
+/**@brief Function for converting a little-endian public key to an OpenSSL key.
+ *
+ * @return Key or NULL if the point is not on the curve.
+ */
+static EC_KEY * key_from_le(uint8_t const * p_pk)
+{
+    uint8_t    oct[1 + 2 * NUM_SIZE];
+    EC_KEY   * p_key   = EC_KEY_new_by_curve_name(NID_X9_62_prime256v1);
+    EC_POINT * p_point = EC_POINT_new(mp_group);
+
+    oct[0] = POINT_CONVERSION_UNCOMPRESSED;
+    reverse_copy(&oct[1], p_pk, NUM_SIZE);
+    reverse_copy(&oct[1 + NUM_SIZE], p_pk + NUM_SIZE, NUM_SIZE);
+
+    if ((EC_POINT_oct2point(mp_group, p_point, oct, sizeof(oct), NULL) != 1) ||
+        (EC_KEY_set_public_key(p_key, p_point) != 1))
+    {
+        EC_KEY_free(p_key);
+        p_key = NULL;
+    }
+    EC_POINT_free(p_point);
+    return p_key;
+}
+
+
+static void sign(EC_KEY * p_key, uint8_t const * p_hash, uint8_t * p_sig)
+{
+    ECDSA_SIG    * p_ecdsa_sig = ECDSA_do_sign(p_hash, NUM_SIZE, p_key);
+    BIGNUM const * p_r;
+    BIGNUM const * p_s;
+    uint8_t        be[NUM_SIZE];
+
+    ECDSA_SIG_get0(p_ecdsa_sig, &p_r, &p_s);
+    (void)BN_bn2binpad(p_r, be, NUM_SIZE);
+    reverse_copy(p_sig, be, NUM_SIZE);
+    (void)BN_bn2binpad(p_s, be, NUM_SIZE);
+    reverse_copy(p_sig + NUM_SIZE, be, NUM_SIZE);
+    ECDSA_SIG_free(p_ecdsa_sig);
+}
+
+
+/**@brief Function for verifying a signature in the init packet format with OpenSSL. */
+static bool generic_verify(EC_KEY * p_key, uint8_t const * p_hash, uint8_t const * p_sig)
+{
+    ECDSA_SIG * p_ecdsa_sig = ECDSA_SIG_new();
+    uint8_t     be[NUM_SIZE];
+    BIGNUM    * p_r;
+    BIGNUM    * p_s;
+    int         result;
+
+    reverse_copy(be, p_sig, NUM_SIZE);
+    p_r = BN_bin2bn(be, NUM_SIZE, NULL);
+    reverse_copy(be, p_sig + NUM_SIZE, NUM_SIZE);
+    p_s = BN_bin2bn(be, NUM_SIZE, NULL);
+    (void)ECDSA_SIG_set0(p_ecdsa_sig, p_r, p_s);
+
+    result = ECDSA_do_verify(p_hash, NUM_SIZE, p_ecdsa_sig, p_key);
+    ECDSA_SIG_free(p_ecdsa_sig);
+    return result == 1;
+}
+
+
+static void random_bytes(uint8_t * p_buf, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        p_buf[i] = (uint8_t)host_test_rand();
+    }
+}
+
+
+/**@brief Function for checking one signature with both verifiers.
+ *
+ * @return Result of the comb verifier.
+ */
+static bool verify_both(EC_KEY * p_key, uint8_t const * p_hash, uint8_t const * p_sig)
+{
+    ret_code_t err_code = nrf_dfu_ecdsa_fixed_key_verify(p_hash, p_sig);
+
+    HOST_TEST_CHECK(err_code == NRF_SUCCESS || err_code == NRF_ERROR_INVALID_DATA);
+    HOST_TEST_CHECK((err_code == NRF_SUCCESS) == generic_verify(p_key, p_hash, p_sig));
+    return err_code == NRF_SUCCESS;
+}
+
+
+/**@brief Function for verifying a signature without comb tables.
+ *
+ * u1 * G + u2 * Q is computed with Shamir's trick: 256 doublings and one addition of G, Q, or
+ * G + Q for each bit. Uses the public key given to @ref nrf_dfu_ecdsa_fixed_key_init.
+ */
+static ret_code_t shamir_verify(uint8_t const * p_hash, uint8_t const * p_signature)
+{
+    affine_point_t   table[3];
+    jacobian_point_t point;
+    num_t            r;
+    num_t            s;
+    num_t            e;
+    num_t            u1;
+    num_t            u2;
+
+    num_from_le_bytes(r, p_signature);
+    num_from_le_bytes(s, p_signature + NRF_DFU_ECDSA_FIXED_KEY_SIG_SIZE / 2);
+    if (num_is_zero(r) || num_is_zero(s) || num_gte(r, m_n.m) || num_gte(s, m_n.m))
+    {
+        return NRF_ERROR_INVALID_DATA;
+    }
+
+    num_from_be_bytes(e, p_hash);
+    if (num_gte(e, m_n.m))
+    {
+        (void)num_sub(e, e, m_n.m);
+    }
+
+    mod_to_mont(s, s, &m_n);
+    mod_inv(s, s, &m_n);
+    mod_mul(u1, e, s, &m_n);
+    mod_mul(u2, r, s, &m_n);
+
+    // The first comb entries are G and Q.
+    table[0] = m_g_comb[0];
+    table[1] = m_pk_comb[0];
+    point_from_affine(&point, &table[0]);
+    point_add_affine(&point, &point, &table[1]);
+    point_to_affine(&table[2], &point);
+
+    point_set_infinity(&point);
+    for (int32_t i = 255; i >= 0; i--)
+    {
+        uint32_t index = ((u1[i / 32] >> (i % 32)) & 1) | (((u2[i / 32] >> (i % 32)) & 1) << 1);
+
+        point_double(&point, &point);
+        if (index != 0)
+        {
+            point_add_affine(&point, &point, &table[index - 1]);
+        }
+    }
+
+    if (num_is_zero(point.z))
+    {
+        return NRF_ERROR_INVALID_DATA;
+    }
+
+    mod_inv(e, point.z, &m_p);
+    mod_sqr(e, e, &m_p);
+    mod_mul(e, point.x, e, &m_p);
+    mod_from_mont(e, e, &m_p);
+    if (num_gte(e, m_n.m))
+    {
+        (void)num_sub(e, e, m_n.m);
+    }
+
+    return (memcmp(e, r, sizeof(num_t)) == 0) ? NRF_SUCCESS : NRF_ERROR_INVALID_DATA;
+}
+
+
+/**@brief Function for checking valid, tampered, and random signatures made with one key. */
+static void test_key(EC_KEY * p_key)
+{
+    uint8_t key_pk[NRF_DFU_ECDSA_FIXED_KEY_PK_SIZE];
+
+    key_to_le(p_key, key_pk);
+    HOST_TEST_CHECK(nrf_dfu_ecdsa_fixed_key_init(key_pk) == NRF_SUCCESS);
+
+    for (uint32_t i = 0; i < SIG_COUNT; i++)
+    {
+        uint8_t hash[NRF_DFU_ECDSA_FIXED_KEY_HASH_SIZE];
+        uint8_t sig[NRF_DFU_ECDSA_FIXED_KEY_SIG_SIZE];
+        uint8_t tampered[NRF_DFU_ECDSA_FIXED_KEY_SIG_SIZE];
+        uint8_t tampered_hash[NRF_DFU_ECDSA_FIXED_KEY_HASH_SIZE];
+        uint8_t bit;
+
+        random_bytes(hash, sizeof(hash));
+        if (i == 0)
+        {
+            // A hash above the group order is reduced before use.
+            memset(hash, 0xFF, sizeof(hash));
+        }
+        sign(p_key, hash, sig);
+        HOST_TEST_CHECK(verify_both(p_key, hash, sig));
+        HOST_TEST_CHECK(shamir_verify(hash, sig) == NRF_SUCCESS);
+
+        memcpy(tampered, sig, sizeof(sig));
+        bit = (uint8_t)(host_test_rand() % (8 * sizeof(sig)));
+        tampered[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+        HOST_TEST_CHECK(!verify_both(p_key, hash, tampered));
+
+        memcpy(tampered_hash, hash, sizeof(hash));
+        bit = (uint8_t)(host_test_rand() % (8 * sizeof(hash)));
+        tampered_hash[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+        HOST_TEST_CHECK(!verify_both(p_key, tampered_hash, sig));
+
+        random_bytes(tampered, sizeof(tampered));
+        HOST_TEST_CHECK(!verify_both(p_key, hash, tampered));
+    }
+}
+
+
+/**@brief Function for checking that R and S outside of [1, n-1] are rejected. */
+static void test_out_of_range(EC_KEY * p_key)
+{
+    uint8_t key_pk[NRF_DFU_ECDSA_FIXED_KEY_PK_SIZE];
+    uint8_t hash[NRF_DFU_ECDSA_FIXED_KEY_HASH_SIZE];
+    uint8_t sig[NRF_DFU_ECDSA_FIXED_KEY_SIG_SIZE];
+    uint8_t bad[NRF_DFU_ECDSA_FIXED_KEY_SIG_SIZE];
+
+    key_to_le(p_key, key_pk);
+    HOST_TEST_CHECK(nrf_dfu_ecdsa_fixed_key_init(key_pk) == NRF_SUCCESS);
+    random_bytes(hash, sizeof(hash));
+    sign(p_key, hash, sig);
+
+    for (uint32_t half = 0; half < 2; half++)
+    {
+        uint8_t * p_half = &bad[half * NUM_SIZE];
+
+        memcpy(bad, sig, sizeof(sig));
+        memset(p_half, 0, NUM_SIZE);
+        HOST_TEST_CHECK(!verify_both(p_key, hash, bad));
+
+        reverse_copy(p_half, m_order_be, NUM_SIZE);
+        HOST_TEST_CHECK(!verify_both(p_key, hash, bad));
+
+        memset(p_half, 0xFF, NUM_SIZE);
+        HOST_TEST_CHECK(!verify_both(p_key, hash, bad));
+    }
+}
+
+
+static void test_keys(void)
+{
+    EC_KEY * p_key = EC_KEY_new_by_curve_name(NID_X9_62_prime256v1);
+    uint8_t  off_curve[NRF_DFU_ECDSA_FIXED_KEY_PK_SIZE];
+    uint8_t  hash[NRF_DFU_ECDSA_FIXED_KEY_HASH_SIZE] = {0};
+    uint8_t  sig[NRF_DFU_ECDSA_FIXED_KEY_SIG_SIZE]   = {1};
+
+    // The debug key of the DFU examples is on the curve for both.
+    EC_KEY * p_debug_key = key_from_le(pk);
+    HOST_TEST_CHECK(p_debug_key != NULL);
+    HOST_TEST_CHECK(nrf_dfu_ecdsa_fixed_key_init(pk) == NRF_SUCCESS);
+    EC_KEY_free(p_debug_key);
+
+    // Keys which are not on the curve are rejected, and a failed init leaves no usable table.
+    memcpy(off_curve, pk, sizeof(off_curve));
+    off_curve[0] ^= 1;
+    HOST_TEST_CHECK(key_from_le(off_curve) == NULL);
+    HOST_TEST_CHECK(nrf_dfu_ecdsa_fixed_key_init(off_curve) == NRF_ERROR_INVALID_DATA);
+    HOST_TEST_CHECK(nrf_dfu_ecdsa_fixed_key_verify(hash, sig) == NRF_ERROR_INVALID_STATE);
+
+    // Private key 1: the public key is the generator, so both combs hold the same points.
+    EC_POINT * p_point = EC_POINT_new(mp_group);
+    (void)EC_POINT_mul(mp_group, p_point, BN_value_one(), NULL, NULL, NULL);
+    (void)EC_KEY_set_private_key(p_key, BN_value_one());
+    (void)EC_KEY_set_public_key(p_key, p_point);
+    EC_POINT_free(p_point);
+    test_key(p_key);
+
+    for (uint32_t i = 0; i < KEY_COUNT; i++)
+    {
+        HOST_TEST_CHECK(EC_KEY_generate_key(p_key) == 1);
+        test_key(p_key);
+    }
+
+    test_out_of_range(p_key);
+    EC_KEY_free(p_key);
+}
+
+
+static void bench_verify(void)
+{
+    EC_KEY * p_key = EC_KEY_new_by_curve_name(NID_X9_62_prime256v1);
+    uint8_t  key_pk[NRF_DFU_ECDSA_FIXED_KEY_PK_SIZE];
+    uint8_t  hash[NRF_DFU_ECDSA_FIXED_KEY_HASH_SIZE];
+    uint8_t  sig[NRF_DFU_ECDSA_FIXED_KEY_SIG_SIZE];
+    uint32_t failures = 0;
+
+    (void)EC_KEY_generate_key(p_key);
+    key_to_le(p_key, key_pk);
+    random_bytes(hash, sizeof(hash));
+    sign(p_key, hash, sig);
+
+    printf("ECDSA P-256 verification:\n");
+    HOST_TEST_BENCH("comb table init", i, BENCH_COUNT,
+                    failures += (nrf_dfu_ecdsa_fixed_key_init(key_pk) != NRF_SUCCESS));
+    HOST_TEST_BENCH("comb verify", i, BENCH_COUNT,
+                    failures += (nrf_dfu_ecdsa_fixed_key_verify(hash, sig) != NRF_SUCCESS));
+    HOST_TEST_BENCH("Shamir verify, same arithmetic", i, BENCH_COUNT,
+                    failures += (shamir_verify(hash, sig) != NRF_SUCCESS));
+    HOST_TEST_BENCH("OpenSSL verify", i, BENCH_COUNT,
+                    failures += !generic_verify(p_key, hash, sig));
+    HOST_TEST_CHECK(failures == 0);
+
+    EC_KEY_free(p_key);
+}
+
+
+int main(void)
+{
+    host_test_seed(33);
+    mp_group = EC_GROUP_new_by_curve_name(NID_X9_62_prime256v1);
+
+    test_keys();
+    bench_verify();
+
+    EC_GROUP_free(mp_group);
+    return host_test_report("dfu_ecdsa_fixed_key");
+}
@@ -0,0 +1,65 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef SDK_CONFIG_H
+#define SDK_CONFIG_H
+
+#define MEM_MANAGER_ENABLED                 1
+#define MEM_MANAGER_CONFIG_LOG_ENABLED      0
+#define MEM_MANAGER_DISABLE_API_PARAM_CHECK 0
+
+// Three categories of 255 blocks, the largest count sdk_config.h allows.
+#define MEMORY_MANAGER_XXSMALL_BLOCK_COUNT  0
+#define MEMORY_MANAGER_XXSMALL_BLOCK_SIZE   32
+#define MEMORY_MANAGER_XSMALL_BLOCK_COUNT   0
+#define MEMORY_MANAGER_XSMALL_BLOCK_SIZE    64
+#define MEMORY_MANAGER_SMALL_BLOCK_COUNT    255
+#define MEMORY_MANAGER_SMALL_BLOCK_SIZE     32
+#define MEMORY_MANAGER_MEDIUM_BLOCK_COUNT   255
+#define MEMORY_MANAGER_MEDIUM_BLOCK_SIZE    64
+#define MEMORY_MANAGER_LARGE_BLOCK_COUNT    255
+#define MEMORY_MANAGER_LARGE_BLOCK_SIZE     128
+#define MEMORY_MANAGER_XLARGE_BLOCK_COUNT   0
+#define MEMORY_MANAGER_XLARGE_BLOCK_SIZE    1320
+#define MEMORY_MANAGER_XXLARGE_BLOCK_COUNT  0
+#define MEMORY_MANAGER_XXLARGE_BLOCK_SIZE   3444
+
+#define NRF_LOG_ENABLED                     0
+
+#endif // SDK_CONFIG_H
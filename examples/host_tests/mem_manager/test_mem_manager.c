@@ -0,0 +1,252 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @brief Test and benchmark of the memory manager.
+ *
+ * @details Checks that filling the pool returns every block exactly once, falling through to
+ *          larger categories, that allocated buffers never overlap under random allocation and
+ *          release, and measures allocation and release when the pool is empty and when only
+ *          the last block is free.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "sdk_common.h"
+#include "mem_manager.h"
+#include "host_test.h"
+
+#define CAT_COUNT       3
+#define BLOCK_COUNT     (MEMORY_MANAGER_SMALL_BLOCK_COUNT  + \
+                         MEMORY_MANAGER_MEDIUM_BLOCK_COUNT + \
+                         MEMORY_MANAGER_LARGE_BLOCK_COUNT)
+#define MAX_SIZE        MEMORY_MANAGER_LARGE_BLOCK_SIZE
+#define RANDOM_STEPS    200000
+#define BENCH_COUNT     1000000
+
+static const uint32_t m_cat_size[CAT_COUNT] =
+{
+    MEMORY_MANAGER_SMALL_BLOCK_SIZE,
+    MEMORY_MANAGER_MEDIUM_BLOCK_SIZE,
+    MEMORY_MANAGER_LARGE_BLOCK_SIZE
+};
+
+static const uint32_t m_cat_count[CAT_COUNT] =
+{
+    MEMORY_MANAGER_SMALL_BLOCK_COUNT,
+    MEMORY_MANAGER_MEDIUM_BLOCK_COUNT,
+    MEMORY_MANAGER_LARGE_BLOCK_COUNT
+};
+
+static uint8_t * m_blocks[BLOCK_COUNT];
+
+
+/**@brief Function for filling a buffer with a pattern derived from its tag. */
+static void pattern_fill(uint8_t * p_buffer, uint32_t size, uint32_t tag)
+{
+    for (uint32_t i = 0; i < size; i++)
+    {
+        p_buffer[i] = (uint8_t)(tag * 31 + i);
+    }
+}
+
+
+static bool pattern_check(uint8_t const * p_buffer, uint32_t size, uint32_t tag)
+{
+    for (uint32_t i = 0; i < size; i++)
+    {
+        if (p_buffer[i] != (uint8_t)(tag * 31 + i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+/**@brief Function for reserving every block with the smallest request, then releasing them. */
+static void test_fill(void)
+{
+    uint32_t index = 0;
+    bool     intact = true;
+
+    for (uint32_t cat = 0; cat < CAT_COUNT; cat++)
+    {
+        for (uint32_t i = 0; i < m_cat_count[cat]; i++, index++)
+        {
+            uint32_t size = 1;
+
+            // Exhausted categories fall through to the next larger one.
+            HOST_TEST_CHECK(nrf_mem_reserve(&m_blocks[index], &size) == NRF_SUCCESS);
+            HOST_TEST_CHECK(size == m_cat_size[cat]);
+            pattern_fill(m_blocks[index], size, index);
+        }
+    }
+
+    uint8_t * p_buffer = NULL;
+    uint32_t  size     = 1;
+
+    HOST_TEST_CHECK(nrf_mem_reserve(&p_buffer, &size) ==
+                    (NRF_ERROR_NO_MEM | NRF_ERROR_MEMORY_MANAGER_ERR_BASE));
+    HOST_TEST_CHECK(nrf_malloc(1) == NULL);
+
+    // Buffers that overlap would have overwritten each other's pattern.
+    index = 0;
+    for (uint32_t cat = 0; cat < CAT_COUNT; cat++)
+    {
+        for (uint32_t i = 0; i < m_cat_count[cat]; i++, index++)
+        {
+            intact &= pattern_check(m_blocks[index], m_cat_size[cat], index);
+        }
+    }
+    HOST_TEST_CHECK(intact);
+
+    // A pointer into a block does not release it.
+    nrf_free(m_blocks[0] + 1);
+    HOST_TEST_CHECK(nrf_malloc(1) == NULL);
+
+    for (uint32_t i = 0; i < BLOCK_COUNT; i++)
+    {
+        nrf_free(m_blocks[i]);
+    }
+}
+
+
+/**@brief Function for reserving and releasing random sizes in random order. */
+static void test_random(void)
+{
+    uint32_t sizes[BLOCK_COUNT];
+    uint32_t tags[BLOCK_COUNT];
+    uint32_t held     = 0;
+    uint32_t reserved = 0;
+    uint32_t large_enough = 0;
+    uint32_t released = 0;
+    uint32_t intact   = 0;
+
+    for (uint32_t step = 0; step < RANDOM_STEPS; step++)
+    {
+        if ((held > 0) && ((held == BLOCK_COUNT) || (host_test_rand() % 3 == 0)))
+        {
+            uint32_t pick = host_test_rand() % held;
+
+            intact += pattern_check(m_blocks[pick], sizes[pick], tags[pick]);
+            released++;
+            nrf_free(m_blocks[pick]);
+
+            held--;
+            m_blocks[pick] = m_blocks[held];
+            sizes[pick]    = sizes[held];
+            tags[pick]     = tags[held];
+        }
+        else
+        {
+            uint32_t requested = 1 + host_test_rand() % MAX_SIZE;
+            uint32_t size      = requested;
+
+            // Fails only when every block large enough is in use.
+            if (nrf_mem_reserve(&m_blocks[held], &size) == NRF_SUCCESS)
+            {
+                reserved++;
+                large_enough += (size >= requested);
+                sizes[held] = size;
+                tags[held]  = step;
+                pattern_fill(m_blocks[held], size, step);
+                held++;
+            }
+        }
+    }
+    HOST_TEST_CHECK(large_enough == reserved);
+    HOST_TEST_CHECK(intact == released);
+
+    while (held > 0)
+    {
+        nrf_free(m_blocks[--held]);
+    }
+}
+
+
+/**@brief Function for reserving all blocks but the last one of the largest category. */
+static void pool_fill_but_last(void)
+{
+    for (uint32_t i = 0; i < BLOCK_COUNT; i++)
+    {
+        m_blocks[i] = nrf_malloc(1);
+    }
+    nrf_free(m_blocks[BLOCK_COUNT - 1]);
+}
+
+
+static void pool_release(void)
+{
+    for (uint32_t i = 0; i < BLOCK_COUNT - 1; i++)
+    {
+        nrf_free(m_blocks[i]);
+    }
+}
+
+
+int main(void)
+{
+    host_test_seed(36);
+
+    HOST_TEST_CHECK(nrf_malloc(1) == NULL);
+    HOST_TEST_CHECK(nrf_mem_init() == NRF_SUCCESS);
+
+    uint8_t * p_buffer = NULL;
+    uint32_t  size     = MAX_SIZE + 1;
+
+    HOST_TEST_CHECK(nrf_mem_reserve(&p_buffer, &size) ==
+                    (NRF_ERROR_INVALID_PARAM | NRF_ERROR_MEMORY_MANAGER_ERR_BASE));
+
+    test_fill();
+    test_random();
+    test_fill();
+
+    printf("%u blocks in %u categories:\n", BLOCK_COUNT, CAT_COUNT);
+    HOST_TEST_BENCH("malloc and free, pool empty", i, BENCH_COUNT,
+                    nrf_free(nrf_malloc(1 + (i & 31))));
+
+    pool_fill_but_last();
+    HOST_TEST_BENCH("malloc and free, last block free", i, BENCH_COUNT,
+                    nrf_free(nrf_malloc(1)));
+    pool_release();
+
+    return host_test_report("mem_manager");
+}
@@ -0,0 +1,201 @@
+/**
+ * Copyright (c) 2020, Nordic Semiconductor ASA
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form, except as embedded into a Nordic
+ *    Semiconductor ASA integrated circuit in a product or a software update for
+ *    such product, must reproduce the above copyright notice, this list of
+ *    conditions and the following disclaimer in the documentation and/or other
+ *    materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * 4. This software, with or without modification, must only be used with a
+ *    Nordic Semiconductor ASA integrated circuit.
+ *
+ * 5. Any software provided in binary form under this license must not be reverse
+ *    engineered, decompiled, modified and/or disassembled.
+ *
+ * THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+ * GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file
+ *
+ * @brief Test and benchmark of the SHA-256 implementation of the sha256 library.
+ *
+ * @details The library is checked against the FIPS 180-2 example vectors and against OpenSSL for
+ *          random messages, fed in random pieces at random alignments. The test is built with
+ *          __CORTEX_M defined, so the word loads with __REV used on the target are exercised.
+ */
+#include <stdint.h>
+#include <openssl/sha.h>
+#include "nordic_common.h"
+#include "host_test.h"
+#include "sha256.h"
+
+#define BENCH_SIZE      4096
+#define BENCH_COUNT     4096
+#define RANDOM_RUNS     2000
+#define RANDOM_LEN_MAX  1000
+
+typedef struct
+{
+    char const * p_msg;
+    uint32_t     repeat;
+    char const * p_digest;
+} sha256_vector_t;
+
+static const sha256_vector_t m_vectors[] =
+{
+    { "", 1,
+      "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" },
+    { "abc", 1,
+      "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" },
+    { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1,
+      "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" },
+    { "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu", 1,
+      "cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1" },
+    { "a", 1000000,
+      "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0" },
+};
+
+/* Extra room for the misaligned copies. */
+static uint8_t m_buf[BENCH_SIZE + 8];
+
+
+static void hex_to_bytes(char const * p_hex, uint8_t * p_out, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        unsigned int byte;
+
+        (void)sscanf(&p_hex[2 * i], "%2x", &byte);
+        p_out[i] = (uint8_t)byte;
+    }
+}
+
+
+static void hash_vector(sha256_vector_t const * p_vector, uint8_t * p_digest, uint8_t le)
+{
+    sha256_context_t ctx;
+    ret_code_t       err_code = sha256_init(&ctx);
+
+    for (uint32_t i = 0; i < p_vector->repeat; i++)
+    {
+        err_code |= sha256_update(&ctx, (uint8_t const *)p_vector->p_msg, strlen(p_vector->p_msg));
+    }
+    err_code |= sha256_final(&ctx, p_digest, le);
+    HOST_TEST_CHECK(err_code == NRF_SUCCESS);
+}
+
+
+static void test_vectors(void)
+{
+    for (size_t v = 0; v < sizeof(m_vectors) / sizeof(m_vectors[0]); v++)
+    {
+        sha256_vector_t const * p_vector = &m_vectors[v];
+        uint8_t                 expected[32];
+        uint8_t                 digest[32];
+        uint8_t                 digest_le[32];
+
+        hex_to_bytes(p_vector->p_digest, expected, sizeof(expected));
+
+        hash_vector(p_vector, digest, 0);
+        HOST_TEST_CHECK_MEM(digest, expected, sizeof(expected));
+
+        // The little-endian output is the same digest, byte-reversed.
+        hash_vector(p_vector, digest_le, 1);
+        for (uint32_t i = 0; i < sizeof(digest) / 2; i++)
+        {
+            uint8_t swap = digest_le[i];
+
+            digest_le[i] = digest_le[sizeof(digest_le) - 1 - i];
+            digest_le[sizeof(digest_le) - 1 - i] = swap;
+        }
+        HOST_TEST_CHECK_MEM(digest_le, expected, sizeof(expected));
+    }
+}
+
+
+static void test_random_pieces(void)
+{
+    static uint8_t msg[RANDOM_LEN_MAX];
+    static uint8_t copy[RANDOM_LEN_MAX + 4];
+
+    for (uint32_t run = 0; run < RANDOM_RUNS; run++)
+    {
+        size_t           len = host_test_rand() % RANDOM_LEN_MAX;
+        sha256_context_t ctx;
+        uint8_t          expected[32];
+        uint8_t          digest[32];
+
+        for (size_t i = 0; i < len; i++)
+        {
+            msg[i] = (uint8_t)host_test_rand();
+        }
+        (void)SHA256(msg, len, expected);
+
+        HOST_TEST_CHECK(sha256_init(&ctx) == NRF_SUCCESS);
+        for (size_t done = 0; done < len; )
+        {
+            // Each piece is copied to a random alignment, to take both load paths.
+            size_t   piece  = 1 + host_test_rand() % MIN(len - done, 200);
+            uint32_t offset = host_test_rand() & 3;
+
+            memcpy(&copy[offset], &msg[done], piece);
+            HOST_TEST_CHECK(sha256_update(&ctx, &copy[offset], piece) == NRF_SUCCESS);
+            done += piece;
+        }
+        HOST_TEST_CHECK(sha256_final(&ctx, digest, 0) == NRF_SUCCESS);
+        HOST_TEST_CHECK_MEM(digest, expected, sizeof(expected));
+    }
+}
+
+
+static void bench_hash(char const * p_name, uint8_t const * p_data)
+{
+    sha256_context_t ctx;
+    uint8_t          digest[32];
+
+    HOST_TEST_CHECK(sha256_init(&ctx) == NRF_SUCCESS);
+    HOST_TEST_BENCH(p_name, i, BENCH_COUNT, UNUSED_RETURN_VALUE(sha256_update(&ctx, p_data, BENCH_SIZE)));
+    HOST_TEST_CHECK(sha256_final(&ctx, digest, 0) == NRF_SUCCESS);
+}
+
+
+int main(void)
+{
+    host_test_seed(32);
+
+    test_vectors();
+    test_random_pieces();
+
+    for (size_t i = 0; i < sizeof(m_buf); i++)
+    {
+        m_buf[i] = (uint8_t)host_test_rand();
+    }
+
+    printf("sha256_update() of %u bytes:\n", BENCH_SIZE);
+    bench_hash("aligned input", &m_buf[0]);
+    bench_hash("unaligned input", &m_buf[1]);
+
+    return host_test_report("sha256");
+}
@@ -0,0 +1,254 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2020, Nordic Semiconductor ASA
+#
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without modification,
+# are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+#    list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form, except as embedded into a Nordic
+#    Semiconductor ASA integrated circuit in a product or a software update for
+#    such product, must reproduce the above copyright notice, this list of
+#    conditions and the following disclaimer in the documentation and/or other
+#    materials provided with the distribution.
+#
+# 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# 4. This software, with or without modification, must only be used with a
+#    Nordic Semiconductor ASA integrated circuit.
+#
+# 5. Any software provided in binary form under this license must not be reverse
+#    engineered, decompiled, modified and/or disassembled.
+#
+# THIS SOFTWARE IS PROVIDED BY NORDIC SEMICONDUCTOR ASA "AS IS" AND ANY EXPRESS
+# OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+# OF MERCHANTABILITY, NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL NORDIC SEMICONDUCTOR ASA OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+# GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+# HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+# OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+"""Decoder for the nrf_log dictionary (binary) mode.
+
+When NRF_LOG_DICTIONARY_MODE is enabled, the log backends send raw entries
+instead of formatted text. This script reads such a stream (from a file, a
+serial port or stdin) and prints the log lines, using the ELF file of the
+application to resolve format strings, string arguments and module names.
+
+Usage:
+    nrf_log_dict_decode.py app.elf log.bin
+    nrf_log_dict_decode.py app.elf /dev/ttyACM0 --baudrate 115200
+    JLinkRTTLogger ... | nrf_log_dict_decode.py app.elf -
+
+Requires pyelftools (and pyserial when reading from a serial port).
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+from elftools.elf.elffile import ELFFile
+
+SYNC_BYTE = 0xA5
+HEADER_FMT = '<BBBHHI'
+HEADER_SIZE = struct.calcsize(HEADER_FMT)
+
+TYPE_STD = 1
+TYPE_HEXDUMP = 2
+
+SEVERITY_NAMES = {1: 'error', 2: 'warning', 3: 'info', 4: 'debug', 5: None}
+
+STR_ADDR_MASK = (1 << 22) - 1
+MODULE_CONST_DATA_SIZE = 8
+HEXDUMP_BYTES_IN_LINE = 8
+
+FORMAT_SPEC = re.compile(r'%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|z|j|t)?([diouxXcspf%])')
+
+
+class Dictionary(object):
+    """Format strings, constant data and module names read from the ELF file."""
+
+    def __init__(self, elf_path, module_stride):
+        self._segments = []
+        self._modules = []
+        with open(elf_path, 'rb') as f:
+            elf = ELFFile(f)
+            for section in elf.iter_sections():
+                addr = section['sh_addr']
+                if section['sh_type'] == 'SHT_NOBITS' or addr == 0:
+                    continue
+                self._segments.append((addr, section.data()))
+            log_const = elf.get_section_by_name('.log_const_data')
+            if log_const is not None:
+                data = log_const.data()
+                for offset in range(0, len(data) - 3, module_stride):
+                    (p_name,) = struct.unpack_from('<I', data, offset)
+                    self._modules.append(self.string(p_name) or '?')
+
+    def string(self, addr):
+        for base, data in self._segments:
+            if base <= addr < base + len(data):
+                end = data.find(b'\0', addr - base)
+                if end < 0:
+                    end = len(data)
+                return data[addr - base:end].decode('utf-8', 'replace')
+        return None
+
+    def module_name(self, module_id):
+        if module_id < len(self._modules):
+            return self._modules[module_id]
+        return 'module_%d' % module_id
+
+
+def to_signed(value):
+    return value - (1 << 32) if value & 0x80000000 else value
+
+
+def format_entry(dictionary, fmt, args):
+    """Render a format string the way nrf_fprintf does, using 32-bit arguments."""
+    args = list(args)
+
+    def replace(match):
+        flags, width, precision, _length, conv = match.groups()
+        if conv == '%':
+            return '%'
+        if width == '*':
+            width = str(to_signed(args.pop(0))) if args else ''
+        if precision == '*':
+            precision = str(to_signed(args.pop(0))) if args else ''
+        spec = '%' + (flags or '') + (width or '') + ('.' + precision if precision else '')
+        if not args:
+            return match.group(0)
+        value = args.pop(0)
+        if conv in 'di':
+            return (spec + 'd') % to_signed(value)
+        if conv == 'u':
+            return (spec + 'd') % value
+        if conv in 'oxX':
+            return (spec + conv) % value
+        if conv == 'p':
+            return (spec + 's') % ('0x%08x' % value)
+        if conv == 'c':
+            return (spec + 'c') % chr(value & 0xFF)
+        if conv == 's':
+            text = dictionary.string(value)
+            return (spec + 's') % (text if text is not None else '<str@0x%08x>' % value)
+        # Floats are logged with NRF_LOG_FLOAT_MARKER and two integer arguments.
+        return (spec + 'd') % value
+
+    return FORMAT_SPEC.sub(replace, fmt)
+
+
+def print_line(out, dictionary, severity, module_id, timestamp, text, use_timestamp):
+    name = SEVERITY_NAMES.get(severity, str(severity))
+    if name is None:
+        out.write(text)
+        return
+    prefix = '[%08d] ' % timestamp if use_timestamp else ''
+    out.write('%s<%s> %s: %s\n' % (prefix, name, dictionary.module_name(module_id),
+                                     text.rstrip('\r\n')))
+
+
+def decode_stream(stream, dictionary, out, use_timestamp, follow):
+    buf = bytearray()
+    while True:
+        chunk = stream.read(64)
+        if not chunk:
+            if follow:
+                continue
+            break
+        buf.extend(chunk)
+
+        while True:
+            # Resynchronize on the sync byte.
+            start = buf.find(bytes([SYNC_BYTE]))
+            if start < 0:
+                del buf[:]
+                break
+            del buf[:start]
+            if len(buf) < HEADER_SIZE:
+                break
+
+            _, type_sev, nargs, module_id, dropped, timestamp = struct.unpack_from(HEADER_FMT, buf)
+            entry_type = type_sev >> 4
+            severity = type_sev & 0x0F
+
+            if entry_type == TYPE_STD and nargs <= 6:
+                size = HEADER_SIZE + 4 + 4 * nargs
+                if len(buf) < size:
+                    break
+                values = struct.unpack_from('<%dI' % (nargs + 1), buf, HEADER_SIZE)
+                fmt = dictionary.string(values[0] & STR_ADDR_MASK)
+                if fmt is None:
+                    text = '<unknown string 0x%06x> %s' % (
+                        values[0], ' '.join('0x%08x' % v for v in values[1:]))
+                else:
+                    text = format_entry(dictionary, fmt, values[1:])
+            elif entry_type == TYPE_HEXDUMP:
+                if len(buf) < HEADER_SIZE + 2:
+                    break
+                (length,) = struct.unpack_from('<H', buf, HEADER_SIZE)
+                size = HEADER_SIZE + 2 + length
+                if len(buf) < size:
+                    break
+                data = bytes(buf[HEADER_SIZE + 2:size])
+                lines = []
+                for i in range(0, len(data), HEXDUMP_BYTES_IN_LINE):
+                    part = data[i:i + HEXDUMP_BYTES_IN_LINE]
+                    lines.append(' '.join('%02x' % b for b in part).ljust(HEXDUMP_BYTES_IN_LINE * 3)
+                                 + '|' + ''.join(chr(b) if 0x20 <= b < 0x7F else '.' for b in part))
+                text = '\n'.join(lines)
+            else:
+                # Not an entry start, skip the false sync byte.
+                del buf[:1]
+                continue
+
+            if dropped:
+                out.write('Logs dropped (%d)\n' % dropped)
+            print_line(out, dictionary, severity, module_id, timestamp, text, use_timestamp)
+            out.flush()
+            del buf[:size]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode nrf_log dictionary mode output.')
+    parser.add_argument('elf', help='ELF file of the application that produced the log')
+    parser.add_argument('input', help='binary log file, serial port, or - for stdin')
+    parser.add_argument('--baudrate', type=int, default=115200,
+                        help='baud rate when reading from a serial port')
+    parser.add_argument('--timestamp', action='store_true',
+                        help='print timestamps (NRF_LOG_USES_TIMESTAMP enabled)')
+    parser.add_argument('--module-stride', type=int, default=MODULE_CONST_DATA_SIZE,
+                        help='size of nrf_log_module_const_data_t on the target')
+    args = parser.parse_args()
+
+    dictionary = Dictionary(args.elf, args.module_stride)
+
+    follow = False
+    if args.input == '-':
+        stream = sys.stdin.buffer
+    elif args.input.startswith('/dev/') or args.input.upper().startswith('COM'):
+        import serial
+        stream = serial.Serial(args.input, args.baudrate, timeout=0.1)
+        follow = True
+    else:
+        stream = open(args.input, 'rb')
+
+    try:
+        decode_stream(stream, dictionary, sys.stdout, args.timestamp, follow)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == '__main__':
+    main()